@@ -59,3 +59,38 @@
 
 #endif
 #endif
+
+#ifdef ENGINE_PLATFORM_LINUX
+
+#include "Core/Log.h"
+
+#include <cstdlib>
+#include <cstring>
+
+	// There is no window backend on Linux yet, so the runtime always runs headless.
+	// "--frames N" stops after N frames instead of running until shut down.
+	int main(int argc, char** argv)
+	{
+		Gravix::Log::Init();
+
+		Gravix::ApplicationSpecification appSpec{};
+		appSpec.Width = 1280;
+		appSpec.Height = 720;
+		appSpec.Title = "Gravix Runtime";
+		appSpec.IsRuntime = true;
+		appSpec.Headless = true;
+
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			if (std::strcmp(argv[i], "--frames") == 0)
+				appSpec.FrameLimit = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+		}
+
+		Gravix::Application app(appSpec);
+		app.PushLayer<Gravix::AppLayer>();
+		app.Run();
+
+		return 0;
+	}
+
+#endif
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Asset.h"
+#include "AssetMetadata.h"
 
 namespace Gravix
 {
@@ -32,5 +33,43 @@ namespace Gravix
 		return AssetType::None;
 	}
 
+	std::string_view TextureCompressionToString(TextureCompression compression)
+	{
+		switch (compression)
+		{
+		case TextureCompression::Auto: return "Auto";
+		case TextureCompression::None: return "None";
+		case TextureCompression::BC7:  return "BC7";
+		case TextureCompression::BC5:  return "BC5";
+		case TextureCompression::BC4:  return "BC4";
+		default:                       return "Auto";
+		}
+	}
+
+	TextureCompression StringToTextureCompression(std::string_view compression)
+	{
+		if (compression == "None") return TextureCompression::None;
+		if (compression == "BC7")  return TextureCompression::BC7;
+		if (compression == "BC5")  return TextureCompression::BC5;
+		if (compression == "BC4")  return TextureCompression::BC4;
+		return TextureCompression::Auto;
+	}
+
+	std::string_view TextureMipFilterToString(TextureMipFilter filter)
+	{
+		switch (filter)
+		{
+		case TextureMipFilter::Box:    return "Box";
+		case TextureMipFilter::Kaiser: return "Kaiser";
+		default:                       return "Kaiser";
+		}
+	}
+
+	TextureMipFilter StringToTextureMipFilter(std::string_view filter)
+	{
+		if (filter == "Box") return TextureMipFilter::Box;
+		return TextureMipFilter::Kaiser;
+	}
+
 }
 
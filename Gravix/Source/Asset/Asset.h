@@ -41,6 +41,7 @@ namespace Gravix
 	 * 3. ReadyForGPU - CPU loading complete, waiting for GPU upload
 	 * 4. Loaded - Fully loaded and ready for use
 	 * 5. Failed - Loading failed due to missing file, invalid data, etc.
+	 * 6. Cancelled - The requester gave up before the load finished
 	 */
 	enum AssetState
 	{
@@ -48,7 +49,21 @@ namespace Gravix
 		Loading,      ///< Currently loading from disk (async)
 		ReadyForGPU,  ///< CPU data loaded, pending GPU upload
 		Loaded,       ///< Fully loaded and ready to use
-		Failed        ///< Loading failed (file not found, invalid format, etc.)
+		Failed,       ///< Loading failed (file not found, invalid format, etc.)
+		Cancelled     ///< Abandoned through its cancellation token
+	};
+
+	/**
+	 * @brief Memory an asset keeps alive, split by where it lives
+	 *
+	 * Estimates are fine; they drive residency budgets, not allocations.
+	 */
+	struct AssetMemoryUsage
+	{
+		uint64_t CPUBytes = 0; ///< System memory (decoded data, CPU-side copies)
+		uint64_t GPUBytes = 0; ///< Device memory (images, buffers)
+
+		uint64_t GetTotal() const { return CPUBytes + GPUBytes; }
 	};
 
 	/**
@@ -113,6 +128,12 @@ namespace Gravix
 		 */
 		virtual AssetType GetAssetType() const = 0;
 
+		/**
+		 * @brief Estimate the memory this asset keeps resident
+		 * @return CPU and GPU byte counts; zero for assets that own no large data
+		 */
+		virtual AssetMemoryUsage GetMemoryUsage() const { return {}; }
+
 		/**
 		 * @brief Get the unique handle for this asset
 		 * @return Asset handle (UUID)
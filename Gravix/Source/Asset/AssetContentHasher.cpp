@@ -0,0 +1,91 @@
+#include "pch.h"
+#include "AssetContentHasher.h"
+
+#include "Core/Application.h"
+#include "Core/Hash.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+
+namespace Gravix
+{
+
+	struct AssetContentHasher::HashTask : enki::ITaskSet
+	{
+		std::vector<Job> Jobs;
+
+		void ExecuteRange(enki::TaskSetPartition range, uint32_t threadNum) override
+		{
+			for (uint32_t i = range.start; i < range.end; i++)
+			{
+				Job& job = Jobs[i];
+
+				// Timestamp first: a write landing in between then shows up as another change
+				std::error_code error;
+				auto writeTime = std::filesystem::last_write_time(job.Path, error);
+				job.Output.LastModifiedTime = error ? 0 : static_cast<uint64_t>(writeTime.time_since_epoch().count());
+				job.Output.ContentHash = Hash::ComputeFile64(job.Path);
+			}
+		}
+	};
+
+	AssetContentHasher::AssetContentHasher()
+		: m_HashTask(CreateScope<HashTask>())
+	{
+		// Editors save in bursts; nothing on screen waits on these
+		m_HashTask->m_Priority = enki::TASK_PRIORITY_LOW;
+	}
+
+	AssetContentHasher::~AssetContentHasher()
+	{
+		Clear();
+	}
+
+	void AssetContentHasher::Enqueue(AssetHandle handle, const std::filesystem::path& path)
+	{
+		auto it = std::find_if(m_QueuedJobs.begin(), m_QueuedJobs.end(), [handle](const Job& job) { return job.Output.Handle == handle; });
+		if (it != m_QueuedJobs.end())
+		{
+			it->Path = path;
+			return;
+		}
+
+		m_QueuedJobs.push_back({ path, { handle, 0, 0 } });
+	}
+
+	void AssetContentHasher::Update(std::vector<Result>& outResults)
+	{
+		if (!m_HashTask->Jobs.empty())
+		{
+			if (!m_HashTask->GetIsComplete())
+				return;
+
+			for (const Job& job : m_HashTask->Jobs)
+				outResults.push_back(job.Output);
+			m_HashTask->Jobs.clear();
+		}
+
+		if (m_QueuedJobs.empty())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		std::swap(m_HashTask->Jobs, m_QueuedJobs);
+		m_HashTask->m_SetSize = static_cast<uint32_t>(m_HashTask->Jobs.size());
+		m_HashTask->m_MinRange = 1;
+		Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(m_HashTask.get());
+	}
+
+	void AssetContentHasher::Clear()
+	{
+		m_QueuedJobs.clear();
+		if (m_HashTask->Jobs.empty())
+			return;
+
+		if (!m_HashTask->GetIsComplete())
+			Application::Get().GetScheduler().GetTaskScheduler().WaitforTask(m_HashTask.get());
+		m_HashTask->Jobs.clear();
+	}
+
+}
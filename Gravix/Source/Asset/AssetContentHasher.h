@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Asset.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Gravix
+{
+
+	// Hashes the files whose timestamps changed on a worker, so the asset manager can tell
+	// an edit from a touch, a checkout or a save without changes before reimporting anything.
+	// Main thread only.
+	class AssetContentHasher
+	{
+	public:
+		struct Result
+		{
+			AssetHandle Handle;
+			uint64_t ContentHash;      // 0 when the file could not be read
+			uint64_t LastModifiedTime;
+		};
+
+		AssetContentHasher();
+		~AssetContentHasher();
+
+		AssetContentHasher(const AssetContentHasher&) = delete;
+		AssetContentHasher& operator=(const AssetContentHasher&) = delete;
+
+		// Absolute path. Queued twice before it is dispatched, a file is hashed once.
+		void Enqueue(AssetHandle handle, const std::filesystem::path& path);
+
+		// Appends the hashes finished since the last call and dispatches the queued files. Call once per frame.
+		void Update(std::vector<Result>& outResults);
+
+		// Drops everything queued or in flight
+		void Clear();
+	private:
+		struct Job
+		{
+			std::filesystem::path Path;
+			Result Output;
+		};
+
+		struct HashTask;
+	private:
+		std::vector<Job> m_QueuedJobs;
+		// Owned by a worker while in flight
+		Scope<HashTask> m_HashTask;
+	};
+
+}
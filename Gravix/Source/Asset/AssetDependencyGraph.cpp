@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "AssetDependencyGraph.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace Gravix
+{
+
+	void AssetDependencyGraph::SetDependencies(AssetHandle handle, const std::vector<AssetHandle>& dependencies)
+	{
+		RemoveAsset(handle);
+		if (dependencies.empty())
+			return;
+
+		std::vector<AssetHandle>& edges = m_Dependencies[handle];
+		for (AssetHandle dependency : dependencies)
+		{
+			if (dependency == 0 || dependency == handle)
+				continue;
+
+			AddEdge(edges, dependency);
+			AddEdge(m_Dependents[dependency], handle);
+		}
+	}
+
+	void AssetDependencyGraph::RemoveAsset(AssetHandle handle)
+	{
+		auto it = m_Dependencies.find(handle);
+		if (it == m_Dependencies.end())
+			return;
+
+		for (AssetHandle dependency : it->second)
+		{
+			auto dependentsIt = m_Dependents.find(dependency);
+			if (dependentsIt == m_Dependents.end())
+				continue;
+
+			RemoveEdge(dependentsIt->second, handle);
+			if (dependentsIt->second.empty())
+				m_Dependents.erase(dependentsIt);
+		}
+
+		m_Dependencies.erase(it);
+	}
+
+	void AssetDependencyGraph::Clear()
+	{
+		m_Dependencies.clear();
+		m_Dependents.clear();
+	}
+
+	const std::vector<AssetHandle>& AssetDependencyGraph::GetDependencies(AssetHandle handle) const
+	{
+		static const std::vector<AssetHandle> none;
+		auto it = m_Dependencies.find(handle);
+		return it != m_Dependencies.end() ? it->second : none;
+	}
+
+	const std::vector<AssetHandle>& AssetDependencyGraph::GetDependents(AssetHandle handle) const
+	{
+		static const std::vector<AssetHandle> none;
+		auto it = m_Dependents.find(handle);
+		return it != m_Dependents.end() ? it->second : none;
+	}
+
+	void AssetDependencyGraph::CollectDependents(AssetHandle handle, std::vector<AssetHandle>& outDependents,
+		const std::function<bool(AssetHandle)>& follow) const
+	{
+		// Depth first over the reverse edges, emitting each asset once everything depending on
+		// it has been emitted; reversed at the end, that puts dependencies first
+		struct Frame
+		{
+			AssetHandle Handle;
+			size_t NextEdge;
+		};
+
+		size_t first = outDependents.size();
+		std::unordered_set<AssetHandle> visited{ handle };
+		std::vector<Frame> stack{ { handle, 0 } };
+		while (!stack.empty())
+		{
+			Frame& frame = stack.back();
+			const std::vector<AssetHandle>& dependents = GetDependents(frame.Handle);
+			if (frame.NextEdge == dependents.size())
+			{
+				if (frame.Handle != handle)
+					outDependents.push_back(frame.Handle);
+				stack.pop_back();
+				continue;
+			}
+
+			AssetHandle dependent = dependents[frame.NextEdge++];
+			if (!visited.insert(dependent).second || !follow(dependent))
+				continue;
+
+			stack.push_back({ dependent, 0 });
+		}
+
+		std::reverse(outDependents.begin() + first, outDependents.end());
+	}
+
+	void AssetDependencyGraph::AddEdge(std::vector<AssetHandle>& edges, AssetHandle handle)
+	{
+		if (std::find(edges.begin(), edges.end(), handle) == edges.end())
+			edges.push_back(handle);
+	}
+
+	void AssetDependencyGraph::RemoveEdge(std::vector<AssetHandle>& edges, AssetHandle handle)
+	{
+		auto it = std::find(edges.begin(), edges.end(), handle);
+		if (it != edges.end())
+		{
+			*it = edges.back();
+			edges.pop_back();
+		}
+	}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Asset.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	// Directed graph of asset references: an edge from each asset to every asset it
+	// references, with the reverse edges kept alongside so dependents are found without
+	// a scan. Edges are learned as assets load, so the graph only knows assets that have
+	// been loaded at least once. Main thread only.
+	class AssetDependencyGraph
+	{
+	public:
+		// Replaces every outgoing edge of handle
+		void SetDependencies(AssetHandle handle, const std::vector<AssetHandle>& dependencies);
+		// Drops the outgoing edges of handle; assets referencing it keep their edges
+		void RemoveAsset(AssetHandle handle);
+		void Clear();
+
+		const std::vector<AssetHandle>& GetDependencies(AssetHandle handle) const;
+		const std::vector<AssetHandle>& GetDependents(AssetHandle handle) const;
+
+		// Appends every asset reachable from handle through reverse edges, each dependency
+		// before its dependents. Dependents follow rejects are skipped and not walked through.
+		void CollectDependents(AssetHandle handle, std::vector<AssetHandle>& outDependents,
+			const std::function<bool(AssetHandle)>& follow) const;
+	private:
+		static void AddEdge(std::vector<AssetHandle>& edges, AssetHandle handle);
+		static void RemoveEdge(std::vector<AssetHandle>& edges, AssetHandle handle);
+	private:
+		std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_Dependencies;
+		std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_Dependents;
+	};
+
+}
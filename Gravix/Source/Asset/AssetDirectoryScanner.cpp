@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "AssetDirectoryScanner.h"
+
+#include "AssetImporter.h"
+#include "Core/Application.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Enough subtrees that one large folder does not leave the other workers idle
+		constexpr uint32_t SubtreesPerThread = 4;
+		// Levels listed on the calling thread looking for that many subtrees
+		constexpr uint32_t MaxSplitDepth = 3;
+
+		struct Subtree
+		{
+			std::filesystem::path Directory;
+			std::vector<AssetDirectoryScanner::Entry> Entries;
+			uint32_t SkippedCount = 0;
+		};
+
+		// Sorts one directory entry into files (classified into subtree) and subdirectories (appended to outDirectories)
+		void VisitEntry(const std::filesystem::directory_entry& entry, const std::filesystem::path& root,
+			Subtree& subtree, std::vector<std::filesystem::path>* outDirectories)
+		{
+			std::error_code error;
+			if (outDirectories && entry.is_directory(error))
+			{
+				outDirectories->push_back(entry.path());
+				return;
+			}
+
+			if (!entry.is_regular_file(error))
+				return;
+
+			AssetType type = AssetImporter::GetAssetTypeFromExtension(entry.path());
+			if (type == AssetType::None)
+			{
+				subtree.SkippedCount++;
+				return;
+			}
+
+			// lexically_relative, unlike std::filesystem::relative, never touches the disk
+			auto writeTime = entry.last_write_time(error);
+			subtree.Entries.push_back({ entry.path().lexically_relative(root).lexically_normal(), type,
+				error ? 0 : static_cast<uint64_t>(writeTime.time_since_epoch().count()) });
+		}
+
+		struct ScanTask : enki::ITaskSet
+		{
+			std::filesystem::path Root;
+			std::vector<Subtree>* Subtrees = nullptr;
+
+			void ExecuteRange(enki::TaskSetPartition range, uint32_t threadNum) override
+			{
+				for (uint32_t i = range.start; i < range.end; i++)
+				{
+					Subtree& subtree = (*Subtrees)[i];
+
+					std::error_code error;
+					std::filesystem::recursive_directory_iterator it(subtree.Directory,
+						std::filesystem::directory_options::skip_permission_denied, error);
+					for (; !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+						VisitEntry(*it, Root, subtree, nullptr);
+
+					if (error)
+						GX_CORE_ERROR("Failed to scan {0}: {1}", subtree.Directory.string(), error.message());
+				}
+			}
+		};
+	}
+
+	std::vector<AssetDirectoryScanner::Entry> AssetDirectoryScanner::Scan(const std::filesystem::path& directory, uint32_t* outSkippedCount)
+	{
+		GX_PROFILE_FUNCTION();
+
+		enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+		uint32_t wantedSubtrees = scheduler.GetNumTaskThreads() * SubtreesPerThread;
+
+		// The top levels are listed here, one directory at a time, until they fan out into enough subtrees
+		Subtree shallow;
+		std::vector<std::filesystem::path> level = { directory };
+		for (uint32_t depth = 0; depth < MaxSplitDepth && !level.empty() && level.size() < wantedSubtrees; depth++)
+		{
+			std::vector<std::filesystem::path> nextLevel;
+			for (const std::filesystem::path& levelDirectory : level)
+			{
+				std::error_code error;
+				std::filesystem::directory_iterator it(levelDirectory, std::filesystem::directory_options::skip_permission_denied, error);
+				for (; !error && it != std::filesystem::directory_iterator(); it.increment(error))
+					VisitEntry(*it, directory, shallow, &nextLevel);
+
+				if (error)
+					GX_CORE_ERROR("Failed to scan {0}: {1}", levelDirectory.string(), error.message());
+			}
+			level = std::move(nextLevel);
+		}
+
+		std::vector<Subtree> subtrees(level.size());
+		for (size_t i = 0; i < level.size(); i++)
+			subtrees[i].Directory = std::move(level[i]);
+
+		if (!subtrees.empty())
+		{
+			ScanTask task;
+			task.Root = directory;
+			task.Subtrees = &subtrees;
+			task.m_SetSize = static_cast<uint32_t>(subtrees.size());
+			task.m_MinRange = 1;
+			scheduler.AddTaskSetToPipe(&task);
+			scheduler.WaitforTask(&task);
+		}
+
+		size_t entryCount = shallow.Entries.size();
+		uint32_t skippedCount = shallow.SkippedCount;
+		for (const Subtree& subtree : subtrees)
+		{
+			entryCount += subtree.Entries.size();
+			skippedCount += subtree.SkippedCount;
+		}
+
+		std::vector<Entry> entries = std::move(shallow.Entries);
+		entries.reserve(entryCount);
+		for (Subtree& subtree : subtrees)
+			entries.insert(entries.end(), std::make_move_iterator(subtree.Entries.begin()), std::make_move_iterator(subtree.Entries.end()));
+
+		if (outSkippedCount)
+			*outSkippedCount = skippedCount;
+		return entries;
+	}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Asset.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Gravix
+{
+
+	// Lists every importable file under a directory. The top of the tree is split into
+	// subtrees that the workers walk side by side, and each file is classified and stat'ed
+	// there, so the main thread only sees the finished list.
+	class AssetDirectoryScanner
+	{
+	public:
+		struct Entry
+		{
+			std::filesystem::path FilePath; // Relative to the scanned directory, lexically normal
+			AssetType Type;
+			uint64_t LastModifiedTime;
+		};
+
+		// Blocks, helping the scheduler, until the whole tree is listed. Files no importer
+		// handles are left out and only counted.
+		static std::vector<Entry> Scan(const std::filesystem::path& directory, uint32_t* outSkippedCount = nullptr);
+	};
+
+}
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "AssetFuture.h"
+
+#include "AssetManagerBase.h"
+#include "Core/Application.h"
+#include "Core/Scheduler.h"
+#include "Project/Project.h"
+
+#include <thread>
+
+namespace Gravix
+{
+
+	void AssetLoadState::AddContinuation(Continuation continuation, ContinuationThread thread)
+	{
+		if (IsReady())
+		{
+			RunContinuation(continuation, thread, m_Asset);
+			return;
+		}
+
+		m_Continuations.emplace_back(std::move(continuation), thread);
+	}
+
+	void AssetLoadState::Resolve(Ref<Asset> asset)
+	{
+		if (IsReady())
+			return;
+
+		m_Asset = std::move(asset);
+		m_Ready.store(true, std::memory_order_release);
+
+		// Taken first: a continuation may add another one to this state, which then runs at once
+		std::vector<std::pair<Continuation, ContinuationThread>> continuations = std::move(m_Continuations);
+		m_Continuations.clear();
+		for (const auto& [continuation, thread] : continuations)
+			RunContinuation(continuation, thread, m_Asset);
+	}
+
+	void AssetLoadState::RunContinuation(const Continuation& continuation, ContinuationThread thread, const Ref<Asset>& asset)
+	{
+		if (thread == ContinuationThread::Main)
+		{
+			continuation(asset);
+			return;
+		}
+
+		Application::Get().GetScheduler().Dispatch([continuation, asset]() { continuation(asset); });
+	}
+
+	void AssetLoadState::Wait()
+	{
+		if (IsReady())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+		// Thread 0 is the one that called Initialize, the main thread
+		bool isMainThread = scheduler.GetThreadNum() == 0;
+
+		while (!IsReady())
+		{
+			// Loads are only published on the main thread, so waiting there has to publish them too
+			if (isMainThread)
+			{
+				Ref<Project> project = Project::GetActive();
+				if (!project || !project->GetAssetManager())
+				{
+					GX_CORE_ERROR("Waiting on an asset load with no asset manager to finish it");
+					return;
+				}
+				project->GetAssetManager()->ProcessCompletedLoads();
+				if (IsReady())
+					break;
+			}
+
+			// Null runs one pending task, if any, on this thread and returns
+			scheduler.WaitforTask(nullptr);
+			std::this_thread::yield();
+		}
+	}
+
+	AssetFutureGroup::AssetFutureGroup(const std::vector<Ref<AssetLoadState>>& states)
+		: m_State(CreateRef<AssetLoadState>())
+	{
+		struct Counter : RefCounted
+		{
+			size_t Remaining = 0;
+		};
+
+		Ref<Counter> counter = CreateRef<Counter>();
+		for (const Ref<AssetLoadState>& state : states)
+		{
+			if (state)
+				counter->Remaining++;
+		}
+
+		if (counter->Remaining == 0)
+		{
+			m_State->Resolve(nullptr);
+			return;
+		}
+
+		for (const Ref<AssetLoadState>& state : states)
+		{
+			if (!state)
+				continue;
+
+			state->AddContinuation([group = m_State, counter](const Ref<Asset>&)
+				{
+					if (--counter->Remaining == 0)
+						group->Resolve(nullptr);
+				}, ContinuationThread::Main);
+		}
+	}
+
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Asset.h"
+#include "Core/Core.h"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace Gravix
+{
+
+	enum class ContinuationThread
+	{
+		Main,   // Runs inside ProcessAsyncLoads, where assets are published
+		Worker  // Dispatched to the task scheduler
+	};
+
+	// Outcome of one load, shared by every future waiting on it. Resolved exactly once, on the
+	// main thread, with the asset or with nullptr when the load failed or was cancelled.
+	class AssetLoadState : public RefCounted
+	{
+	public:
+		using Continuation = std::function<void(const Ref<Asset>&)>;
+
+		bool IsReady() const { return m_Ready.load(std::memory_order_acquire); }
+		// nullptr until ready
+		Ref<Asset> GetAsset() const { return IsReady() ? m_Asset : nullptr; }
+
+		// Main thread only. Runs at once, or is dispatched, if the state is already resolved.
+		void AddContinuation(Continuation continuation, ContinuationThread thread);
+		// Main thread only
+		void Resolve(Ref<Asset> asset);
+
+		// Blocks until resolved. The waiting thread runs other tasks meanwhile, and on the main
+		// thread also finishes completed loads, so an importer can wait on its dependencies.
+		// A worker must not wait on a load the main thread is itself blocked on.
+		void Wait();
+	private:
+		static void RunContinuation(const Continuation& continuation, ContinuationThread thread, const Ref<Asset>& asset);
+	private:
+		Ref<Asset> m_Asset;
+		std::atomic<bool> m_Ready = false;
+		std::vector<std::pair<Continuation, ContinuationThread>> m_Continuations;
+	};
+
+	template<typename TAsset>
+	requires std::is_base_of_v<Asset, TAsset>
+	class AssetFuture
+	{
+	public:
+		AssetFuture() = default;
+		explicit AssetFuture(Ref<AssetLoadState> state) : m_State(std::move(state)) {}
+
+		bool IsValid() const { return (bool)m_State; }
+		bool IsReady() const { return m_State && m_State->IsReady(); }
+
+		// nullptr until ready, and after if the load failed or the asset is not a TAsset
+		Ref<TAsset> Get() const { return m_State ? Cast<TAsset>(m_State->GetAsset()) : nullptr; }
+
+		Ref<TAsset> Wait() const
+		{
+			if (!m_State)
+				return nullptr;
+
+			m_State->Wait();
+			return Get();
+		}
+
+		// Main thread only
+		const AssetFuture& Then(std::function<void(Ref<TAsset>)> continuation, ContinuationThread thread = ContinuationThread::Main) const
+		{
+			if (m_State)
+			{
+				m_State->AddContinuation([continuation = std::move(continuation)](const Ref<Asset>& asset)
+					{
+						continuation(Cast<TAsset>(asset));
+					}, thread);
+			}
+			return *this;
+		}
+
+		const Ref<AssetLoadState>& GetState() const { return m_State; }
+	private:
+		Ref<AssetLoadState> m_State;
+	};
+
+	// Ready once every future it was made from is, whether their loads succeeded or not
+	class AssetFutureGroup
+	{
+	public:
+		// Main thread only
+		explicit AssetFutureGroup(const std::vector<Ref<AssetLoadState>>& states);
+
+		bool IsReady() const { return m_State->IsReady(); }
+		void Wait() const { m_State->Wait(); }
+
+		// Main thread only
+		const AssetFutureGroup& Then(std::function<void()> continuation, ContinuationThread thread = ContinuationThread::Main) const
+		{
+			m_State->AddContinuation([continuation = std::move(continuation)](const Ref<Asset>&) { continuation(); }, thread);
+			return *this;
+		}
+	private:
+		Ref<AssetLoadState> m_State;
+	};
+
+	template<typename TAsset>
+	AssetFutureGroup WhenAll(const std::vector<AssetFuture<TAsset>>& futures)
+	{
+		std::vector<Ref<AssetLoadState>> states;
+		states.reserve(futures.size());
+		for (const AssetFuture<TAsset>& future : futures)
+			states.push_back(future.GetState());
+		return AssetFutureGroup(states);
+	}
+
+	// For futures of different asset types
+	template<typename... TAssets>
+	AssetFutureGroup WhenAll(const AssetFuture<TAssets>&... futures)
+	{
+		return AssetFutureGroup({ futures.GetState()... });
+	}
+
+}
@@ -55,21 +55,19 @@ namespace Gravix
 	AssetHandle AssetImporter::GenerateAssetHandle(const std::filesystem::path& filePath, AssetMetadata* outMetadata)
 	{
 		outMetadata->FilePath = filePath;
-		std::string extension = filePath.extension().string();
-
-		if (s_ExtensionToAssetType.contains(extension))
-		{
-			outMetadata->Type = s_ExtensionToAssetType.at(extension);
-		}
-		else
-		{
-			outMetadata->Type = AssetType::None;
+		outMetadata->Type = GetAssetTypeFromExtension(filePath);
+		if (outMetadata->Type == AssetType::None)
 			GX_CORE_WARN("Unsupported asset type for file: {0}", filePath.string());
-		}
 
 		outMetadata->LastModifiedTime = std::filesystem::last_write_time(Project::GetAssetDirectory() / filePath).time_since_epoch().count();
 
 		return AssetHandle();
 	}
 
+	AssetType AssetImporter::GetAssetTypeFromExtension(const std::filesystem::path& filePath)
+	{
+		auto it = s_ExtensionToAssetType.find(filePath.extension().string());
+		return it != s_ExtensionToAssetType.end() ? it->second : AssetType::None;
+	}
+
 }
\ No newline at end of file
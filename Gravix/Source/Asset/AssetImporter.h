@@ -13,6 +13,8 @@ namespace Gravix
 	public:
 		static Ref<Asset> ImportAsset(AssetHandle handle, const AssetMetadata& metadata);
 		static AssetHandle GenerateAssetHandle(const std::filesystem::path& filePath, AssetMetadata* outMetadata);
+		// AssetType::None for files no importer handles. Safe from any thread.
+		static AssetType GetAssetTypeFromExtension(const std::filesystem::path& filePath);
 	};
 
 }
\ No newline at end of file
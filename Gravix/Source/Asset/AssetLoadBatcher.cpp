@@ -0,0 +1,137 @@
+#include "pch.h"
+#include "AssetLoadBatcher.h"
+
+#include "Core/Application.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Loads range from a few KB material to a large texture, so keep enough
+		// partitions per worker for stealing to even out the cost
+		constexpr uint32_t PartitionsPerThread = 8;
+
+		// A low priority set is only preempted between partitions, so huge batches are split
+		// up to keep partitions short and let high priority loads in during scene transitions
+		constexpr size_t MaxRequestsPerTaskSet = 512;
+
+		// Requests due within this window are treated as High whatever they asked for
+		constexpr std::chrono::milliseconds UrgentDeadlineWindow{ 50 };
+	}
+
+	AssetLoadBatcher::AssetLoadBatcher() = default;
+
+	AssetLoadBatcher::~AssetLoadBatcher()
+	{
+		// Workers still hold raw pointers to pooled tasks and to the completion queue
+		WaitForAll();
+	}
+
+	void AssetLoadBatcher::Flush()
+	{
+		GX_PROFILE_FUNCTION();
+
+		RecycleCompletedTasks();
+
+		if (m_PendingRequests.empty())
+			return;
+
+		LoadDeadline urgentBefore = std::chrono::steady_clock::now() + UrgentDeadlineWindow;
+		for (Ref<AsyncLoadRequest>& request : m_PendingRequests)
+		{
+			if (request->IsCancelled())
+			{
+				request->State = AssetState::Cancelled;
+				m_CompletionQueue.Push(std::move(request));
+				continue;
+			}
+
+			LoadPriority priority = request->Deadline <= urgentBefore ? LoadPriority::High : request->Priority;
+			m_PriorityBuckets[static_cast<size_t>(priority)].push_back(std::move(request));
+		}
+		m_PendingRequests.clear();
+
+		// enkiTS priorities count down from High, so this dispatches the most urgent sets first
+		for (size_t priority = 0; priority < m_PriorityBuckets.size(); priority++)
+		{
+			std::vector<Ref<AsyncLoadRequest>>& bucket = m_PriorityBuckets[priority];
+			if (bucket.empty())
+				continue;
+
+			std::stable_sort(bucket.begin(), bucket.end(), [](const Ref<AsyncLoadRequest>& a, const Ref<AsyncLoadRequest>& b)
+				{
+					return a->Deadline < b->Deadline;
+				});
+
+			Dispatch(bucket, static_cast<enki::TaskPriority>(priority));
+			bucket.clear();
+		}
+	}
+
+	void AssetLoadBatcher::Dispatch(std::vector<Ref<AsyncLoadRequest>>& requests, enki::TaskPriority priority)
+	{
+		enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+		uint32_t partitionCount = scheduler.GetNumTaskThreads() * PartitionsPerThread;
+
+		for (size_t first = 0; first < requests.size(); first += MaxRequestsPerTaskSet)
+		{
+			size_t last = std::min(first + MaxRequestsPerTaskSet, requests.size());
+
+			AsyncLoadTask* task = AcquireTask();
+			task->LoadRequests.assign(std::make_move_iterator(requests.begin() + first), std::make_move_iterator(requests.begin() + last));
+
+			uint32_t setSize = static_cast<uint32_t>(task->LoadRequests.size());
+			task->m_SetSize = setSize;
+			task->m_MinRange = std::max(1u, setSize / partitionCount);
+			task->m_Priority = priority;
+
+			scheduler.AddTaskSetToPipe(task);
+			m_InFlightTasks.push_back(task);
+		}
+	}
+
+	void AssetLoadBatcher::WaitForAll()
+	{
+		if (m_InFlightTasks.empty())
+			return;
+
+		enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+		for (AsyncLoadTask* task : m_InFlightTasks)
+			scheduler.WaitforTask(task);
+
+		RecycleCompletedTasks();
+	}
+
+	AsyncLoadTask* AssetLoadBatcher::AcquireTask()
+	{
+		if (!m_FreeTasks.empty())
+		{
+			AsyncLoadTask* task = m_FreeTasks.back();
+			m_FreeTasks.pop_back();
+			return task;
+		}
+
+		m_TaskPool.push_back(CreateScope<AsyncLoadTask>(&m_CompletionQueue));
+		return m_TaskPool.back().get();
+	}
+
+	void AssetLoadBatcher::RecycleCompletedTasks()
+	{
+		auto it = std::remove_if(m_InFlightTasks.begin(), m_InFlightTasks.end(), [this](AsyncLoadTask* task)
+			{
+				if (!task->GetIsComplete())
+					return false;
+
+				task->LoadRequests.clear();
+				m_FreeTasks.push_back(task);
+				return true;
+			});
+		m_InFlightTasks.erase(it, m_InFlightTasks.end());
+	}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Asset/AsyncLoadRequest.h"
+#include "Core/MPSCQueue.h"
+
+#include <array>
+#include <vector>
+
+namespace Gravix
+{
+
+	struct AsyncLoadTask;
+
+	// Collects the load requests issued during a frame and dispatches them on Flush as
+	// one task set per enkiTS priority, ordered by deadline. Task sets are pooled and
+	// reused once enkiTS is done with them; workers publish finished requests through
+	// a lock-free queue.
+	class AssetLoadBatcher
+	{
+	public:
+		AssetLoadBatcher();
+		~AssetLoadBatcher();
+
+		// Main thread only
+		void Enqueue(const Ref<AsyncLoadRequest>& request) { m_PendingRequests.push_back(request); }
+
+		// Dispatches everything queued since the last flush. Call once per frame.
+		// Requests cancelled before dispatch go straight to the completion queue.
+		void Flush();
+
+		// Blocks (helping the scheduler) until every dispatched batch has finished
+		void WaitForAll();
+
+		// Safe from any thread
+		void PushCompleted(Ref<AsyncLoadRequest> request) { m_CompletionQueue.Push(std::move(request)); }
+		// Consumer side, main thread only
+		bool PopCompleted(Ref<AsyncLoadRequest>& outRequest) { return m_CompletionQueue.TryPop(outRequest); }
+
+		size_t GetPendingCount() const { return m_PendingRequests.size(); }
+		size_t GetInFlightBatchCount() const { return m_InFlightTasks.size(); }
+	private:
+		AsyncLoadTask* AcquireTask();
+		void Dispatch(std::vector<Ref<AsyncLoadRequest>>& requests, enki::TaskPriority priority);
+		void RecycleCompletedTasks();
+	private:
+		std::vector<Ref<AsyncLoadRequest>> m_PendingRequests;
+		std::array<std::vector<Ref<AsyncLoadRequest>>, enki::TASK_PRIORITY_NUM> m_PriorityBuckets;
+
+		std::vector<Scope<AsyncLoadTask>> m_TaskPool;
+		std::vector<AsyncLoadTask*> m_FreeTasks;
+		std::vector<AsyncLoadTask*> m_InFlightTasks;
+
+		MPSCQueue<Ref<AsyncLoadRequest>> m_CompletionQueue;
+	};
+
+}
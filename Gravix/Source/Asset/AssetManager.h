@@ -15,10 +15,23 @@ namespace Gravix
 			return Cast<TAsset>(Project::GetActive()->GetAssetManager()->GetAsset(handle));
 		}
 
+		static void RequestLoad(AssetHandle handle, const AssetLoadOptions& options = {}) { Project::GetActive()->GetAssetManager()->RequestLoad(handle, options); }
+
+		// Main thread only; see AssetManagerBase::LoadAsync
+		template<typename TAsset>
+		requires std::is_base_of_v<Asset, TAsset>
+		static AssetFuture<TAsset> LoadAsync(AssetHandle handle, const AssetLoadOptions& options = {})
+		{
+			return AssetFuture<TAsset>(Project::GetActive()->GetAssetManager()->LoadAsync(handle, options).GetState());
+		}
+
 		static bool IsAssetLoaded(AssetHandle handle) { return Project::GetActive()->GetAssetManager()->IsAssetLoaded(handle); }
 		static bool IsValidAssetHandle(AssetHandle handle) { return Project::GetActive()->GetAssetManager()->IsAssetHandleValid(handle); }
 		static AssetType GetAssetType(AssetHandle handle) { return Project::GetActive()->GetAssetManager()->GetAssetType(handle); }
 
+		// Fetch once per frame and resolve cached slots through it, rather than calling GetAsset per draw
+		static AssetSlotTable& GetSlotTable() { return Project::GetActive()->GetAssetManager()->GetSlotTable(); }
+
 		static void PushToCompletionQueue(Ref<AsyncLoadRequest> request) { Project::GetActive()->GetAssetManager()->PushToCompletionQueue(request); }
 	};
 }
\ No newline at end of file
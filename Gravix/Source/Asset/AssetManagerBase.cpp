@@ -0,0 +1,61 @@
+#include "pch.h"
+#include "AssetManagerBase.h"
+
+namespace Gravix
+{
+
+	AssetFuture<Asset> AssetManagerBase::LoadAsync(AssetHandle handle, const AssetLoadOptions& options)
+	{
+		auto it = m_LoadStates.find(handle);
+		if (it != m_LoadStates.end())
+		{
+			// Joins the load in flight, raising its priority if this caller is in more of a hurry
+			RequestLoad(handle, options);
+			return AssetFuture<Asset>(it->second);
+		}
+
+		Ref<AssetLoadState> state = CreateRef<AssetLoadState>();
+		if (!IsAssetHandleValid(handle))
+		{
+			state->Resolve(nullptr);
+			return AssetFuture<Asset>(state);
+		}
+
+		RequestLoad(handle, options);
+
+		// Already resident, loaded synchronously, or refused because the token was cancelled
+		if (IsAssetLoaded(handle) || !IsAssetLoading(handle))
+		{
+			state->Resolve(IsAssetLoaded(handle) ? GetAsset(handle) : nullptr);
+			return AssetFuture<Asset>(state);
+		}
+
+		m_LoadStates.emplace(handle, state);
+		return AssetFuture<Asset>(state);
+	}
+
+	void AssetManagerBase::ResolveLoadStates()
+	{
+		if (m_LoadStates.empty())
+			return;
+
+		// Collected first, since continuations may start new loads
+		std::vector<std::pair<Ref<AssetLoadState>, Ref<Asset>>> resolved;
+		for (auto it = m_LoadStates.begin(); it != m_LoadStates.end();)
+		{
+			AssetHandle handle = it->first;
+			if (IsAssetLoading(handle) && !IsAssetLoaded(handle))
+			{
+				++it;
+				continue;
+			}
+
+			resolved.emplace_back(std::move(it->second), IsAssetLoaded(handle) ? GetAsset(handle) : nullptr);
+			it = m_LoadStates.erase(it);
+		}
+
+		for (auto& [state, asset] : resolved)
+			state->Resolve(std::move(asset));
+	}
+
+}
@@ -3,6 +3,9 @@
 #include "Core/RefCounted.h"
 #include "Asset.h"
 #include "AsyncLoadRequest.h"
+#include "AssetFuture.h"
+#include "AssetSlotTable.h"
+#include "AssetResidency.h"
 
 #include <unordered_map>
 #include <map>
@@ -15,14 +18,36 @@ namespace Gravix
 	class AssetManagerBase : public RefCounted
 	{
 	public:
+		AssetManagerBase() : m_SlotTable(this), m_Residency(&m_SlotTable) {}
 		virtual ~AssetManagerBase() = default;
 		virtual Ref<Asset> GetAsset(AssetHandle handle) = 0;
+		// Starts loading without waiting for the result; a no-op if it is loaded or already on its way
+		virtual void RequestLoad(AssetHandle handle, const AssetLoadOptions& options = {}) = 0;
+		// Main thread only. Starts the load like RequestLoad; the future resolves once the asset is
+		// published, or with nullptr when the load fails or is cancelled.
+		AssetFuture<Asset> LoadAsync(AssetHandle handle, const AssetLoadOptions& options = {});
 
 		virtual bool IsAssetHandleValid(AssetHandle handle) const = 0;
 		virtual bool IsAssetLoaded(AssetHandle handle) const = 0;
+		virtual bool IsAssetLoading(AssetHandle handle) const = 0;
 		virtual AssetType GetAssetType(AssetHandle handle) const = 0;
 
 		virtual void PushToCompletionQueue(Ref<AsyncLoadRequest> request) = 0;
 		virtual void ProcessAsyncLoads() = 0;
+		// Publishes the loads the workers have finished, without starting a new frame. ProcessAsyncLoads
+		// does this as well; a wait on the main thread calls it in a loop, possibly from inside itself.
+		virtual void ProcessCompletedLoads() = 0;
+
+		AssetSlotTable& GetSlotTable() { return m_SlotTable; }
+		AssetResidency& GetResidency() { return m_Residency; }
+	protected:
+		// Resolves the futures whose loads have ended
+		void ResolveLoadStates();
+	protected:
+		AssetSlotTable m_SlotTable;
+		AssetResidency m_Residency;
+
+		// Futures handed out for loads still in progress
+		std::unordered_map<AssetHandle, Ref<AssetLoadState>> m_LoadStates;
 	};
 }
\ No newline at end of file
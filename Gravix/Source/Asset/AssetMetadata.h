@@ -2,17 +2,60 @@
 
 #include "Asset.h"
 #include <filesystem>
+#include <string_view>
 
 namespace Gravix 
 {
 
+	/**
+	 * @brief Block compression a texture is cooked with
+	 */
+	enum class TextureCompression
+	{
+		Auto = 0,   ///< BC4 for grayscale, BC7 otherwise; small textures stay uncompressed
+		None,       ///< Uncompressed RGBA8
+		BC7,        ///< Color with alpha, 4:1
+		BC5,        ///< Two channel data such as normal maps, 4:1
+		BC4         ///< Grayscale, 8:1
+	};
+
+	/**
+	 * @brief Filter used to build a texture's mip chain
+	 */
+	enum class TextureMipFilter
+	{
+		Box = 0,    ///< 2x2 average; cheapest, slightly blurry
+		Kaiser      ///< Kaiser-windowed sinc over 6x6 texels; keeps detail in small mips
+	};
+
+	std::string_view TextureCompressionToString(TextureCompression compression);
+	TextureCompression StringToTextureCompression(std::string_view compression);
+
+	std::string_view TextureMipFilterToString(TextureMipFilter filter);
+	TextureMipFilter StringToTextureMipFilter(std::string_view filter);
+
+	struct TextureImportSettings
+	{
+		TextureCompression Compression = TextureCompression::Auto;
+		bool GenerateMipmaps = false;
+		TextureMipFilter MipFilter = TextureMipFilter::Kaiser;
+		bool SRGB = true;   // Color data; mips are filtered in linear light. Off for normal maps and masks.
+
+		bool operator==(const TextureImportSettings&) const = default;
+	};
+
 	struct AssetMetadata
 	{
 		AssetType Type = AssetType::None;
 		std::filesystem::path FilePath;
 		uint64_t LastModifiedTime = 0;
+		// Hash::ComputeFile64 of the file; tells an edit from a touch. 0 until the file is first read.
+		uint64_t ContentHash = 0;
+
+		// Only meaningful for AssetType::Texture2D
+		TextureImportSettings TextureSettings;
 
 		operator bool() const { return Type != AssetType::None; }
 	};
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,576 @@
+#include "pch.h"
+#include "PakBuilder.h"
+
+#include "PakCompression.h"
+
+#include "Core/Application.h"
+#include "Core/Hash.h"
+#include "Core/MappedFileCache.h"
+#include "Core/MemoryStream.h"
+#include "Core/Scheduler.h"
+#include "Project/Project.h"
+#include "Asset/RuntimeAssetManager.h"
+
+#include "Asset/Importers/TextureCache.h"
+#include "Asset/Importers/ShaderImporter.h"
+#include "Asset/Importers/PipelineImporter.h"
+#include "Asset/Importers/SceneImporter.h"
+
+#include "Serialization/BinarySerializer.h"
+#include "Serialization/Scene/SceneSerializer.h"
+#include "Utils/ShaderCompilerSystem.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace Gravix
+{
+
+	static bool CookTexture2D(const std::filesystem::path& path, const TextureImportSettings& settings, BinarySerializer& serializer)
+	{
+		// Stored in its final GPU format so the runtime only has to upload
+		CookedTexture2D cooked = TextureCache::Load(path, settings);
+		if (!cooked.Data)
+			return false;
+
+		serializer.Write(cooked.Width);
+		serializer.Write(cooked.Height);
+		serializer.Write(static_cast<uint32_t>(cooked.Format));
+		serializer.Write(cooked.MipLevels);
+		serializer.WriteBytes(cooked.Data.Data, GetTextureMipChainSize(cooked.Format, cooked.Width, cooked.Height, cooked.MipLevels));
+
+		cooked.Data.Release();
+		return true;
+	}
+
+	static bool CookShader(const std::filesystem::path& path, BinarySerializer& serializer)
+	{
+		ShaderType type = ShaderImporter::DetectShaderType(path);
+
+		std::vector<std::vector<uint32_t>> spirv;
+		ShaderReflection reflection;
+		if (!ShaderCompilerSystem::Get().CompileShader(path, &spirv, &reflection) || spirv.empty())
+		{
+			GX_CORE_ERROR("Failed to compile shader for asset pack: {}", path.string());
+			return false;
+		}
+
+		serializer.Write(static_cast<uint32_t>(type));
+		serializer.Write(static_cast<uint64_t>(spirv.size()));
+		for (const std::vector<uint32_t>& stage : spirv)
+		{
+			serializer.Write(static_cast<uint64_t>(stage.size()));
+			serializer.WriteBytes(stage.data(), stage.size() * sizeof(uint32_t));
+		}
+		serializer.Write(reflection);
+		return true;
+	}
+
+	static bool CookMaterial(const std::filesystem::path& path, BinarySerializer& serializer)
+	{
+		Ref<MappedFile> file = MappedFileCache::Open(path);
+		if (!file)
+		{
+			GX_CORE_ERROR("Failed to read material: {}", path.string());
+			return false;
+		}
+
+		MemoryInputStream stream(file->GetData(), file->GetSize());
+		YAML::Node data = YAML::Load(stream);
+		YAML::Node materialNode = data["Material"];
+		if (!materialNode || !materialNode["Shader"] || !materialNode["Pipeline"])
+		{
+			GX_CORE_ERROR("Material file missing Shader or Pipeline reference: {}", path.string());
+			return false;
+		}
+
+		serializer.Write(materialNode["Shader"].as<uint64_t>());
+		serializer.Write(materialNode["Pipeline"].as<uint64_t>());
+		return true;
+	}
+
+	PakBuilder::PakBuilder(uint32_t alignment, const PakCompressionSettings& compression)
+		: m_Alignment(alignment), m_Compression(compression)
+	{
+		// Chunk tables are read in place, so blobs need at least 8 byte alignment
+		GX_ASSERT(alignment >= 8 && (alignment & (alignment - 1)) == 0, "Pak alignment must be a power of two of at least 8");
+		GX_ASSERT(compression.ChunkSize > 0, "Pak chunk size must not be zero");
+	}
+
+	void PakBuilder::AddAssets(const std::map<AssetHandle, AssetMetadata>& registry)
+	{
+		GX_PROFILE_FUNCTION();
+
+		for (const auto& [handle, metadata] : registry)
+			AddAsset(handle, metadata);
+	}
+
+	bool PakBuilder::AddAsset(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		std::vector<uint8_t> data;
+		if (!CookAsset(handle, metadata, data))
+		{
+			m_Stats.SkippedCount++;
+			return false;
+		}
+
+		return AddBlob(handle, metadata.Type, std::move(data));
+	}
+
+	bool PakBuilder::AddBlob(AssetHandle handle, AssetType type, std::vector<uint8_t> data)
+	{
+		auto it = std::find_if(m_Blobs.begin(), m_Blobs.end(), [handle](const PendingBlob& blob) { return blob.Handle == handle; });
+		if (it != m_Blobs.end())
+		{
+			GX_CORE_ERROR("Asset {} was added to the pack twice", handle.ToString());
+			return false;
+		}
+
+		m_Blobs.push_back({ handle, type, std::move(data) });
+		return true;
+	}
+
+	bool PakBuilder::CookAsset(AssetHandle handle, const AssetMetadata& metadata, std::vector<uint8_t>& outData)
+	{
+		GX_PROFILE_FUNCTION();
+
+		std::filesystem::path fullPath = Project::GetAssetDirectory() / metadata.FilePath;
+		BinarySerializer serializer(PAK_ASSET_VERSION);
+
+		bool cooked = false;
+		switch (metadata.Type)
+		{
+		case AssetType::Texture2D:
+			cooked = CookTexture2D(fullPath, metadata.TextureSettings, serializer);
+			break;
+		case AssetType::Shader:
+			cooked = CookShader(fullPath, serializer);
+			break;
+		case AssetType::Pipeline:
+		{
+			Ref<Pipeline> pipeline = PipelineImporter::ImportPipeline(handle, metadata);
+			if (pipeline)
+			{
+				serializer.Write(pipeline->GetConfiguration());
+				cooked = true;
+			}
+			break;
+		}
+		case AssetType::Material:
+			cooked = CookMaterial(fullPath, serializer);
+			break;
+		case AssetType::Scene:
+		{
+			Ref<Scene> scene = Cast<Scene>(SceneImporter::ImportScene(handle, metadata));
+			if (scene)
+			{
+				SceneSerializer(scene).SerializeRuntime(serializer);
+				cooked = true;
+			}
+			break;
+		}
+		default:
+			GX_CORE_WARN("Asset type {} has no cooked format, skipping {}", AssetTypeToString(metadata.Type), metadata.FilePath.string());
+			return false;
+		}
+
+		if (!cooked)
+		{
+			GX_CORE_ERROR("Failed to cook asset {} ({})", metadata.FilePath.string(), handle.ToString());
+			return false;
+		}
+
+		outData = std::move(serializer.GetBuffer());
+		return true;
+	}
+
+	std::vector<uint8_t> PakBuilder::TrainDictionary() const
+	{
+		GX_PROFILE_FUNCTION();
+
+		if (m_Compression.Codec != CompressionFlags::LZ4 || m_Compression.DictionarySize == 0)
+			return {};
+
+		std::vector<const std::vector<uint8_t>*> samples;
+		for (const PendingBlob& blob : m_Blobs)
+		{
+			if (blob.Data.size() >= m_Compression.MinCompressSize && blob.Data.size() <= m_Compression.DictionaryEntryLimit)
+				samples.push_back(&blob.Data);
+		}
+
+		// A handful of entries cannot pay for the dictionary's own size
+		if (samples.size() < 8)
+			return {};
+
+		return PakCompression::TrainDictionary(samples, m_Compression.DictionarySize);
+	}
+
+	std::vector<PakBuilder::StoredBlob> PakBuilder::CompressBlobs(const std::vector<uint8_t>& dictionary) const
+	{
+		GX_PROFILE_FUNCTION();
+
+		std::vector<StoredBlob> stored(m_Blobs.size());
+		if (m_Compression.Codec != CompressionFlags::LZ4)
+			return stored;
+
+		const uint64_t chunkSize = m_Compression.ChunkSize;
+
+		struct ChunkJob
+		{
+			uint32_t Blob;
+			uint32_t Chunk;
+		};
+
+		// Compressed payload per blob and chunk; left empty when a chunk does not shrink
+		std::vector<std::vector<std::vector<uint8_t>>> chunkData(m_Blobs.size());
+		std::vector<ChunkJob> jobs;
+
+		for (uint32_t i = 0; i < m_Blobs.size(); i++)
+		{
+			uint64_t size = m_Blobs[i].Data.size();
+			if (size < m_Compression.MinCompressSize)
+				continue;
+
+			uint32_t chunkCount = static_cast<uint32_t>((size + chunkSize - 1) / chunkSize);
+			chunkData[i].resize(chunkCount);
+			for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+				jobs.push_back({ i, chunk });
+		}
+
+		auto usesDictionary = [&](const PendingBlob& blob)
+			{
+				return !dictionary.empty() && blob.Data.size() <= m_Compression.DictionaryEntryLimit;
+			};
+
+		// Chunks are independent, so one big texture spreads over every worker just like many small entries
+		enki::TaskSet compressTask(static_cast<uint32_t>(jobs.size()), [&](enki::TaskSetPartition range, uint32_t threadnum)
+			{
+				for (uint32_t i = range.start; i < range.end; i++)
+				{
+					const ChunkJob& job = jobs[i];
+					const PendingBlob& blob = m_Blobs[job.Blob];
+
+					uint64_t begin = job.Chunk * chunkSize;
+					size_t size = static_cast<size_t>(std::min(chunkSize, blob.Data.size() - begin));
+					bool dictionaryEntry = usesDictionary(blob);
+
+					std::vector<uint8_t>& out = chunkData[job.Blob][job.Chunk];
+					out.resize(PakCompression::CompressBound(size));
+					size_t compressedSize = PakCompression::Compress(blob.Data.data() + begin, size, out.data(), out.size(),
+						dictionaryEntry ? dictionary.data() : nullptr, dictionaryEntry ? dictionary.size() : 0);
+					out.resize(compressedSize);
+					out.shrink_to_fit();
+				}
+			});
+
+		if (!jobs.empty())
+		{
+			enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+			scheduler.AddTaskSetToPipe(&compressTask);
+			scheduler.WaitforTask(&compressTask);
+		}
+
+		for (uint32_t i = 0; i < m_Blobs.size(); i++)
+		{
+			const PendingBlob& blob = m_Blobs[i];
+			std::vector<std::vector<uint8_t>>& chunks = chunkData[i];
+
+			bool anyCompressed = std::any_of(chunks.begin(), chunks.end(), [](const std::vector<uint8_t>& chunk) { return !chunk.empty(); });
+			if (!anyCompressed)
+				continue;
+
+			PakChunkTable table = {};
+			table.UncompressedSize = blob.Data.size();
+			table.ChunkSize = m_Compression.ChunkSize;
+			table.ChunkCount = static_cast<uint32_t>(chunks.size());
+
+			std::vector<PakChunk> chunkEntries(chunks.size());
+			uint64_t headerSize = sizeof(PakChunkTable) + chunks.size() * sizeof(PakChunk);
+			uint64_t offset = headerSize;
+
+			for (uint32_t chunk = 0; chunk < chunks.size(); chunk++)
+			{
+				uint64_t begin = chunk * chunkSize;
+				bool storedRaw = chunks[chunk].empty();
+
+				const uint8_t* payload = storedRaw ? blob.Data.data() + begin : chunks[chunk].data();
+				uint64_t payloadSize = storedRaw ? std::min(chunkSize, blob.Data.size() - begin) : chunks[chunk].size();
+
+				PakChunk& entry = chunkEntries[chunk];
+				entry.Offset = offset;
+				entry.StoredSize = static_cast<uint32_t>(payloadSize);
+				entry.Flags = storedRaw ? PakChunkStored : 0;
+				entry.Checksum = Hash::Compute64(payload, payloadSize);
+
+				offset += payloadSize;
+			}
+
+			StoredBlob& out = stored[i];
+			out.Data.resize(offset);
+			std::memcpy(out.Data.data(), &table, sizeof(PakChunkTable));
+			std::memcpy(out.Data.data() + sizeof(PakChunkTable), chunkEntries.data(), chunkEntries.size() * sizeof(PakChunk));
+
+			for (uint32_t chunk = 0; chunk < chunks.size(); chunk++)
+			{
+				const PakChunk& entry = chunkEntries[chunk];
+				const uint8_t* payload = (entry.Flags & PakChunkStored) ? blob.Data.data() + chunk * chunkSize : chunks[chunk].data();
+				std::memcpy(out.Data.data() + entry.Offset, payload, entry.StoredSize);
+			}
+
+			out.Flags = PakEntryCompressed | (usesDictionary(blob) ? PakEntryDictionary : 0);
+			out.Checksum = Hash::Compute64(out.Data.data(), headerSize);
+		}
+
+		return stored;
+	}
+
+	bool PakBuilder::Write(const std::filesystem::path& outputPath)
+	{
+		GX_PROFILE_FUNCTION();
+
+		// Runtime lookups binary search the TOC, so entries go out sorted by handle
+		std::sort(m_Blobs.begin(), m_Blobs.end(), [](const PendingBlob& a, const PendingBlob& b)
+			{
+				return static_cast<uint64_t>(a.Handle) < static_cast<uint64_t>(b.Handle);
+			});
+
+		auto compressStart = std::chrono::steady_clock::now();
+		std::vector<uint8_t> dictionary = TrainDictionary();
+		std::vector<StoredBlob> stored = CompressBlobs(dictionary);
+		double compressSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - compressStart).count();
+
+		// Written next to the target and renamed at the end so a failed build never leaves a truncated pack
+		std::filesystem::path tempPath = outputPath;
+		tempPath += ".tmp";
+
+		std::ofstream file(tempPath, std::ios::binary | std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+		{
+			GX_CORE_ERROR("Failed to open asset pack for writing: {}", tempPath.string());
+			return false;
+		}
+
+		auto padTo = [&file](uint64_t alignment)
+			{
+				static const char zeros[4096] = {};
+				uint64_t position = static_cast<uint64_t>(file.tellp());
+				uint64_t padding = (alignment - position % alignment) % alignment;
+				while (padding > 0)
+				{
+					uint64_t chunk = std::min<uint64_t>(padding, sizeof(zeros));
+					file.write(zeros, static_cast<std::streamsize>(chunk));
+					padding -= chunk;
+				}
+			};
+
+		bool anyCompressed = std::any_of(stored.begin(), stored.end(), [](const StoredBlob& blob) { return blob.Flags & PakEntryCompressed; });
+
+		PakHeader header = {};
+		std::memcpy(header.Signature, PAK_SIGNATURE, sizeof(header.Signature));
+		header.Version = PAK_VERSION;
+		header.AssetCount = static_cast<uint32_t>(m_Blobs.size() + (dictionary.empty() ? 0 : 1));
+		header.Compression = anyCompressed ? m_Compression.Codec : CompressionFlags::None;
+		header.Alignment = m_Alignment;
+
+		// Placeholder, rewritten once the TOC location is known
+		file.write(reinterpret_cast<const char*>(&header), sizeof(PakHeader));
+
+		std::vector<PakTOCEntry> toc;
+		toc.reserve(header.AssetCount);
+
+		auto writeBlob = [&](uint64_t handle, AssetType type, const std::vector<uint8_t>& bytes, uint32_t flags, uint64_t checksum)
+			{
+				padTo(m_Alignment);
+
+				PakTOCEntry& entry = toc.emplace_back();
+				entry.Handle = handle;
+				entry.Offset = static_cast<uint64_t>(file.tellp());
+				entry.Size = bytes.size();
+				entry.Checksum = checksum;
+				entry.Type = type;
+				entry.Flags = flags;
+
+				file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			};
+
+		m_Stats.CompressedCount = 0;
+		m_Stats.UncompressedSize = 0;
+		m_Stats.StoredSize = 0;
+
+		// The null handle sorts first, which keeps the dictionary ahead of the entries that need it
+		if (!dictionary.empty())
+			writeBlob(PAK_DICTIONARY_HANDLE, AssetType::None, dictionary, 0, Hash::Compute64(dictionary.data(), dictionary.size()));
+
+		for (uint32_t i = 0; i < m_Blobs.size(); i++)
+		{
+			const PendingBlob& blob = m_Blobs[i];
+			const StoredBlob& storedBlob = stored[i];
+
+			if (storedBlob.Flags & PakEntryCompressed)
+			{
+				writeBlob(static_cast<uint64_t>(blob.Handle), blob.Type, storedBlob.Data, storedBlob.Flags, storedBlob.Checksum);
+				m_Stats.StoredSize += storedBlob.Data.size();
+				m_Stats.CompressedCount++;
+			}
+			else
+			{
+				writeBlob(static_cast<uint64_t>(blob.Handle), blob.Type, blob.Data, 0, Hash::Compute64(blob.Data.data(), blob.Data.size()));
+				m_Stats.StoredSize += blob.Data.size();
+			}
+
+			m_Stats.UncompressedSize += blob.Data.size();
+		}
+
+		padTo(alignof(PakTOCEntry));
+		header.TOCOffset = static_cast<uint64_t>(file.tellp());
+		header.TOCChecksum = Hash::Compute64(toc.data(), toc.size() * sizeof(PakTOCEntry));
+		file.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size() * sizeof(PakTOCEntry)));
+
+		m_Stats.FileSize = static_cast<uint64_t>(file.tellp());
+
+		file.seekp(0);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(PakHeader));
+		file.close();
+
+		if (!file)
+		{
+			GX_CORE_ERROR("Failed to write asset pack: {}", tempPath.string());
+			std::filesystem::remove(tempPath);
+			return false;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, outputPath, error);
+		if (error)
+		{
+			GX_CORE_ERROR("Failed to move asset pack into place: {} ({})", outputPath.string(), error.message());
+			std::filesystem::remove(tempPath);
+			return false;
+		}
+
+		m_Stats.AssetCount = static_cast<uint32_t>(m_Blobs.size());
+		m_Stats.DictionarySize = dictionary.size();
+		m_Stats.CompressSeconds = compressSeconds;
+
+		GX_CORE_INFO("Built asset pack {} ({} assets, {} compressed, {} skipped, {} -> {} bytes, {} byte dictionary)", outputPath.string(),
+			m_Stats.AssetCount, m_Stats.CompressedCount, m_Stats.SkippedCount, m_Stats.UncompressedSize, m_Stats.StoredSize, m_Stats.DictionarySize);
+		return true;
+	}
+
+	PakBenchmarkResult PakBuilder::Benchmark(const std::filesystem::path& scratchPath)
+	{
+		GX_PROFILE_FUNCTION();
+
+		constexpr double MiB = 1024.0 * 1024.0;
+
+		PakBenchmarkResult result;
+		PakBuildStats savedStats = m_Stats;
+		PakCompressionSettings savedCompression = m_Compression;
+
+		auto scratchFile = [&scratchPath](const char* suffix)
+			{
+				return scratchPath.parent_path() / (scratchPath.stem().string() + suffix);
+			};
+
+		std::filesystem::path rawPath = scratchFile("-raw.gpak");
+		std::filesystem::path compressedPath = scratchFile("-compressed.gpak");
+
+		// Best of a few passes, so the numbers reflect decode speed rather than first-touch page faults
+		auto timeReads = [this](const std::filesystem::path& path, bool tailOnly)
+			{
+				RuntimeAssetManager reader;
+				if (!reader.OpenPak(path))
+					return 0.0;
+
+				std::vector<uint8_t> buffer;
+				double best = 0.0;
+				for (int pass = 0; pass < 3; pass++)
+				{
+					uint64_t bytes = 0;
+					auto start = std::chrono::steady_clock::now();
+					for (const PendingBlob& blob : m_Blobs)
+					{
+						if (tailOnly)
+						{
+							// One chunk off the end of each multi-chunk entry, as a streaming mip read would do
+							uint64_t size = blob.Data.size();
+							if (size <= m_Compression.ChunkSize)
+								continue;
+
+							buffer.resize(m_Compression.ChunkSize);
+							reader.ReadAssetRange(blob.Handle, size - buffer.size(), buffer.size(), buffer.data());
+							bytes += buffer.size();
+						}
+						else
+						{
+							reader.ReadAsset(blob.Handle, buffer);
+							bytes += buffer.size();
+						}
+					}
+
+					double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+					if (seconds > 0.0)
+						best = std::max(best, bytes / MiB / seconds);
+				}
+
+				return best;
+			};
+
+		m_Compression.Codec = CompressionFlags::None;
+		if (Write(rawPath))
+		{
+			result.UncompressedSize = m_Stats.StoredSize;
+			result.UncompressedReadMBps = timeReads(rawPath, false);
+		}
+
+		m_Compression = savedCompression;
+		m_Compression.Codec = CompressionFlags::LZ4;
+		if (Write(compressedPath))
+		{
+			result.CompressedSize = m_Stats.StoredSize + m_Stats.DictionarySize;
+			if (m_Stats.CompressSeconds > 0.0)
+				result.CompressMBps = m_Stats.UncompressedSize / MiB / m_Stats.CompressSeconds;
+
+			result.CompressedReadMBps = timeReads(compressedPath, false);
+			result.PartialReadMBps = timeReads(compressedPath, true);
+		}
+
+		// Small entries on their own, to show what the dictionary is buying
+		std::vector<uint8_t> dictionary = TrainDictionary();
+		std::vector<uint8_t> scratch;
+		for (const PendingBlob& blob : m_Blobs)
+		{
+			if (blob.Data.size() > m_Compression.DictionaryEntryLimit)
+				continue;
+
+			scratch.resize(PakCompression::CompressBound(blob.Data.size()));
+			size_t plain = PakCompression::Compress(blob.Data.data(), blob.Data.size(), scratch.data(), scratch.size());
+			size_t withDictionary = dictionary.empty() ? 0 :
+				PakCompression::Compress(blob.Data.data(), blob.Data.size(), scratch.data(), scratch.size(), dictionary.data(), dictionary.size());
+
+			result.SmallEntrySize += blob.Data.size();
+			result.SmallEntryCompressedSize += plain ? plain : blob.Data.size();
+			result.SmallEntryDictionarySize += withDictionary ? withDictionary : blob.Data.size();
+		}
+		result.SmallEntryDictionarySize += dictionary.size();
+
+		std::filesystem::remove(rawPath);
+		std::filesystem::remove(compressedPath);
+
+		m_Compression = savedCompression;
+		m_Stats = savedStats;
+
+		double ratio = result.CompressedSize > 0 ? static_cast<double>(result.UncompressedSize) / result.CompressedSize : 0.0;
+		GX_CORE_INFO("Pak benchmark: {} -> {} bytes ({:.2f}x), compress {:.1f} MB/s", result.UncompressedSize, result.CompressedSize, ratio, result.CompressMBps);
+		GX_CORE_INFO("Pak benchmark: read {:.1f} MB/s uncompressed, {:.1f} MB/s compressed, {:.1f} MB/s single-chunk reads",
+			result.UncompressedReadMBps, result.CompressedReadMBps, result.PartialReadMBps);
+		GX_CORE_INFO("Pak benchmark: small entries {} bytes -> {} plain, {} with dictionary (dictionary included)",
+			result.SmallEntrySize, result.SmallEntryCompressedSize, result.SmallEntryDictionarySize);
+
+		return result;
+	}
+
+}
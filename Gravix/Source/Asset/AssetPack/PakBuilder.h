@@ -1,29 +1,108 @@
 #pragma once
 
+#ifdef GRAVIX_EDITOR_BUILD
+
+#include "PakFormat.h"
+#include "Asset/AssetMetadata.h"
+
 #include <filesystem>
+#include <map>
+#include <vector>
 
-namespace Gravix 
+namespace Gravix
 {
 
-	enum CompressionFlags 
+	struct PakCompressionSettings
 	{
-		Zstd, 
-		Brotli
+		CompressionFlags Codec = CompressionFlags::LZ4;
+		uint32_t ChunkSize = PAK_DEFAULT_CHUNK_SIZE;
+
+		// Entries below this are not worth a chunk table
+		uint32_t MinCompressSize = 256;
+
+		// Shared dictionary trained on the small entries; 0 disables it
+		uint32_t DictionarySize = 32 * 1024;
+		uint32_t DictionaryEntryLimit = 16 * 1024;
 	};
 
-	struct PakHeader 
+	struct PakBuildStats
 	{
-		char     Signature[4]; // "GPAK"
-		uint32_t Version;
-		uint32_t AssetCount;
-		uint64_t TOCOffset;
-		CompressionFlags Compression;
+		uint32_t AssetCount = 0;
+		uint32_t SkippedCount = 0;
+		uint32_t CompressedCount = 0;
+
+		uint64_t UncompressedSize = 0;
+		uint64_t StoredSize = 0;
+		uint64_t DictionarySize = 0;
+		uint64_t FileSize = 0;
+
+		double CompressSeconds = 0.0;
 	};
 
+	// Pack sizes and read throughput through RuntimeAssetManager, compressed vs stored raw
+	struct PakBenchmarkResult
+	{
+		uint64_t UncompressedSize = 0;
+		uint64_t CompressedSize = 0;
+
+		// Entries at or below DictionaryEntryLimit, with and without the shared dictionary
+		uint64_t SmallEntrySize = 0;
+		uint64_t SmallEntryCompressedSize = 0;
+		uint64_t SmallEntryDictionarySize = 0;
+
+		double CompressMBps = 0.0;
+		double UncompressedReadMBps = 0.0;
+		double CompressedReadMBps = 0.0;
+		double PartialReadMBps = 0.0;
+	};
 
-	class PakBuilder 
+	// Cooks editor assets into a single GPAK archive for RuntimeAssetManager
+	class PakBuilder
 	{
+	public:
+		PakBuilder(uint32_t alignment = PAK_DEFAULT_ALIGNMENT, const PakCompressionSettings& compression = PakCompressionSettings());
 
+		// Cooks every asset in the registry. Types without a cooked format are skipped.
+		void AddAssets(const std::map<AssetHandle, AssetMetadata>& registry);
+		bool AddAsset(AssetHandle handle, const AssetMetadata& metadata);
+
+		// Adds an already cooked blob
+		bool AddBlob(AssetHandle handle, AssetType type, std::vector<uint8_t> data);
+
+		bool Write(const std::filesystem::path& outputPath);
+
+		const PakBuildStats& GetStats() const { return m_Stats; }
+
+		// Builds the added assets into scratch packs next to scratchPath and times reading them back
+		PakBenchmarkResult Benchmark(const std::filesystem::path& scratchPath);
+
+		// Serializes one asset into its PAK_ASSET_VERSION blob (see PakFormat.h)
+		static bool CookAsset(AssetHandle handle, const AssetMetadata& metadata, std::vector<uint8_t>& outData);
+	private:
+		struct PendingBlob
+		{
+			AssetHandle Handle;
+			AssetType Type;
+			std::vector<uint8_t> Data;
+		};
+
+		struct StoredBlob
+		{
+			std::vector<uint8_t> Data;
+			uint32_t Flags = 0;
+			uint64_t Checksum = 0;
+		};
+
+		std::vector<uint8_t> TrainDictionary() const;
+		std::vector<StoredBlob> CompressBlobs(const std::vector<uint8_t>& dictionary) const;
+	private:
+		std::vector<PendingBlob> m_Blobs;
+		uint32_t m_Alignment;
+		PakCompressionSettings m_Compression;
+
+		PakBuildStats m_Stats;
 	};
 
-}
\ No newline at end of file
+}
+
+#endif // GRAVIX_EDITOR_BUILD
@@ -0,0 +1,358 @@
+#include "pch.h"
+#include "PakCompression.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		constexpr size_t MinMatch = 4;
+		constexpr size_t LastLiterals = 5;     // The block always ends in at least this many literals
+		constexpr size_t MatchFindLimit = 12;  // The last match has to start this far from the end
+		constexpr size_t MaxOffset = 65535;
+
+		constexpr uint32_t HashLog = 16;
+		constexpr uint32_t EmptySlot = UINT32_MAX;
+
+		uint32_t Read32(const uint8_t* p)
+		{
+			uint32_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		uint64_t Read64(const uint8_t* p)
+		{
+			uint64_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		uint32_t HashSequence(uint32_t sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - HashLog);
+		}
+
+		uint8_t* WriteLength(uint8_t* op, size_t length)
+		{
+			while (length >= 255)
+			{
+				*op++ = 255;
+				length -= 255;
+			}
+			*op++ = static_cast<uint8_t>(length);
+			return op;
+		}
+
+		uint8_t* WriteSequence(uint8_t* op, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+		{
+			uint8_t* token = op++;
+
+			if (literalLength >= 15)
+			{
+				*token = 15 << 4;
+				op = WriteLength(op, literalLength - 15);
+			}
+			else
+			{
+				*token = static_cast<uint8_t>(literalLength << 4);
+			}
+
+			std::memcpy(op, literals, literalLength);
+			op += literalLength;
+
+			// Trailing literal run has no match part
+			if (matchLength == 0)
+				return op;
+
+			*op++ = static_cast<uint8_t>(offset & 0xFF);
+			*op++ = static_cast<uint8_t>(offset >> 8);
+
+			size_t encodedLength = matchLength - MinMatch;
+			if (encodedLength >= 15)
+			{
+				*token |= 15;
+				op = WriteLength(op, encodedLength - 15);
+			}
+			else
+			{
+				*token |= static_cast<uint8_t>(encodedLength);
+			}
+
+			return op;
+		}
+
+		// Compresses base[start, end); anything before start is history that matches may reference
+		size_t CompressRange(const uint8_t* base, size_t start, size_t end, uint8_t* dst)
+		{
+			std::vector<uint32_t> table(size_t(1) << HashLog, EmptySlot);
+
+			for (size_t p = 0; p + MinMatch <= start; p++)
+				table[HashSequence(Read32(base + p))] = static_cast<uint32_t>(p);
+
+			const uint8_t* ip = base + start;
+			const uint8_t* anchor = ip;
+			const uint8_t* iend = base + end;
+			uint8_t* op = dst;
+
+			if (end - start > MatchFindLimit)
+			{
+				const uint8_t* matchFindLimit = iend - MatchFindLimit;
+				const uint8_t* matchLimit = iend - LastLiterals;
+				uint32_t misses = 0;
+
+				while (ip <= matchFindLimit)
+				{
+					uint32_t hash = HashSequence(Read32(ip));
+					uint32_t candidate = table[hash];
+					size_t position = static_cast<size_t>(ip - base);
+					table[hash] = static_cast<uint32_t>(position);
+
+					if (candidate == EmptySlot || position - candidate > MaxOffset || Read32(base + candidate) != Read32(ip))
+					{
+						// Skip faster through data that does not compress
+						ip += 1 + (misses++ >> 6);
+						continue;
+					}
+					misses = 0;
+
+					const uint8_t* match = base + candidate;
+					while (ip > anchor && match > base && ip[-1] == match[-1])
+					{
+						ip--;
+						match--;
+					}
+
+					const uint8_t* matchEnd = ip + MinMatch;
+					const uint8_t* reference = match + MinMatch;
+					while (matchEnd < matchLimit && *matchEnd == *reference)
+					{
+						matchEnd++;
+						reference++;
+					}
+
+					op = WriteSequence(op, anchor, static_cast<size_t>(ip - anchor), static_cast<size_t>(ip - match), static_cast<size_t>(matchEnd - ip));
+
+					ip = matchEnd;
+					anchor = ip;
+
+					const uint8_t* previous = ip - 2;
+					table[HashSequence(Read32(previous))] = static_cast<uint32_t>(previous - base);
+				}
+			}
+
+			op = WriteSequence(op, anchor, static_cast<size_t>(iend - anchor), 0, 0);
+			return static_cast<size_t>(op - dst);
+		}
+
+		bool ReadLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+		{
+			uint8_t byte;
+			do
+			{
+				if (ip >= iend)
+					return false;
+				byte = *ip++;
+				length += byte;
+			} while (byte == 255);
+			return true;
+		}
+	}
+
+	size_t PakCompression::CompressBound(size_t srcSize)
+	{
+		return srcSize + srcSize / 255 + 16;
+	}
+
+	size_t PakCompression::Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity,
+		const uint8_t* dictionary, size_t dictionarySize)
+	{
+		if (srcSize == 0 || dstCapacity < CompressBound(srcSize))
+			return 0;
+
+		size_t compressedSize;
+		if (dictionary != nullptr && dictionarySize > 0)
+		{
+			// Matches into the dictionary are ordinary back references once it sits in front of the input
+			size_t historySize = std::min(dictionarySize, MaxDictionarySize);
+			std::vector<uint8_t> window(historySize + srcSize);
+			std::memcpy(window.data(), dictionary + dictionarySize - historySize, historySize);
+			std::memcpy(window.data() + historySize, src, srcSize);
+
+			compressedSize = CompressRange(window.data(), historySize, window.size(), dst);
+		}
+		else
+		{
+			compressedSize = CompressRange(src, 0, srcSize, dst);
+		}
+
+		return compressedSize < srcSize ? compressedSize : 0;
+	}
+
+	bool PakCompression::Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize,
+		const uint8_t* dictionary, size_t dictionarySize)
+	{
+		const uint8_t* ip = src;
+		const uint8_t* iend = src + srcSize;
+		uint8_t* op = dst;
+		uint8_t* oend = dst + dstSize;
+
+		while (ip < iend)
+		{
+			uint8_t token = *ip++;
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(ip, iend, literalLength))
+				return false;
+
+			if (literalLength > static_cast<size_t>(iend - ip) || literalLength > static_cast<size_t>(oend - op))
+				return false;
+
+			std::memcpy(op, ip, literalLength);
+			ip += literalLength;
+			op += literalLength;
+
+			if (ip == iend)
+				break;
+
+			if (iend - ip < 2)
+				return false;
+
+			size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+			ip += 2;
+			if (offset == 0)
+				return false;
+
+			size_t matchLength = token & 15;
+			if (matchLength == 15 && !ReadLength(ip, iend, matchLength))
+				return false;
+			matchLength += MinMatch;
+
+			if (matchLength > static_cast<size_t>(oend - op))
+				return false;
+
+			size_t produced = static_cast<size_t>(op - dst);
+			if (offset > produced)
+			{
+				// Reference starts inside the dictionary and may run on into the output
+				size_t back = offset - produced;
+				if (dictionary == nullptr || back > dictionarySize)
+					return false;
+
+				size_t fromDictionary = std::min(back, matchLength);
+				std::memcpy(op, dictionary + dictionarySize - back, fromDictionary);
+				op += fromDictionary;
+				matchLength -= fromDictionary;
+
+				const uint8_t* reference = dst;
+				while (matchLength-- > 0)
+					*op++ = *reference++;
+			}
+			else
+			{
+				const uint8_t* reference = op - offset;
+				if (offset >= matchLength)
+				{
+					std::memcpy(op, reference, matchLength);
+					op += matchLength;
+				}
+				else
+				{
+					// Overlapping copy repeats the last offset bytes
+					while (matchLength-- > 0)
+						*op++ = *reference++;
+				}
+			}
+		}
+
+		return op == oend;
+	}
+
+	std::vector<uint8_t> PakCompression::TrainDictionary(const std::vector<const std::vector<uint8_t>*>& samples, size_t maxSize)
+	{
+		constexpr size_t KeySize = 8;       // Run length used to decide what "shared" means
+		constexpr size_t SegmentSize = 64;  // Unit that is copied into the dictionary
+
+		maxSize = std::min(maxSize, MaxDictionarySize);
+		if (samples.size() < 2 || maxSize < SegmentSize)
+			return {};
+
+		// Count each run once per sample, so content shared across entries beats repetition within one
+		std::unordered_map<uint64_t, uint32_t> frequency;
+		for (const std::vector<uint8_t>* sample : samples)
+		{
+			std::unordered_set<uint64_t> seen;
+			for (size_t p = 0; p + KeySize <= sample->size(); p++)
+			{
+				uint64_t key = Read64(sample->data() + p);
+				if (seen.insert(key).second)
+					frequency[key]++;
+			}
+		}
+
+		auto scoreSegment = [&frequency](const uint8_t* data, size_t size)
+			{
+				uint64_t score = 0;
+				for (size_t p = 0; p + KeySize <= size; p++)
+				{
+					auto it = frequency.find(Read64(data + p));
+					if (it != frequency.end() && it->second > 1)
+						score += it->second - 1;
+				}
+				return score;
+			};
+
+		struct Segment
+		{
+			const uint8_t* Data;
+			size_t Size;
+			uint64_t Score;
+		};
+
+		std::vector<Segment> segments;
+		for (const std::vector<uint8_t>* sample : samples)
+		{
+			for (size_t start = 0; start + KeySize <= sample->size(); start += SegmentSize)
+			{
+				size_t size = std::min(SegmentSize, sample->size() - start);
+				uint64_t score = scoreSegment(sample->data() + start, size);
+				if (score > 0)
+					segments.push_back({ sample->data() + start, size, score });
+			}
+		}
+
+		std::sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) { return a.Score > b.Score; });
+
+		std::vector<const Segment*> selected;
+		size_t totalSize = 0;
+		for (const Segment& segment : segments)
+		{
+			if (totalSize + segment.Size > maxSize)
+				continue;
+
+			// Content already covered by an earlier pick is worth nothing the second time
+			if (scoreSegment(segment.Data, segment.Size) * 2 < segment.Score)
+				continue;
+
+			for (size_t p = 0; p + KeySize <= segment.Size; p++)
+				frequency.erase(Read64(segment.Data + p));
+
+			selected.push_back(&segment);
+			totalSize += segment.Size;
+			if (maxSize - totalSize < KeySize)
+				break;
+		}
+
+		std::vector<uint8_t> dictionary;
+		dictionary.reserve(totalSize);
+		for (auto it = selected.rbegin(); it != selected.rend(); ++it)
+			dictionary.insert(dictionary.end(), (*it)->Data, (*it)->Data + (*it)->Size);
+
+		return dictionary;
+	}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace Gravix
+{
+
+	// LZ4 block codec used for pak chunks. An optional dictionary acts as
+	// history in front of the input, which is what makes tiny entries compress.
+	class PakCompression
+	{
+	public:
+		// Worst case output size for a srcSize input
+		static size_t CompressBound(size_t srcSize);
+
+		// Returns the compressed size, or 0 if the output would not be smaller than the input
+		static size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity,
+			const uint8_t* dictionary = nullptr, size_t dictionarySize = 0);
+
+		// dstSize must be the exact uncompressed size. Fails on malformed input instead of overrunning.
+		static bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize,
+			const uint8_t* dictionary = nullptr, size_t dictionarySize = 0);
+
+		// Picks the byte runs shared by most samples, most valuable last so they get the shortest offsets
+		static std::vector<uint8_t> TrainDictionary(const std::vector<const std::vector<uint8_t>*>& samples, size_t maxSize);
+
+		// Matches can reach at most this far back, so larger dictionaries would be dead weight
+		static constexpr size_t MaxDictionarySize = 65535;
+	};
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Asset/Asset.h"
+#include "Core/Core.h"
+
+#include <cstdint>
+
+namespace Gravix
+{
+
+	/*
+	 * GPAK archive layout
+	 *
+	 *   [PakHeader]
+	 *   [blob 0][pad][blob 1][pad] ...   each blob starts on a PakHeader::Alignment boundary
+	 *   [PakTOCEntry x AssetCount]       sorted by Handle, starts on an 8 byte boundary
+	 *
+	 * Every asset is a BinarySerializer buffer written with PAK_ASSET_VERSION:
+	 *   Texture2D: uint32 width, uint32 height, uint32 TextureFormat, uint32 mip count, then every
+ *              level in that format, largest first and tightly packed
+	 *   Shader:    uint32 ShaderType, uint64 stage count, per stage (uint64 word count, SPIR-V words), ShaderReflection
+	 *   Pipeline:  PipelineConfiguration fields in declaration order
+	 *   Material:  uint64 shader handle, uint64 pipeline handle
+	 *   Scene:     SceneSerializer::SerializeRuntime output
+	 *
+	 * Entries flagged PakEntryCompressed store that buffer as a PakChunkTable, its
+	 * PakChunk array and then the chunk payloads. Chunks cover ChunkSize bytes of the
+	 * uncompressed asset each and decompress independently, so they can be spread over
+	 * workers and a partial read only touches the chunks it overlaps. Entries flagged
+	 * PakEntryDictionary were compressed against the shared dictionary, stored as a
+	 * raw entry under the null handle.
+	 */
+
+	static constexpr char PAK_SIGNATURE[4] = { 'G', 'P', 'A', 'K' };
+	static constexpr uint32_t PAK_VERSION = 2;
+	static constexpr uint32_t PAK_ASSET_VERSION = 2;
+	static constexpr uint32_t PAK_DEFAULT_ALIGNMENT = 64;
+	static constexpr uint32_t PAK_DEFAULT_CHUNK_SIZE = 256 * 1024;
+	static constexpr uint64_t PAK_DICTIONARY_HANDLE = 0;
+
+	enum class CompressionFlags : uint32_t
+	{
+		None = 0,
+		Zstd = BIT(0),   // Reserved, no codec in this build
+		Brotli = BIT(1), // Reserved, no codec in this build
+		LZ4 = BIT(2)
+	};
+
+	enum PakEntryFlags : uint32_t
+	{
+		PakEntryCompressed = BIT(0),
+		PakEntryDictionary = BIT(1)
+	};
+
+	enum PakChunkFlags : uint32_t
+	{
+		PakChunkStored = BIT(0) // Did not compress, payload is the raw bytes
+	};
+
+	struct PakHeader
+	{
+		char     Signature[4]; // "GPAK"
+		uint32_t Version;
+		uint32_t AssetCount;
+		CompressionFlags Compression; // Codec of the entries flagged PakEntryCompressed
+		uint64_t TOCOffset;
+		uint64_t TOCChecksum;  // Hash::Compute64 over the whole TOC
+		uint32_t Alignment;    // Blob alignment the archive was built with
+		uint32_t Reserved;
+	};
+	static_assert(sizeof(PakHeader) == 40, "PakHeader layout is part of the file format");
+
+	struct PakTOCEntry
+	{
+		uint64_t Handle;
+		uint64_t Offset;       // Absolute file offset of the blob
+		uint64_t Size;         // Stored size of the blob in bytes
+		uint64_t Checksum;     // Hash::Compute64 of the stored bytes, or of the chunk table when compressed
+		AssetType Type;
+		uint32_t Flags;        // PakEntryFlags
+	};
+	static_assert(sizeof(PakTOCEntry) == 40, "PakTOCEntry layout is part of the file format");
+
+	struct PakChunkTable
+	{
+		uint64_t UncompressedSize;
+		uint32_t ChunkSize;
+		uint32_t ChunkCount;
+	};
+	static_assert(sizeof(PakChunkTable) == 16, "PakChunkTable layout is part of the file format");
+
+	struct PakChunk
+	{
+		uint64_t Offset;       // From the start of the blob
+		uint32_t StoredSize;
+		uint32_t Flags;        // PakChunkFlags
+		uint64_t Checksum;     // Hash::Compute64 of the stored payload
+	};
+	static_assert(sizeof(PakChunk) == 24, "PakChunk layout is part of the file format");
+
+}
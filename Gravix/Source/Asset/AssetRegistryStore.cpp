@@ -0,0 +1,490 @@
+#include "pch.h"
+#include "AssetRegistryStore.h"
+
+#include "Core/Application.h"
+#include "Core/Hash.h"
+#include "Core/MappedFile.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		constexpr char RegistrySignature[4] = { 'G', 'R', 'E', 'G' };
+		constexpr char JournalSignature[4] = { 'G', 'R', 'J', 'N' };
+
+		constexpr const char* RegistryFileName = "AssetRegistry.gxreg";
+		constexpr const char* JournalFileName = "AssetRegistry.gxjournal";
+
+		// The journal is compacted once it holds more records than the registry has entries,
+		// which keeps compaction O(1) per change amortized and replay no worse than 2x a load
+		constexpr uint64_t MinCompactionRecords = 1024;
+
+		// Version 1 layouts, read when opening a registry written before content hashes
+		struct AssetRegistryRecordV1
+		{
+			uint64_t Handle;
+			uint64_t LastModifiedTime;
+			uint32_t PathOffset;
+			uint32_t PathLength;
+			uint32_t Type;
+			uint8_t  Compression;
+			uint8_t  GenerateMipmaps;
+			uint8_t  MipFilter;
+			uint8_t  SRGB;
+		};
+		static_assert(sizeof(AssetRegistryRecordV1) == 32);
+
+		struct AssetJournalRecordV1
+		{
+			AssetJournalOp Op;
+			uint32_t Reserved;
+			AssetRegistryRecordV1 Entry;
+			uint64_t Checksum;
+		};
+		static_assert(sizeof(AssetJournalRecordV1) == 48);
+
+		bool IsReadableVersion(uint32_t version)
+		{
+			return version == 1 || version == AssetRegistryStore::RegistryVersion;
+		}
+
+		size_t GetRecordSize(uint32_t version)
+		{
+			return version == 1 ? sizeof(AssetRegistryRecordV1) : sizeof(AssetRegistryRecord);
+		}
+
+		size_t GetJournalRecordSize(uint32_t version)
+		{
+			return version == 1 ? sizeof(AssetJournalRecordV1) : sizeof(AssetJournalRecord);
+		}
+
+		AssetRegistryRecord ReadRecord(const uint8_t* data, uint32_t version)
+		{
+			AssetRegistryRecord record{};
+			if (version != 1)
+			{
+				std::memcpy(&record, data, sizeof(record));
+				return record;
+			}
+
+			AssetRegistryRecordV1 legacy;
+			std::memcpy(&legacy, data, sizeof(legacy));
+			record.Handle = legacy.Handle;
+			record.LastModifiedTime = legacy.LastModifiedTime;
+			record.PathOffset = legacy.PathOffset;
+			record.PathLength = legacy.PathLength;
+			record.Type = legacy.Type;
+			record.Compression = legacy.Compression;
+			record.GenerateMipmaps = legacy.GenerateMipmaps;
+			record.MipFilter = legacy.MipFilter;
+			record.SRGB = legacy.SRGB;
+			return record;
+		}
+
+		AssetRegistryRecord ToRecord(AssetHandle handle, const AssetMetadata& metadata, uint32_t pathOffset, uint32_t pathLength)
+		{
+			AssetRegistryRecord record{};
+			record.Handle = static_cast<uint64_t>(handle);
+			record.LastModifiedTime = metadata.LastModifiedTime;
+			record.PathOffset = pathOffset;
+			record.PathLength = pathLength;
+			record.Type = static_cast<uint32_t>(metadata.Type);
+			record.Compression = static_cast<uint8_t>(metadata.TextureSettings.Compression);
+			record.GenerateMipmaps = metadata.TextureSettings.GenerateMipmaps ? 1 : 0;
+			record.MipFilter = static_cast<uint8_t>(metadata.TextureSettings.MipFilter);
+			record.SRGB = metadata.TextureSettings.SRGB ? 1 : 0;
+			record.ContentHash = metadata.ContentHash;
+			return record;
+		}
+
+		AssetMetadata ToMetadata(const AssetRegistryRecord& record, const char* path)
+		{
+			AssetMetadata metadata;
+			metadata.Type = static_cast<AssetType>(record.Type);
+			metadata.FilePath = std::filesystem::path(std::string(path, record.PathLength));
+			metadata.LastModifiedTime = record.LastModifiedTime;
+			metadata.TextureSettings.Compression = static_cast<TextureCompression>(record.Compression);
+			metadata.TextureSettings.GenerateMipmaps = record.GenerateMipmaps != 0;
+			metadata.TextureSettings.MipFilter = static_cast<TextureMipFilter>(record.MipFilter);
+			metadata.TextureSettings.SRGB = record.SRGB != 0;
+			metadata.ContentHash = record.ContentHash;
+			return metadata;
+		}
+
+		// Checksum is the last field of every journal record layout
+		uint64_t ComputeRecordChecksum(const void* record, size_t recordSize, const char* path, uint32_t pathLength)
+		{
+			uint64_t seed = Hash::Compute64(record, recordSize - sizeof(uint64_t));
+			return Hash::Compute64(path, pathLength, seed);
+		}
+
+		// Written aside and renamed into place, so a crash never leaves a partial file behind
+		bool WriteFileAtomic(const std::filesystem::path& path, const std::vector<uint8_t>& bytes)
+		{
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp";
+
+			{
+				std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+				out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+				if (!out)
+				{
+					GX_CORE_ERROR("Failed to write {}", tempPath.string());
+					return false;
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename(tempPath, path, error);
+			if (error)
+			{
+				GX_CORE_ERROR("Failed to replace {}: {}", path.string(), error.message());
+				std::filesystem::remove(tempPath, error);
+				return false;
+			}
+			return true;
+		}
+	}
+
+	struct AssetRegistryStore::WriterTask : enki::ITaskSet
+	{
+		AssetRegistryStore* Store = nullptr;
+
+		void ExecuteRange(enki::TaskSetPartition range, uint32_t threadNum) override
+		{
+			Store->WriteChanges();
+		}
+	};
+
+	AssetRegistryStore::AssetRegistryStore()
+		: m_WriterTask(CreateScope<WriterTask>())
+	{
+		m_WriterTask->Store = this;
+		// Disk writes only; anything a frame is waiting on goes first
+		m_WriterTask->m_Priority = enki::TASK_PRIORITY_LOW;
+	}
+
+	AssetRegistryStore::~AssetRegistryStore()
+	{
+		WaitForWrites();
+	}
+
+	bool AssetRegistryStore::Open(const std::filesystem::path& directory, AssetRegistry& outRegistry)
+	{
+		GX_PROFILE_FUNCTION();
+
+		WaitForWrites();
+
+		m_Directory = directory;
+		m_StoredState.clear();
+		m_Journal.close();
+		m_Generation = 0;
+		m_JournalRecordCount = 0;
+
+		std::filesystem::path registryPath = directory / RegistryFileName;
+		std::error_code error;
+		if (!std::filesystem::is_regular_file(registryPath, error))
+			return false;
+
+		MappedFile file;
+		if (!file.Open(registryPath) || file.GetSize() < sizeof(AssetRegistryHeader))
+			return false;
+
+		AssetRegistryHeader header;
+		std::memcpy(&header, file.GetData(), sizeof(header));
+
+		const uint8_t* body = file.GetData() + sizeof(AssetRegistryHeader);
+		uint64_t bodySize = file.GetSize() - sizeof(AssetRegistryHeader);
+		size_t recordSize = GetRecordSize(header.Version);
+		bool valid = std::memcmp(header.Signature, RegistrySignature, sizeof(RegistrySignature)) == 0
+			&& IsReadableVersion(header.Version)
+			&& header.EntryCount <= bodySize / recordSize
+			&& bodySize == header.EntryCount * recordSize + header.PathsSize
+			&& Hash::Compute64(body, bodySize) == header.Checksum;
+		if (!valid)
+		{
+			GX_CORE_ERROR("Asset registry is corrupt or from another version: {}", registryPath.string());
+			return false;
+		}
+
+		const char* paths = reinterpret_cast<const char*>(body + header.EntryCount * recordSize);
+		m_StoredState.reserve(header.EntryCount);
+
+		for (uint64_t i = 0; i < header.EntryCount; i++)
+		{
+			AssetRegistryRecord record = ReadRecord(body + i * recordSize, header.Version);
+
+			if (static_cast<uint64_t>(record.PathOffset) + record.PathLength > header.PathsSize)
+			{
+				GX_CORE_ERROR("Asset registry entry {} has an invalid path", record.Handle);
+				outRegistry.clear();
+				m_StoredState.clear();
+				return false;
+			}
+
+			// Records are sorted by handle, so every insert lands at the end
+			AssetMetadata metadata = ToMetadata(record, paths + record.PathOffset);
+			m_StoredState.emplace(record.Handle, metadata);
+			outRegistry.emplace_hint(outRegistry.end(), record.Handle, std::move(metadata));
+		}
+
+		m_Generation = header.Generation;
+
+		// An older version is rewritten as the current one before anything is appended to it
+		if (ReplayJournal(outRegistry, header.Version) && header.Version == RegistryVersion)
+			m_Journal.open(directory / JournalFileName, std::ios::binary | std::ios::app);
+		else
+			m_CompactRequested = true;
+
+		GX_CORE_INFO("Loaded asset registry: {} assets, {} journaled changes", outRegistry.size(), m_JournalRecordCount);
+		return true;
+	}
+
+	bool AssetRegistryStore::ReplayJournal(AssetRegistry& outRegistry, uint32_t version)
+	{
+		std::filesystem::path journalPath = m_Directory / JournalFileName;
+		std::error_code error;
+		if (!std::filesystem::is_regular_file(journalPath, error))
+			return false;
+
+		MappedFile file;
+		if (!file.Open(journalPath) || file.GetSize() < sizeof(AssetJournalHeader))
+			return false;
+
+		AssetJournalHeader header;
+		std::memcpy(&header, file.GetData(), sizeof(header));
+
+		// A journal from an older generation is already folded into the registry
+		if (std::memcmp(header.Signature, JournalSignature, sizeof(JournalSignature)) != 0
+			|| header.Version != version || header.Generation != m_Generation)
+			return false;
+
+		size_t recordSize = GetJournalRecordSize(version);
+
+		uint64_t offset = sizeof(AssetJournalHeader);
+		while (offset < file.GetSize())
+		{
+			if (file.GetSize() - offset < recordSize)
+				break;
+
+			// Op, then Entry, then Checksum in every version
+			const uint8_t* recordBytes = file.GetData() + offset;
+			AssetJournalRecord record{};
+			std::memcpy(&record.Op, recordBytes, sizeof(record.Op));
+			record.Entry = ReadRecord(recordBytes + offsetof(AssetJournalRecord, Entry), version);
+			std::memcpy(&record.Checksum, recordBytes + recordSize - sizeof(uint64_t), sizeof(record.Checksum));
+
+			const char* path = reinterpret_cast<const char*>(recordBytes + recordSize);
+			if (file.GetSize() - offset - recordSize < record.Entry.PathLength
+				|| ComputeRecordChecksum(recordBytes, recordSize, path, record.Entry.PathLength) != record.Checksum)
+				break;
+
+			AssetHandle handle = record.Entry.Handle;
+			if (record.Op == AssetJournalOp::Put)
+			{
+				AssetMetadata metadata = ToMetadata(record.Entry, path);
+				m_StoredState[handle] = metadata;
+				outRegistry[handle] = std::move(metadata);
+			}
+			else
+			{
+				m_StoredState.erase(handle);
+				outRegistry.erase(handle);
+			}
+
+			m_JournalRecordCount++;
+			offset += recordSize + record.Entry.PathLength;
+		}
+
+		if (offset != file.GetSize())
+		{
+			// Whatever follows was cut off mid-append; compaction drops it from the file
+			GX_CORE_WARN("Asset registry journal has a damaged tail, recovered {} changes", m_JournalRecordCount);
+			return false;
+		}
+
+		return true;
+	}
+
+	void AssetRegistryStore::Reset(const std::filesystem::path& directory, const AssetRegistry& registry)
+	{
+		WaitForWrites();
+
+		m_Directory = directory;
+		m_PendingChanges.clear();
+		m_StoredState.clear();
+		m_StoredState.reserve(registry.size());
+		for (const auto& [handle, metadata] : registry)
+			m_StoredState.emplace(handle, metadata);
+
+		m_CompactRequested = true;
+	}
+
+	void AssetRegistryStore::Put(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		m_PendingChanges.push_back({ AssetJournalOp::Put, handle, metadata });
+	}
+
+	void AssetRegistryStore::Remove(AssetHandle handle)
+	{
+		m_PendingChanges.push_back({ AssetJournalOp::Remove, handle, {} });
+	}
+
+	void AssetRegistryStore::Flush()
+	{
+		if (m_Directory.empty() || (m_PendingChanges.empty() && !m_CompactRequested))
+			return;
+
+		// Changes keep queueing until the writer is free, then go out together
+		if (!m_WriterTask->GetIsComplete())
+			return;
+
+		std::swap(m_WritingChanges, m_PendingChanges);
+		m_WritingCompact = m_CompactRequested;
+		m_CompactRequested = false;
+
+		Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(m_WriterTask.get());
+	}
+
+	void AssetRegistryStore::WaitForWrites()
+	{
+		if (!m_WriterTask->GetIsComplete())
+			Application::Get().GetScheduler().GetTaskScheduler().WaitforTask(m_WriterTask.get());
+
+		if (m_Directory.empty() || (m_PendingChanges.empty() && !m_CompactRequested))
+			return;
+
+		std::swap(m_WritingChanges, m_PendingChanges);
+		m_WritingCompact = m_CompactRequested;
+		m_CompactRequested = false;
+		WriteChanges();
+	}
+
+	void AssetRegistryStore::WriteChanges()
+	{
+		GX_PROFILE_FUNCTION();
+
+		for (const Change& change : m_WritingChanges)
+		{
+			if (change.Op == AssetJournalOp::Put)
+				m_StoredState[change.Handle] = change.Metadata;
+			else
+				m_StoredState.erase(change.Handle);
+		}
+
+		bool compact = m_WritingCompact || !m_Journal.is_open();
+		if (!compact)
+		{
+			AppendToJournal();
+			compact = m_JournalRecordCount > std::max<uint64_t>(MinCompactionRecords, m_StoredState.size());
+		}
+
+		if (compact)
+			Compact();
+
+		m_WritingChanges.clear();
+		m_WritingCompact = false;
+	}
+
+	void AssetRegistryStore::AppendToJournal()
+	{
+		if (m_WritingChanges.empty())
+			return;
+
+		// One write per batch, so a crash tears at most this batch
+		std::vector<uint8_t> bytes;
+		for (const Change& change : m_WritingChanges)
+		{
+			std::string path = change.Op == AssetJournalOp::Put ? change.Metadata.FilePath.generic_string() : std::string();
+
+			AssetJournalRecord record{};
+			record.Op = change.Op;
+			record.Entry = ToRecord(change.Handle, change.Metadata, 0, static_cast<uint32_t>(path.size()));
+			record.Checksum = ComputeRecordChecksum(&record, sizeof(record), path.data(), record.Entry.PathLength);
+
+			const uint8_t* recordBytes = reinterpret_cast<const uint8_t*>(&record);
+			bytes.insert(bytes.end(), recordBytes, recordBytes + sizeof(record));
+			bytes.insert(bytes.end(), path.begin(), path.end());
+		}
+
+		m_Journal.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		m_Journal.flush();
+		if (!m_Journal)
+		{
+			// Closing it makes the next batch compact, which writes everything out again
+			GX_CORE_ERROR("Failed to append to the asset registry journal");
+			m_Journal.close();
+			return;
+		}
+
+		m_JournalRecordCount += m_WritingChanges.size();
+	}
+
+	void AssetRegistryStore::Compact()
+	{
+		GX_PROFILE_FUNCTION();
+
+		std::error_code error;
+		std::filesystem::create_directories(m_Directory, error);
+
+		std::vector<const std::pair<const AssetHandle, AssetMetadata>*> entries;
+		entries.reserve(m_StoredState.size());
+		for (const auto& entry : m_StoredState)
+			entries.push_back(&entry);
+		std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b)
+			{
+				return static_cast<uint64_t>(a->first) < static_cast<uint64_t>(b->first);
+			});
+
+		std::vector<AssetRegistryRecord> records;
+		records.reserve(entries.size());
+		std::string paths;
+		for (const auto* entry : entries)
+		{
+			std::string path = entry->second.FilePath.generic_string();
+			records.push_back(ToRecord(entry->first, entry->second, static_cast<uint32_t>(paths.size()), static_cast<uint32_t>(path.size())));
+			paths += path;
+		}
+
+		std::vector<uint8_t> bytes(sizeof(AssetRegistryHeader) + records.size() * sizeof(AssetRegistryRecord) + paths.size());
+		uint8_t* body = bytes.data() + sizeof(AssetRegistryHeader);
+		if (!records.empty())
+			std::memcpy(body, records.data(), records.size() * sizeof(AssetRegistryRecord));
+		std::memcpy(body + records.size() * sizeof(AssetRegistryRecord), paths.data(), paths.size());
+
+		AssetRegistryHeader header{};
+		std::memcpy(header.Signature, RegistrySignature, sizeof(RegistrySignature));
+		header.Version = RegistryVersion;
+		header.Generation = m_Generation + 1;
+		header.EntryCount = records.size();
+		header.PathsSize = paths.size();
+		header.Checksum = Hash::Compute64(body, bytes.size() - sizeof(AssetRegistryHeader));
+		std::memcpy(bytes.data(), &header, sizeof(header));
+
+		// On failure the old registry stays valid; closing the journal makes the next batch retry
+		if (!WriteFileAtomic(m_Directory / RegistryFileName, bytes))
+		{
+			m_Journal.close();
+			return;
+		}
+
+		m_Generation = header.Generation;
+		m_JournalRecordCount = 0;
+		m_Journal.close();
+
+		AssetJournalHeader journalHeader{};
+		std::memcpy(journalHeader.Signature, JournalSignature, sizeof(JournalSignature));
+		journalHeader.Version = RegistryVersion;
+		journalHeader.Generation = m_Generation;
+
+		const uint8_t* journalBytes = reinterpret_cast<const uint8_t*>(&journalHeader);
+		if (WriteFileAtomic(m_Directory / JournalFileName, std::vector<uint8_t>(journalBytes, journalBytes + sizeof(journalHeader))))
+			m_Journal.open(m_Directory / JournalFileName, std::ios::binary | std::ios::app);
+	}
+
+}
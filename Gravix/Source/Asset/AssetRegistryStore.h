@@ -0,0 +1,144 @@
+#pragma once
+
+#include "AssetMetadata.h"
+
+#include <TaskScheduler.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	using AssetRegistry = std::map<AssetHandle, AssetMetadata>;
+
+	/*
+	 * Binary asset registry and its change journal, both under the Library directory
+	 *
+	 *   AssetRegistry.gxreg:     [AssetRegistryHeader][AssetRegistryRecord x EntryCount, sorted by Handle][path bytes]
+	 *   AssetRegistry.gxjournal: [AssetJournalHeader]([AssetJournalRecord][path bytes])...
+	 *
+	 * The registry holds the state as of its Generation and the journal every change
+	 * made since. A journal is only replayed onto the registry with the same Generation.
+	 * Compaction writes the next Generation's registry before starting an empty journal,
+	 * so a crash in between leaves a stale journal that is skipped, not applied twice.
+	 * Journal records are checksummed one by one, so a torn append loses only the
+	 * records it was writing.
+	 */
+	struct AssetRegistryHeader
+	{
+		char     Signature[4]; // "GREG"
+		uint32_t Version;
+		uint64_t Generation;
+		uint64_t EntryCount;
+		uint64_t PathsSize;
+		uint64_t Checksum;     // Hash::Compute64 over everything after the header
+	};
+	static_assert(sizeof(AssetRegistryHeader) == 40, "AssetRegistryHeader layout is part of the file format");
+
+	struct AssetRegistryRecord
+	{
+		uint64_t Handle;
+		uint64_t LastModifiedTime;
+		uint32_t PathOffset;   // Into the path bytes; unused in journal records
+		uint32_t PathLength;   // Generic UTF-8 path relative to the asset directory
+		uint32_t Type;         // AssetType
+		uint8_t  Compression;  // TextureImportSettings, packed
+		uint8_t  GenerateMipmaps;
+		uint8_t  MipFilter;
+		uint8_t  SRGB;
+		uint64_t ContentHash;
+	};
+	static_assert(sizeof(AssetRegistryRecord) == 40, "AssetRegistryRecord layout is part of the file format");
+
+	struct AssetJournalHeader
+	{
+		char     Signature[4]; // "GRJN"
+		uint32_t Version;
+		uint64_t Generation;   // Of the registry this journal applies to
+	};
+	static_assert(sizeof(AssetJournalHeader) == 16, "AssetJournalHeader layout is part of the file format");
+
+	enum class AssetJournalOp : uint32_t
+	{
+		Put = 1,
+		Remove = 2
+	};
+
+	struct AssetJournalRecord
+	{
+		AssetJournalOp Op;
+		uint32_t Reserved;
+		AssetRegistryRecord Entry; // Only Handle is meaningful for Remove
+		uint64_t Checksum;         // Hash::Compute64 of this record up to here, then of the path bytes
+	};
+	static_assert(sizeof(AssetJournalRecord) == 56, "AssetJournalRecord layout is part of the file format");
+
+	// Persists the editor's asset registry in the files above. The main thread queues
+	// changes as it makes them and Flush hands them to a worker, which appends them to
+	// the journal and compacts it once it outgrows the registry. A frame only pays for
+	// the changes it made, never for the size of the project.
+	class AssetRegistryStore
+	{
+	public:
+		AssetRegistryStore();
+		~AssetRegistryStore();
+
+		AssetRegistryStore(const AssetRegistryStore&) = delete;
+		AssetRegistryStore& operator=(const AssetRegistryStore&) = delete;
+
+		// Maps the registry and replays its journal into outRegistry. Returns false when
+		// the directory has no usable registry; Reset then starts one.
+		bool Open(const std::filesystem::path& directory, AssetRegistry& outRegistry);
+
+		// Replaces everything stored with registry, written out as a new registry on the next Flush
+		void Reset(const std::filesystem::path& directory, const AssetRegistry& registry);
+
+		// Main thread only. Nothing is written until Flush.
+		void Put(AssetHandle handle, const AssetMetadata& metadata);
+		void Remove(AssetHandle handle);
+
+		// Hands everything queued to the writer, unless it is still busy with the last batch
+		void Flush();
+
+		// Blocks until everything queued has been written
+		void WaitForWrites();
+
+		// Version 1 records lack ContentHash; they are still read, and rewritten on the next compaction
+		static constexpr uint32_t RegistryVersion = 2;
+	private:
+		struct Change
+		{
+			AssetJournalOp Op;
+			AssetHandle Handle;
+			AssetMetadata Metadata;
+		};
+
+		struct WriterTask;
+
+		// Writer side; runs on a worker, or inline from WaitForWrites
+		void WriteChanges();
+		void AppendToJournal();
+		void Compact();
+		bool ReplayJournal(AssetRegistry& outRegistry, uint32_t version);
+	private:
+		std::filesystem::path m_Directory;
+
+		// Main thread
+		std::vector<Change> m_PendingChanges;
+		bool m_CompactRequested = false;
+
+		// Owned by the writer while a task is in flight
+		Scope<WriterTask> m_WriterTask;
+		std::vector<Change> m_WritingChanges;
+		bool m_WritingCompact = false;
+		std::unordered_map<AssetHandle, AssetMetadata> m_StoredState;
+		std::ofstream m_Journal;
+		uint64_t m_Generation = 0;
+		uint64_t m_JournalRecordCount = 0;
+	};
+
+}
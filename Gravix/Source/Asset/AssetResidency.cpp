@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "AssetResidency.h"
+
+#include "AssetSlotTable.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// While over budget with nothing evictable, rescanning every frame would just burn time
+		constexpr uint64_t OverBudgetScanInterval = 15;
+
+		size_t TypeIndex(AssetType type)
+		{
+			return std::min(static_cast<size_t>(type), AssetTypeCount - 1);
+		}
+
+		void Add(AssetMemoryUsage& total, const AssetMemoryUsage& usage)
+		{
+			total.CPUBytes += usage.CPUBytes;
+			total.GPUBytes += usage.GPUBytes;
+		}
+
+		void Subtract(AssetMemoryUsage& total, const AssetMemoryUsage& usage)
+		{
+			total.CPUBytes -= std::min(total.CPUBytes, usage.CPUBytes);
+			total.GPUBytes -= std::min(total.GPUBytes, usage.GPUBytes);
+		}
+	}
+
+	const char* ResidencyReasonToString(ResidencyReason reason)
+	{
+		switch (reason)
+		{
+		case ResidencyReason::Referenced:   return "Referenced";
+		case ResidencyReason::RecentlyUsed: return "Recently used";
+		case ResidencyReason::Evictable:    return "Evictable";
+		}
+		return "Unknown";
+	}
+
+	AssetResidency::AssetResidency(const AssetSlotTable* slotTable)
+		: m_SlotTable(slotTable)
+	{
+	}
+
+	void AssetResidency::OnLoaded(AssetHandle handle, const Asset* asset)
+	{
+		OnUnloaded(handle);
+
+		Entry entry;
+		entry.Instance = asset;
+		entry.Type = asset->GetAssetType();
+		entry.Memory = asset->GetMemoryUsage();
+		entry.LastUsedFrame = m_Frame;
+
+		AssetResidencyStats::TypeStats& typeStats = m_Stats.PerType[TypeIndex(entry.Type)];
+		typeStats.Count++;
+		Add(typeStats.Memory, entry.Memory);
+		Add(m_Stats.Total, entry.Memory);
+		m_Stats.ResidentCount++;
+
+		m_Entries[handle] = entry;
+	}
+
+	void AssetResidency::OnUnloaded(AssetHandle handle)
+	{
+		auto it = m_Entries.find(handle);
+		if (it == m_Entries.end())
+			return;
+
+		const Entry& entry = it->second;
+		AssetResidencyStats::TypeStats& typeStats = m_Stats.PerType[TypeIndex(entry.Type)];
+		typeStats.Count--;
+		Subtract(typeStats.Memory, entry.Memory);
+		Subtract(m_Stats.Total, entry.Memory);
+		m_Stats.ResidentCount--;
+
+		m_Entries.erase(it);
+	}
+
+	void AssetResidency::Touch(AssetHandle handle)
+	{
+		auto it = m_Entries.find(handle);
+		if (it != m_Entries.end())
+			it->second.LastUsedFrame = m_Frame;
+	}
+
+	bool AssetResidency::IsOverBudget() const
+	{
+		return (m_Budget.CPUBytes != 0 && m_Stats.Total.CPUBytes > m_Budget.CPUBytes)
+			|| (m_Budget.GPUBytes != 0 && m_Stats.Total.GPUBytes > m_Budget.GPUBytes);
+	}
+
+	uint64_t AssetResidency::GetLastUsedFrame(AssetHandle handle, const Entry& entry) const
+	{
+		// Draws stamp the slot table, GetAsset stamps the entry
+		return std::max(entry.LastUsedFrame, m_SlotTable->GetLastUsedFrame(handle));
+	}
+
+	uint32_t AssetResidency::GetExternalReferences(AssetHandle handle, const Entry& entry) const
+	{
+		// The manager's loaded map holds one reference and a published slot another
+		uint32_t ownReferences = 1 + (m_SlotTable->HoldsInstance(handle) ? 1 : 0);
+		uint32_t references = entry.Instance->GetRefCount();
+		return references > ownReferences ? references - ownReferences : 0;
+	}
+
+	const std::vector<AssetHandle>& AssetResidency::SelectEvictions()
+	{
+		m_Evictions.clear();
+
+		if (!IsOverBudget())
+		{
+			m_Stats.OverBudget = false;
+			return m_Evictions;
+		}
+
+		if (!m_ForceScan && m_Frame - m_LastScanFrame < OverBudgetScanInterval)
+			return m_Evictions;
+
+		GX_PROFILE_FUNCTION();
+
+		m_LastScanFrame = m_Frame;
+		m_ForceScan = false;
+
+		struct Candidate
+		{
+			AssetHandle Handle;
+			uint64_t LastUsedFrame;
+			AssetMemoryUsage Memory;
+		};
+
+		std::vector<Candidate> candidates;
+		for (const auto& [handle, entry] : m_Entries)
+		{
+			uint64_t lastUsed = GetLastUsedFrame(handle, entry);
+			if (m_Frame - lastUsed < m_Budget.MinUnusedFrames)
+				continue;
+
+			if (GetExternalReferences(handle, entry) > 0)
+				continue;
+
+			candidates.push_back({ handle, lastUsed, entry.Memory });
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b)
+			{
+				return a.LastUsedFrame < b.LastUsedFrame;
+			});
+
+		AssetMemoryUsage projected = m_Stats.Total;
+		for (const Candidate& candidate : candidates)
+		{
+			bool cpuOver = m_Budget.CPUBytes != 0 && projected.CPUBytes > m_Budget.CPUBytes;
+			bool gpuOver = m_Budget.GPUBytes != 0 && projected.GPUBytes > m_Budget.GPUBytes;
+			if (!cpuOver && !gpuOver)
+				break;
+
+			// Only evict what actually helps with the dimension that is over
+			if ((cpuOver && candidate.Memory.CPUBytes > 0) || (gpuOver && candidate.Memory.GPUBytes > 0))
+			{
+				m_Evictions.push_back(candidate.Handle);
+				Subtract(projected, candidate.Memory);
+				Add(m_Stats.EvictedMemoryTotal, candidate.Memory);
+			}
+		}
+
+		m_Stats.EvictedLastScan = static_cast<uint32_t>(m_Evictions.size());
+		m_Stats.EvictedTotal += m_Evictions.size();
+		m_Stats.OverBudget = (m_Budget.CPUBytes != 0 && projected.CPUBytes > m_Budget.CPUBytes)
+			|| (m_Budget.GPUBytes != 0 && projected.GPUBytes > m_Budget.GPUBytes);
+
+		return m_Evictions;
+	}
+
+	std::vector<ResidentAssetInfo> AssetResidency::GetResidentAssets() const
+	{
+		std::vector<ResidentAssetInfo> assets;
+		assets.reserve(m_Entries.size());
+
+		for (const auto& [handle, entry] : m_Entries)
+		{
+			ResidentAssetInfo info;
+			info.Handle = handle;
+			info.Type = entry.Type;
+			info.Memory = entry.Memory;
+			info.LastUsedFrame = GetLastUsedFrame(handle, entry);
+			info.ExternalReferences = GetExternalReferences(handle, entry);
+
+			if (info.ExternalReferences > 0)
+				info.Reason = ResidencyReason::Referenced;
+			else if (m_Frame - info.LastUsedFrame < m_Budget.MinUnusedFrames)
+				info.Reason = ResidencyReason::RecentlyUsed;
+			else
+				info.Reason = ResidencyReason::Evictable;
+
+			assets.push_back(info);
+		}
+
+		// Biggest first, which is what someone chasing a budget wants to see
+		std::sort(assets.begin(), assets.end(), [](const ResidentAssetInfo& a, const ResidentAssetInfo& b)
+			{
+				return a.Memory.GetTotal() > b.Memory.GetTotal();
+			});
+
+		return assets;
+	}
+
+}
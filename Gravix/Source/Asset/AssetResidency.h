@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Asset.h"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	class AssetSlotTable;
+
+	constexpr size_t AssetTypeCount = static_cast<size_t>(AssetType::Pipeline) + 1;
+
+	struct AssetResidencyBudget
+	{
+		uint64_t CPUBytes = 0; // 0 = unlimited
+		uint64_t GPUBytes = 0;
+
+		// Anything drawn or fetched this recently stays, even over budget, so a scene
+		// that does not fit degrades to streaming instead of thrashing every frame
+		uint32_t MinUnusedFrames = 120;
+	};
+
+	// Why an asset is still resident
+	enum class ResidencyReason
+	{
+		Referenced,   // Held by something outside the asset manager (scene, material, panel)
+		RecentlyUsed, // Used within MinUnusedFrames
+		Evictable     // Idle; goes first once over budget
+	};
+
+	const char* ResidencyReasonToString(ResidencyReason reason);
+
+	struct ResidentAssetInfo
+	{
+		AssetHandle Handle;
+		AssetType Type;
+		AssetMemoryUsage Memory;
+		uint64_t LastUsedFrame;
+		uint32_t ExternalReferences;
+		ResidencyReason Reason;
+	};
+
+	struct AssetResidencyStats
+	{
+		struct TypeStats
+		{
+			uint32_t Count = 0;
+			AssetMemoryUsage Memory;
+		};
+
+		std::array<TypeStats, AssetTypeCount> PerType{};
+		AssetMemoryUsage Total;
+		uint32_t ResidentCount = 0;
+
+		uint32_t EvictedLastScan = 0;
+		uint64_t EvictedTotal = 0;
+		AssetMemoryUsage EvictedMemoryTotal;
+
+		// Still over after the last scan because everything left was in use
+		bool OverBudget = false;
+	};
+
+	// Per-type memory accounting for an asset manager's loaded assets, and the LRU policy
+	// that decides what to evict when they exceed the budget. Does not own the assets;
+	// the manager reports loads and unloads and performs the evictions it selects.
+	// Main thread only.
+	class AssetResidency
+	{
+	public:
+		AssetResidency(const AssetSlotTable* slotTable);
+
+		void SetBudget(const AssetResidencyBudget& budget) { m_Budget = budget; m_ForceScan = true; }
+		const AssetResidencyBudget& GetBudget() const { return m_Budget; }
+
+		// Returns the new frame number; stamped on everything touched until the next call
+		uint64_t BeginFrame() { return ++m_Frame; }
+		uint64_t GetFrame() const { return m_Frame; }
+
+		// asset must stay alive until OnUnloaded
+		void OnLoaded(AssetHandle handle, const Asset* asset);
+		void OnUnloaded(AssetHandle handle);
+		void Touch(AssetHandle handle);
+
+		// Least recently used unreferenced assets that bring usage back under budget.
+		// Cheap when within budget; a full scan runs at most every few frames otherwise.
+		const std::vector<AssetHandle>& SelectEvictions();
+
+		std::vector<ResidentAssetInfo> GetResidentAssets() const;
+		const AssetResidencyStats& GetStats() const { return m_Stats; }
+	private:
+		struct Entry
+		{
+			const Asset* Instance;
+			AssetType Type;
+			AssetMemoryUsage Memory;
+			uint64_t LastUsedFrame;
+		};
+
+		bool IsOverBudget() const;
+		uint64_t GetLastUsedFrame(AssetHandle handle, const Entry& entry) const;
+		uint32_t GetExternalReferences(AssetHandle handle, const Entry& entry) const;
+	private:
+		const AssetSlotTable* m_SlotTable;
+		AssetResidencyBudget m_Budget;
+
+		std::unordered_map<AssetHandle, Entry> m_Entries;
+		AssetResidencyStats m_Stats;
+
+		std::vector<AssetHandle> m_Evictions;
+		uint64_t m_Frame = 0;
+		uint64_t m_LastScanFrame = 0;
+		bool m_ForceScan = false;
+	};
+
+}
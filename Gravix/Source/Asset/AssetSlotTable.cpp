@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "AssetSlotTable.h"
+
+#include "AssetManagerBase.h"
+
+namespace Gravix
+{
+
+	AssetSlotTable::AssetSlotTable(AssetManagerBase* owner)
+		: m_Owner(owner)
+	{
+		// Slot 0 stays empty so a default AssetSlotHandle never resolves
+		m_Slots.emplace_back();
+	}
+
+	AssetSlotHandle AssetSlotTable::Acquire(AssetHandle handle)
+	{
+		if (handle == 0)
+			return {};
+
+		auto it = m_SlotIndices.find(handle);
+		if (it != m_SlotIndices.end())
+			return { it->second, m_Slots[it->second].Generation };
+
+		uint32_t index;
+		if (!m_FreeSlots.empty())
+		{
+			index = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			index = static_cast<uint32_t>(m_Slots.size());
+			m_Slots.emplace_back();
+		}
+
+		Slot& slot = m_Slots[index];
+		slot.Handle = handle;
+		slot.LoadRequested = false;
+		m_SlotIndices[handle] = index;
+
+		return { index, slot.Generation };
+	}
+
+	void AssetSlotTable::Publish(AssetHandle handle, const Ref<Asset>& asset)
+	{
+		auto it = m_SlotIndices.find(handle);
+		if (it == m_SlotIndices.end())
+			return;
+
+		Slot& slot = m_Slots[it->second];
+		slot.Instance = asset;
+		slot.Type = asset ? asset->GetAssetType() : AssetType::None;
+		slot.LoadRequested = false;
+	}
+
+	void AssetSlotTable::Evict(AssetHandle handle)
+	{
+		auto it = m_SlotIndices.find(handle);
+		if (it == m_SlotIndices.end())
+			return;
+
+		Slot& slot = m_Slots[it->second];
+		slot.Instance = nullptr;
+		slot.LoadRequested = false;
+	}
+
+	void AssetSlotTable::Release(AssetHandle handle)
+	{
+		auto it = m_SlotIndices.find(handle);
+		if (it == m_SlotIndices.end())
+			return;
+
+		Slot& slot = m_Slots[it->second];
+		slot.Handle = 0;
+		slot.Instance = nullptr;
+		slot.LoadRequested = false;
+		slot.Generation++;
+
+		m_FreeSlots.push_back(it->second);
+		m_SlotIndices.erase(it);
+	}
+
+	void AssetSlotTable::Clear()
+	{
+		for (Slot& slot : m_Slots)
+		{
+			slot.Instance = nullptr;
+			slot.LoadRequested = false;
+		}
+	}
+
+	uint64_t AssetSlotTable::GetLastUsedFrame(AssetHandle handle) const
+	{
+		auto it = m_SlotIndices.find(handle);
+		return it != m_SlotIndices.end() ? m_Slots[it->second].LastUsedFrame : 0;
+	}
+
+	bool AssetSlotTable::HoldsInstance(AssetHandle handle) const
+	{
+		auto it = m_SlotIndices.find(handle);
+		return it != m_SlotIndices.end() && m_Slots[it->second].Instance;
+	}
+
+	void AssetSlotTable::RequestLoad(Slot& slot)
+	{
+		slot.LoadRequested = true;
+
+		// Something is drawing it right now, so it is due immediately.
+		// Synchronous managers publish before this returns; async ones on completion.
+		AssetLoadOptions options;
+		options.Priority = LoadPriority::High;
+		options.Deadline = std::chrono::steady_clock::now();
+		options.CancelToken = m_LoadToken;
+		m_Owner->RequestLoad(slot.Handle, options);
+	}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Asset.h"
+#include "AsyncLoadRequest.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	class AssetManagerBase;
+
+	// Index into an AssetSlotTable. Cached in components and resolved per draw;
+	// a stale generation means the slot was recycled for another asset.
+	struct AssetSlotHandle
+	{
+		uint32_t Index = 0; // 0 is never handed out
+		uint32_t Generation = 0;
+	};
+
+	// Stable per-asset slots. A slot keeps its index and generation across reloads and
+	// only the instance it points at changes, so cached handles survive hot reload.
+	// Main thread only.
+	class AssetSlotTable
+	{
+	public:
+		AssetSlotTable(AssetManagerBase* owner);
+
+		// Resolves a cached slot, re-acquiring it when it is stale or was cached for another
+		// handle. The fast path is a bounds check, three compares and a load; no refcounting.
+		template<typename TAsset>
+		TAsset* Resolve(AssetSlotHandle& slotHandle, AssetHandle handle)
+		{
+			// A default slot handle matches the reserved slot 0, which never resolves
+			if (handle == 0)
+				return nullptr;
+
+			if (slotHandle.Index >= m_Slots.size() || m_Slots[slotHandle.Index].Generation != slotHandle.Generation
+				|| m_Slots[slotHandle.Index].Handle != handle)
+				slotHandle = Acquire(handle);
+
+			Slot& slot = m_Slots[slotHandle.Index];
+			slot.LastUsedFrame = m_Frame;
+			if (!slot.Instance)
+			{
+				if (!slot.LoadRequested)
+					RequestLoad(slot);
+				return nullptr;
+			}
+
+			if (slot.Type != TAsset::GetStaticType())
+				return nullptr;
+
+			return static_cast<TAsset*>(slot.Instance.Raw());
+		}
+
+		AssetSlotHandle Acquire(AssetHandle handle);
+
+		// Called by the owning manager as assets come and go
+		void Publish(AssetHandle handle, const Ref<Asset>& asset);
+		void Evict(AssetHandle handle);  // Instance dropped, slot stays valid and reloads on next resolve
+		void Release(AssetHandle handle); // Asset is gone for good; outstanding handles go stale
+		void Clear();
+
+		// Frame stamped by Resolve, read back by the residency LRU
+		void SetFrame(uint64_t frame) { m_Frame = frame; }
+		uint64_t GetLastUsedFrame(AssetHandle handle) const;
+		bool HoldsInstance(AssetHandle handle) const;
+
+		// Loads started by Resolve carry this token, so cancelling it drops the loads of whatever
+		// was being drawn (e.g. the previous scene)
+		void SetLoadCancellationToken(const Ref<LoadCancellationToken>& token) { m_LoadToken = token; }
+
+		size_t GetSlotCount() const { return m_Slots.size() - 1; }
+	private:
+		struct Slot
+		{
+			AssetHandle Handle = 0;
+			Ref<Asset> Instance;
+			AssetType Type = AssetType::None; // Cached so the type check skips the virtual call
+			uint64_t LastUsedFrame = 0;
+			uint32_t Generation = 0;
+			bool LoadRequested = false;
+		};
+
+		void RequestLoad(Slot& slot);
+	private:
+		AssetManagerBase* m_Owner;
+		Ref<LoadCancellationToken> m_LoadToken;
+		uint64_t m_Frame = 0;
+
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeSlots;
+		std::unordered_map<AssetHandle, uint32_t> m_SlotIndices;
+	};
+
+}
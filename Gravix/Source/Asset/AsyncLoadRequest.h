@@ -1,14 +1,19 @@
 #pragma once
 
 #include "Asset/Asset.h"
+#include "Asset/AssetMetadata.h"
 #include "Core/Buffer.h"
+#include "Core/MappedFile.h"
+#include "Renderer/Specification.h"
 
 #include "../../../ThirdParties/enkiTS/src/TaskScheduler.h"
 
 #ifdef GRAVIX_EDITOR_BUILD
-#include <yaml-cpp/yaml.h>
+#include "Serialization/Scene/ParsedScene.h"
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <vector>
 #include <variant>
@@ -23,30 +28,81 @@ namespace Gravix
 		High = enki::TASK_PRIORITY_HIGH
 	};
 
+	using LoadDeadline = std::chrono::steady_clock::time_point;
+	constexpr LoadDeadline NoLoadDeadline = LoadDeadline::max();
+
+	// Shared by every request issued on behalf of one requester (e.g. a scene and its
+	// dependencies) so they can be abandoned together. Checked between load stages.
+	class LoadCancellationToken : public RefCounted
+	{
+	public:
+		void Cancel() { m_Cancelled.store(true, std::memory_order_relaxed); }
+		bool IsCancelled() const { return m_Cancelled.load(std::memory_order_relaxed); }
+	private:
+		std::atomic<bool> m_Cancelled = false;
+	};
+
+	struct AssetLoadOptions
+	{
+		LoadPriority Priority = LoadPriority::Normal;
+		// Earlier deadlines dispatch first; ones about to expire are promoted to High
+		LoadDeadline Deadline = NoLoadDeadline;
+		Ref<LoadCancellationToken> CancelToken;
+	};
+
 	struct AsyncLoadRequest
 	{
 		AssetHandle Handle = 0;
 		std::filesystem::path FilePath;
+		AssetType Type = AssetType::None; // Captured up front so workers never touch the registry
 		LoadPriority Priority = LoadPriority::Normal;
+		LoadDeadline Deadline = NoLoadDeadline;
 		AssetState State = AssetState::NotLoaded;
-		enki::TaskSet* LoadTaskSet = nullptr;
+		Ref<LoadCancellationToken> CancelToken;
+		TextureImportSettings TextureSettings; // Copied from the metadata for the worker's cook step
+
+		// References found by the worker. Files are resolved to handles on the main thread,
+		// since workers never touch the registry.
+		std::vector<AssetHandle> Dependencies;
+		std::vector<std::filesystem::path> DependencyFiles;
+		// Of the file as the worker read it; recorded in the registry once the asset is created. 0 if unread.
+		uint64_t ContentHash = 0;
+		// The source as the worker read it, held for assets whose main-thread import reads the file
+		// again. While it is held MappedFileCache hands the importer this same mapping.
+		Ref<MappedFile> SourceFile;
 
+		bool IsCancelled() const { return CancelToken && CancelToken->IsCancelled(); }
+
+		// Cooked on the worker; Data holds levels [FirstMip, MipLevels) in Format, largest first.
+		// The rest stream in later from the texture cache entry CacheKey names.
 		struct TextureData
 		{
 			Buffer Data;
 			uint32_t Width, Height, Channels;
+			TextureFormat Format = TextureFormat::RGBA8;
+			uint32_t MipLevels = 1;
+			uint32_t FirstMip = 0;
+			uint64_t CacheKey = 0;
 		};
 
 		struct SceneData
 		{
 #ifdef GRAVIX_EDITOR_BUILD
-			YAML::Node SceneNode;
+			Ref<ParsedScene> Parsed; // Instantiated on the main thread
 #else GRAVIX_RUNTIME_BUILD
 			Buffer SceneNode;
 #endif 
-			std::vector<AssetHandle> Dependencies;
 		};
 
 		std::variant<std::monostate, TextureData, SceneData> CPUData;
+
+		// Buffer does not own its memory, so anything dropping CPUData unconsumed has to come through here
+		void ReleaseCPUData()
+		{
+			if (auto* textureData = std::get_if<TextureData>(&CPUData))
+				textureData->Data.Release();
+			CPUData = std::monostate{};
+			SourceFile = nullptr;
+		}
 	};
 }
@@ -2,13 +2,18 @@
 #include "EditorAssetManager.h"
 
 #include "AssetImporter.h"
+#include "AssetDirectoryScanner.h"
+#include "Importers/SceneImporter.h"
+#include "Importers/TextureImporter.h"
 #include "Project/Project.h"
 #include "Core/Scheduler.h"
 #include "Core/Application.h"
+#include "Core/MappedFileCache.h"
 #include "Debug/Instrumentor.h"
 
 #include <yaml-cpp/yaml.h>
 #include <fstream>
+#include <chrono>
 
 namespace Gravix 
 {
@@ -25,128 +30,473 @@ namespace Gravix
 
 	void EditorAssetManager::PushToCompletionQueue(Ref<AsyncLoadRequest> request)
 	{
-		std::lock_guard<std::mutex> lock(m_CompletionQueueMutex);
-		m_CompletionQueue.push(request);
+		m_LoadBatcher.PushCompleted(std::move(request));
 	}
 
 	void EditorAssetManager::ProcessAsyncLoads()
 	{
 		GX_PROFILE_FUNCTION();
 
-		m_CompletedRequestsCache.clear();
+		uint64_t frame = m_Residency.BeginFrame();
+		m_SlotTable.SetFrame(frame);
+
+		// Reloads for files that really changed go out with this frame's batch
+		ProcessContentHashes();
+		UpdateBulkImport();
+
+		ProcessLoads(true);
+
+		// Last frame's draws said which levels they need
+		m_StreamedTexturesCache.clear();
+		m_TextureStreamer.Update(frame, m_StreamedTexturesCache);
+		for (AssetHandle handle : m_StreamedTexturesCache)
+			m_Residency.OnLoaded(handle, m_LoadedAssets.at(handle).Raw());
+
+		EnforceResidencyBudget();
+
+		// Whatever the registry changed by this frame goes to disk in the background
+		m_RegistryStore.Flush();
+	}
+
+	void EditorAssetManager::ProcessCompletedLoads()
+	{
+		// Whoever waits here is blocked on the result, so everything that is ready goes at once
+		ProcessLoads(false);
+	}
+
+	void EditorAssetManager::ProcessLoads(bool withinBudget)
+	{
+		GX_PROFILE_FUNCTION();
+
+		auto publishDeadline = withinBudget
+			? std::chrono::steady_clock::now() + m_PublishTimeBudget
+			: std::chrono::steady_clock::time_point::max();
+
+		// Requests issued since the last call go out as one batch
+		m_LoadBatcher.Flush();
+
+		// Taken out of the member, since an importer waiting on a dependency comes back in here
+		std::vector<Ref<AsyncLoadRequest>> completedRequests = std::move(m_CompletedRequestsCache);
+		completedRequests.clear();
 		{
 			GX_PROFILE_SCOPE("GatherCompletedRequests");
-			std::lock_guard<std::mutex> lock(m_CompletionQueueMutex);
-			while (!m_CompletionQueue.empty())
+			Ref<AsyncLoadRequest> request;
+			while (m_LoadBatcher.PopCompleted(request))
+				completedRequests.push_back(std::move(request));
+		}
+
+		{
+			GX_PROFILE_SCOPE("ProcessCompletedRequests");
+			for (const Ref<AsyncLoadRequest>& request : completedRequests)
+				ProcessCompletedRequest(request);
+		}
+		completedRequests.clear();
+		m_CompletedRequestsCache = std::move(completedRequests);
+
+		PublishReadyRequests(publishDeadline);
+
+		// Then whatever was only waiting on the assets just published
+		{
+			GX_PROFILE_SCOPE("ProcessWaitingRequests");
+			ProcessWaitingRequests();
+		}
+		PublishReadyRequests(publishDeadline);
+
+		// Dependencies found above start loading now instead of on the next call
+		m_LoadBatcher.Flush();
+
+		ResolveLoadStates();
+	}
+
+	void EditorAssetManager::ProcessCompletedRequest(const Ref<AsyncLoadRequest>& request)
+	{
+		// Replaced by a newer request since it was dispatched; that one will publish the asset
+		auto loadingIt = m_LoadingAssets.find(request->Handle);
+		if (loadingIt == m_LoadingAssets.end() || loadingIt->second.Raw() != request.Raw())
+		{
+			request->ReleaseCPUData();
+			return;
+		}
+
+		if (request->State == AssetState::Cancelled || request->IsCancelled())
+		{
+			CancelAsyncLoad(request);
+			return;
+		}
+		if (request->State == AssetState::Failed)
+		{
+			GX_CORE_ERROR("Failed to load asset asynchronously: {0}", request->FilePath.string());
+			request->ReleaseCPUData();
+			m_LoadingAssets.erase(request->Handle);
+			return;
+		}
+		if (request->State == AssetState::ReadyForGPU)
+		{
+			LinkDependencies(request);
+
+			if (GetDependencyPolicy(request->Type).Wait)
+				m_WaitingRequests.push_back(request);
+			else
+				m_ReadyRequests.push_back(request);
+		}
+	}
+
+	EditorAssetManager::DependencyPolicy EditorAssetManager::GetDependencyPolicy(AssetType type)
+	{
+		switch (type)
+		{
+		// Built from the loaded shader and pipeline instances, which it keeps
+		case AssetType::Material: return { true, true, true };
+		// Sprites stream in after the scene; their slots pick up reloaded textures by themselves
+		case AssetType::Scene:    return { true, false, false };
+		// Imported files are compiled in, never loaded as assets of their own
+		case AssetType::Shader:   return { false, false, true };
+		default:                  return { false, false, false };
+		}
+	}
+
+	void EditorAssetManager::LinkDependencies(const Ref<AsyncLoadRequest>& request)
+	{
+		std::vector<AssetHandle> dependencies = std::move(request->Dependencies);
+		for (const std::filesystem::path& file : request->DependencyFiles)
+		{
+			AssetHandle dependency = GetAssetHandle(file);
+			if (dependency != 0)
+				dependencies.push_back(dependency);
+		}
+		m_DependencyGraph.SetDependencies(request->Handle, dependencies);
+
+		if (GetDependencyPolicy(request->Type).Load)
+			RequestDependencies(request->Handle, request->CancelToken);
+	}
+
+	void EditorAssetManager::RequestDependencies(AssetHandle handle, const Ref<LoadCancellationToken>& cancelToken)
+	{
+		// Dependencies gate the asset, so they get high priority and are cancelled along with it.
+		// Every one goes out in the same batch, so branches that do not depend on each other
+		// load in parallel.
+		AssetLoadOptions options;
+		options.Priority = LoadPriority::High;
+		options.CancelToken = cancelToken;
+
+		for (AssetHandle dependency : m_DependencyGraph.GetDependencies(handle))
+		{
+			if (!IsAssetHandleValid(dependency))
 			{
-				m_CompletedRequestsCache.push_back(m_CompletionQueue.front());
-				m_CompletionQueue.pop();
+				GX_CORE_WARN("Dependency {0} of {1} not found in registry", static_cast<uint64_t>(dependency), static_cast<uint64_t>(handle));
+				continue;
 			}
+
+			RequestLoad(dependency, options);
 		}
+	}
 
-		bool registryChanged = false;
+	bool EditorAssetManager::IsWaitingOnDependencies(AssetHandle handle) const
+	{
+		// A dependency that failed is no longer loading either; the importer reports it
+		for (AssetHandle dependency : m_DependencyGraph.GetDependencies(handle))
+		{
+			if (m_LoadingAssets.contains(dependency))
+				return true;
+		}
+		return false;
+	}
+
+	void EditorAssetManager::ProcessWaitingRequests()
+	{
+		// Swapped out, so requests that finish loading while one is created here wait in the member
+		std::vector<Ref<AsyncLoadRequest>> waitingRequests = std::move(m_WaitingRequests);
+		m_WaitingRequests.clear();
 
+		for (const Ref<AsyncLoadRequest>& request : waitingRequests)
 		{
-			GX_PROFILE_SCOPE("ProcessCompletedRequests");
-			for(Ref<AsyncLoadRequest> request : m_CompletedRequestsCache)
+			auto loadingIt = m_LoadingAssets.find(request->Handle);
+			if (loadingIt == m_LoadingAssets.end() || loadingIt->second.Raw() != request.Raw())
+			{
+				request->ReleaseCPUData();
+				continue;
+			}
+
+			if (request->IsCancelled())
 			{
-			if (request->State == AssetState::Failed)
+				CancelAsyncLoad(request);
+				continue;
+			}
+
+			if (IsWaitingOnDependencies(request->Handle))
 			{
-				GX_CORE_ERROR("Failed to load asset asynchronously: {0}", request->FilePath.string());
-				m_LoadingAssets.erase(request->Handle);
-				// No delete needed - Ref<> handles cleanup
+				m_WaitingRequests.push_back(request);
 				continue;
 			}
-			if (request->State == AssetState::ReadyForGPU)
+
+			m_ReadyRequests.push_back(request);
+		}
+	}
+
+	void EditorAssetManager::PublishReadyRequests(std::chrono::steady_clock::time_point deadline)
+	{
+		if (m_ReadyRequests.empty())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		// Most urgent first, so what is on screen is not queued behind a bulk import
+		std::stable_sort(m_ReadyRequests.begin(), m_ReadyRequests.end(), [](const Ref<AsyncLoadRequest>& a, const Ref<AsyncLoadRequest>& b)
 			{
-				AssetMetadata metadata = GetAssetMetadata(request->Handle);
+				if (a->Priority != b->Priority)
+					return a->Priority < b->Priority;
+				return a->Deadline < b->Deadline;
+			});
 
-				// If this is a scene, process dependencies first
-				if (metadata.Type == AssetType::Scene)
-				{
-					if (auto* sceneData = std::get_if<AsyncLoadRequest::SceneData>(&request->CPUData))
-					{
-						// Queue dependencies for async loading
-						for (AssetHandle depHandle : sceneData->Dependencies)
-						{
-							// Only load if not already loaded or loading
-							if (!IsAssetLoaded(depHandle) && !m_LoadingAssets.contains(depHandle))
-							{
-								if (IsAssetHandleValid(depHandle))
-								{
-									AssetMetadata depMetadata = GetAssetMetadata(depHandle);
-
-									Ref<AsyncLoadRequest> depRequest = CreateRef<AsyncLoadRequest>();
-									depRequest->Handle = depHandle;
-									depRequest->FilePath = depMetadata.FilePath;
-									depRequest->State = AssetState::NotLoaded;
-									depRequest->Priority = LoadPriority::High; // Dependencies get high priority
-
-									m_LoadingAssets[depHandle] = depRequest;
-
-									AsyncLoadTask* depLoadTask = new AsyncLoadTask(1); // enkiTS manages this
-									depLoadTask->LoadRequests.push_back(depRequest);
-									Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(depLoadTask);
-
-									GX_CORE_INFO("Auto-loading scene dependency: {0}", depMetadata.FilePath.string());
-								}
-								else
-								{
-									GX_CORE_WARN("Scene dependency {0} not found in registry", static_cast<uint64_t>(depHandle));
-								}
-							}
-						}
-					}
-				}
+		// Popped one at a time: an importer waiting on a dependency publishes it from in here
+		while (!m_ReadyRequests.empty())
+		{
+			Ref<AsyncLoadRequest> request = std::move(m_ReadyRequests.front());
+			m_ReadyRequests.pop_front();
 
-				Ref<Asset> asset = AssetImporter::ImportAsset(request->Handle, metadata);
-				if (!asset)
-				{
-					GX_CORE_ERROR("Failed to import asset after async load: {0}", request->FilePath.string());
-					m_LoadingAssets.erase(request->Handle);
-					// No delete needed - Ref<> handles cleanup
-					continue;
-				}
-				request->State = AssetState::Loaded;
-				m_AssetRegistry[request->Handle] = metadata;
-				m_LoadedAssets[request->Handle] = asset;
-				m_LoadingAssets.erase(request->Handle);
-				GX_CORE_INFO("Asynchronously loaded asset: {0}", request->FilePath.string());
-				registryChanged = true;
-				// No delete needed - Ref<> handles cleanup
+			// Replaced or cancelled while it waited for its turn
+			auto loadingIt = m_LoadingAssets.find(request->Handle);
+			if (loadingIt == m_LoadingAssets.end() || loadingIt->second.Raw() != request.Raw())
+			{
+				request->ReleaseCPUData();
+				continue;
 			}
+			if (request->IsCancelled())
+			{
+				CancelAsyncLoad(request);
+				continue;
 			}
+
+			FinishAsyncLoad(request);
+
+			// Checked after the first one, so a single slow asset still goes out
+			if (std::chrono::steady_clock::now() >= deadline)
+				break;
 		}
+	}
+
+	void EditorAssetManager::CancelAsyncLoad(const Ref<AsyncLoadRequest>& request)
+	{
+		request->ReleaseCPUData();
+		request->State = AssetState::Cancelled;
+		m_LoadingAssets.erase(request->Handle);
+		// Lets a slot that asked for it ask again
+		m_SlotTable.Evict(request->Handle);
+	}
+
+	void EditorAssetManager::FinishAsyncLoad(const Ref<AsyncLoadRequest>& request)
+	{
+		AssetMetadata metadata = GetAssetMetadata(request->Handle);
 
-		// Only serialize the asset registry if it actually changed
+		// Textures were decoded and cooked on the worker; only the upload is left
+		Ref<Asset> asset;
+		uint64_t textureCacheKey = 0;
+		if (auto* textureData = std::get_if<AsyncLoadRequest::TextureData>(&request->CPUData))
 		{
-			GX_PROFILE_SCOPE("SerializeAssetRegistry");
-			if (registryChanged)
-			{
-				SerializeAssetRegistry();
-			}
+			asset = TextureImporter::CreateTexture2D(textureData->Data, textureData->Width, textureData->Height,
+				textureData->Format, textureData->MipLevels, request->FilePath.filename().string(), textureData->FirstMip);
+			if (textureData->MipLevels > 1)
+				textureCacheKey = textureData->CacheKey;
+		}
+		// Scenes were parsed on the worker; only creating the entities is left
+		else if (auto* sceneData = std::get_if<AsyncLoadRequest::SceneData>(&request->CPUData); sceneData && sceneData->Parsed)
+		{
+			asset = SceneImporter::InstantiateScene(*sceneData->Parsed);
+		}
+		else
+		{
+			asset = AssetImporter::ImportAsset(request->Handle, metadata);
+		}
+		request->ReleaseCPUData();
+
+		if (!asset)
+		{
+			GX_CORE_ERROR("Failed to import asset after async load: {0}", request->FilePath.string());
+			m_LoadingAssets.erase(request->Handle);
+			return;
 		}
+		request->State = AssetState::Loaded;
+
+		// A reload replaces the old asset in the same frame; frames in flight keep using
+		// it until their fences signal
+		auto loadedIt = m_LoadedAssets.find(request->Handle);
+		if (loadedIt != m_LoadedAssets.end())
+		{
+			m_TextureStreamer.Unregister(request->Handle);
+			m_Residency.OnUnloaded(request->Handle);
+			Application::Get().GetWindow().GetDevice()->DeferRelease(std::move(loadedIt->second));
+		}
+
+		m_LoadedAssets[request->Handle] = asset;
+		m_SlotTable.Publish(request->Handle, asset);
+		m_Residency.OnLoaded(request->Handle, asset.Raw());
+		m_LoadingAssets.erase(request->Handle);
+		RecordContentHash(request->Handle, request->ContentHash);
+
+		// Only the small levels are resident so far; the rest stream in as draws ask for them
+		if (textureCacheKey != 0)
+			m_TextureStreamer.Register(request->Handle, Cast<Texture2D>(asset), textureCacheKey);
+		GX_CORE_INFO("Asynchronously loaded asset: {0}", request->FilePath.string());
 	}
 
-	void EditorAssetManager::ImportAsset(const std::filesystem::path& filePath)
+	AssetHandle EditorAssetManager::ImportAsset(const std::filesystem::path& filePath)
 	{
 		GX_PROFILE_FUNCTION();
 
+		std::filesystem::path relativePath = ToAssetRelativePath(filePath);
+		std::string normalizedPath = NormalizeAssetPath(relativePath);
+		auto indexIt = m_PathIndex.find(normalizedPath);
+		if (indexIt != m_PathIndex.end())
+		{
+			// Overwritten in place, e.g. by a file drop; keep the handle so references stay valid,
+			// and only reimport if the new file differs
+			m_ContentHasher.Enqueue(indexIt->second, Project::GetAssetDirectory() / relativePath);
+			return indexIt->second;
+		}
+
 		AssetMetadata metadata;
-		AssetHandle handle = AssetImporter::GenerateAssetHandle(filePath, &metadata);
+		AssetHandle handle = AssetImporter::GenerateAssetHandle(relativePath, &metadata);
+
+		m_AssetRegistry[handle] = metadata;
+		m_PathIndex[normalizedPath] = handle;
+		m_RegistryStore.Put(handle, metadata);
+
+		// Nobody is waiting on a freshly imported file, so it yields to anything on screen
+		AssetLoadOptions options;
+		options.Priority = LoadPriority::Low;
+		QueueAssetLoad(handle, metadata, options);
+		return handle;
+	}
+
+	uint32_t EditorAssetManager::ImportUnregisteredAssets()
+	{
+		GX_PROFILE_FUNCTION();
+
+		auto start = std::chrono::steady_clock::now();
+		uint32_t skippedCount = 0;
+		std::vector<AssetDirectoryScanner::Entry> entries = AssetDirectoryScanner::Scan(Project::GetAssetDirectory(), &skippedCount);
+
+		m_PathIndex.reserve(m_PathIndex.size() + entries.size());
+		uint32_t registeredCount = 0;
+		for (AssetDirectoryScanner::Entry& entry : entries)
+		{
+			auto [indexIt, inserted] = m_PathIndex.try_emplace(NormalizeAssetPath(entry.FilePath), 0);
+			if (!inserted)
+				continue;
+
+			AssetMetadata metadata;
+			metadata.Type = entry.Type;
+			metadata.FilePath = std::move(entry.FilePath);
+			metadata.LastModifiedTime = entry.LastModifiedTime;
+
+			AssetHandle handle;
+			indexIt->second = handle;
+			m_RegistryStore.Put(handle, metadata);
+			m_AssetRegistry.emplace(handle, std::move(metadata));
+
+			m_BulkImportQueue.push_back(handle);
+			registeredCount++;
+		}
+
+		m_ImportProgress.Total += registeredCount;
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+		GX_CORE_INFO("Scanned {0} asset files in {1} ms: {2} new, {3} of unsupported types skipped",
+			entries.size(), elapsed.count(), registeredCount, skippedCount);
+		return registeredCount;
+	}
 
+	void EditorAssetManager::UpdateBulkImport()
+	{
+		// Enough to keep every worker busy without handing the batcher the whole project at once
+		constexpr size_t MaxBulkImportsInFlight = 256;
+
+		if (!m_ImportProgress.IsRunning())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		// Failed and cancelled loads count as done too; they were reported when they ended
+		size_t inFlightCount = m_BulkImportsInFlight.size();
+		std::erase_if(m_BulkImportsInFlight, [this](AssetHandle handle) { return !m_LoadingAssets.contains(handle); });
+		m_ImportProgress.Completed += static_cast<uint32_t>(inFlightCount - m_BulkImportsInFlight.size());
+
+		// Imported files yield to anything on screen
+		AssetLoadOptions options;
+		options.Priority = LoadPriority::Low;
+
+		while (m_BulkImportsInFlight.size() < MaxBulkImportsInFlight && m_BulkImportNext < m_BulkImportQueue.size())
+		{
+			AssetHandle handle = m_BulkImportQueue[m_BulkImportNext++];
+
+			// Already loaded, or removed again, before its turn came
+			if (!IsAssetHandleValid(handle) || IsAssetLoaded(handle))
+			{
+				m_ImportProgress.Completed++;
+				continue;
+			}
+
+			// Something asked for it first; that load is waited for instead
+			if (!m_LoadingAssets.contains(handle))
+				QueueAssetLoad(handle, m_AssetRegistry.at(handle), options);
+			m_BulkImportsInFlight.push_back(handle);
+		}
+
+		if (!m_ImportProgress.IsRunning())
+		{
+			GX_CORE_INFO("Imported {0} assets", m_ImportProgress.Total);
+			m_BulkImportQueue.clear();
+			m_BulkImportNext = 0;
+			m_ImportProgress = {};
+		}
+	}
+
+	void EditorAssetManager::RequestLoad(AssetHandle handle, const AssetLoadOptions& options)
+	{
+		if (!IsAssetHandleValid(handle) || IsAssetLoaded(handle))
+			return;
+
+		if (options.CancelToken && options.CancelToken->IsCancelled())
+			return;
+
+		auto it = m_LoadingAssets.find(handle);
+		if (it != m_LoadingAssets.end())
+		{
+			AsyncLoadRequest& existing = *it->second;
+
+			// Share the load unless its own requester could still cancel it out from under this one.
+			// Workers never read priority or deadline, so raising them after dispatch is harmless.
+			bool shareable = !existing.CancelToken || existing.CancelToken.Raw() == options.CancelToken.Raw();
+			if (shareable && !existing.IsCancelled())
+			{
+				existing.Priority = std::min(existing.Priority, options.Priority);
+				existing.Deadline = std::min(existing.Deadline, options.Deadline);
+				return;
+			}
+		}
+
+		QueueAssetLoad(handle, GetAssetMetadata(handle), options);
+	}
+
+	void EditorAssetManager::QueueAssetLoad(AssetHandle handle, const AssetMetadata& metadata, const AssetLoadOptions& options)
+	{
 		Ref<AsyncLoadRequest> request = CreateRef<AsyncLoadRequest>();
 		request->Handle = handle;
 		request->FilePath = metadata.FilePath;
+		request->Type = metadata.Type;
 		request->State = AssetState::NotLoaded;
-		request->Priority = LoadPriority::Normal;
+		request->Priority = options.Priority;
+		request->Deadline = options.Deadline;
+		request->CancelToken = options.CancelToken;
+		request->TextureSettings = metadata.TextureSettings;
 
 		m_LoadingAssets[handle] = request;
-		m_AssetRegistry[handle] = metadata;
+		m_LoadBatcher.Enqueue(request);
 
-		AsyncLoadTask* loadTask = new AsyncLoadTask(1); // enkiTS manages this
-		loadTask->LoadRequests.push_back(request);
-		Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(loadTask);
+		// Edges learned on an earlier load let the dependencies start now, alongside the asset,
+		// rather than after the worker has found them again
+		if (GetDependencyPolicy(metadata.Type).Load)
+			RequestDependencies(handle, options.CancelToken);
 	}
 
 	const AssetMetadata& EditorAssetManager::GetAssetMetadata(AssetHandle handle) const
@@ -158,72 +508,158 @@ namespace Gravix
 		return invalidMetadata;
 	}
 
+	void EditorAssetManager::SetTextureImportSettings(AssetHandle handle, const TextureImportSettings& settings)
+	{
+		auto it = m_AssetRegistry.find(handle);
+		if (it == m_AssetRegistry.end() || it->second.Type != AssetType::Texture2D)
+			return;
+
+		if (it->second.TextureSettings == settings)
+			return;
+
+		it->second.TextureSettings = settings;
+		m_RegistryStore.Put(handle, it->second);
+
+		// Recook with the new settings if anything is using the texture
+		ReloadAsset(handle);
+	}
+
 	const std::filesystem::path& EditorAssetManager::GetAssetFilePath(AssetHandle handle) const
 	{
 		return GetAssetMetadata(handle).FilePath;
 	}
 
-	void EditorAssetManager::ClearLoadedAssets()
+	void EditorAssetManager::SetAssetFilePath(AssetHandle handle, const std::filesystem::path& filePath)
 	{
-		// Wait for GPU to finish using all assets before destroying them
-		// This prevents destroying textures/resources that are still in use by command buffers
-		Application::Get().GetWindow().GetDevice()->WaitIdle();
+		auto it = m_AssetRegistry.find(handle);
+		if (it == m_AssetRegistry.end())
+			return;
 
-		m_LoadedAssets.clear();
+		std::string normalizedPath = NormalizeAssetPath(filePath);
+		std::string oldPath = NormalizeAssetPath(it->second.FilePath);
+		if (normalizedPath == oldPath)
+			return;
+
+		auto indexIt = m_PathIndex.find(oldPath);
+		if (indexIt != m_PathIndex.end() && indexIt->second == handle)
+			m_PathIndex.erase(indexIt);
+		m_PathIndex[normalizedPath] = handle;
+
+		it->second.FilePath = ToAssetRelativePath(filePath);
+		m_RegistryStore.Put(handle, it->second);
 	}
 
-	void EditorAssetManager::SerializeAssetRegistry()
+	AssetHandle EditorAssetManager::GetAssetHandle(const std::filesystem::path& filePath) const
+	{
+		auto it = m_PathIndex.find(NormalizeAssetPath(filePath));
+		return it != m_PathIndex.end() ? it->second : AssetHandle(0);
+	}
+
+	std::filesystem::path EditorAssetManager::ToAssetRelativePath(const std::filesystem::path& filePath)
 	{
-		std::filesystem::path registryPath = Project::GetLibraryDirectory() / "AssetRegistry.orbreg";
+		std::filesystem::path path = filePath.is_absolute()
+			? filePath.lexically_relative(Project::GetAssetDirectory())
+			: filePath;
+		return path.lexically_normal();
+	}
+
+	std::string EditorAssetManager::NormalizeAssetPath(const std::filesystem::path& filePath)
+	{
+		std::string normalized = ToAssetRelativePath(filePath).generic_string();
+#ifdef ENGINE_PLATFORM_WINDOWS
+		// Paths differing only in case name the same file here
+		std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+#endif
+		return normalized;
+	}
 
-		YAML::Emitter out;
-		out << YAML::BeginMap;
-		out << YAML::Key << "Assets" << YAML::Value << YAML::BeginSeq;
+	void EditorAssetManager::RebuildPathIndex()
+	{
+		m_PathIndex.clear();
+		m_PathIndex.reserve(m_AssetRegistry.size());
 		for (const auto& [handle, metadata] : m_AssetRegistry)
+			m_PathIndex[NormalizeAssetPath(metadata.FilePath)] = handle;
+	}
+
+	void EditorAssetManager::ClearLoadedAssets()
+	{
+		// Command buffers still in flight may use these, so the device holds them until their fences signal
+		m_TextureStreamer.Clear();
+
+		Device* device = Application::Get().GetWindow().GetDevice();
+		for (auto& [handle, asset] : m_LoadedAssets)
 		{
-			out << YAML::BeginMap;
-			out << YAML::Key << "Handle" << YAML::Value << static_cast<uint64_t>(handle);
-			std::string filePathStr = metadata.FilePath.generic_string();
-			out << YAML::Key << "FilePath" << YAML::Value << filePathStr;
-			out << YAML::Key << "AssetType" << YAML::Value << AssetTypeToString(metadata.Type);
-			out << YAML::Key << "LastModifiedTime" << YAML::Value << metadata.LastModifiedTime;
-			out << YAML::EndMap;
+			m_Residency.OnUnloaded(handle);
+			device->DeferRelease(std::move(asset));
 		}
-		out << YAML::EndSeq;
 
-		std::ofstream fout(registryPath);
-		fout << out.c_str();
+		m_LoadedAssets.clear();
+		m_SlotTable.Clear();
+	}
+
+	void EditorAssetManager::SerializeAssetRegistry()
+	{
+		m_RegistryStore.Flush();
 	}
 
 	void EditorAssetManager::DeserializeAssetRegistry()
 	{
-		std::filesystem::path registryPath = Project::GetLibraryDirectory() / "AssetRegistry.orbreg";
-		if (!std::filesystem::exists(registryPath)) 
+		GX_PROFILE_FUNCTION();
+
+		std::filesystem::path libraryDirectory = Project::GetLibraryDirectory();
+		if (m_RegistryStore.Open(libraryDirectory, m_AssetRegistry))
 		{
-			GX_CORE_WARN("Asset registry file does not exist: {0}", registryPath.string());
+			RebuildPathIndex();
 			return;
 		}
 
-		std::ifstream stream(registryPath);
-		YAML::Node data = YAML::Load(stream);
-
-		YAML::Node assetsNode = data["Assets"];
-		if (assetsNode)
+		// Projects from before the binary registry carry it as YAML; it is converted once and left in place
+		std::filesystem::path legacyRegistryPath = libraryDirectory / "AssetRegistry.orbreg";
+		if (std::filesystem::exists(legacyRegistryPath))
 		{
-			for (const auto& assetNode : assetsNode)
+			std::ifstream stream(legacyRegistryPath);
+			YAML::Node data = YAML::Load(stream);
+
+			YAML::Node assetsNode = data["Assets"];
+			if (assetsNode)
 			{
-				AssetHandle handle = assetNode["Handle"].as<uint64_t>();
-				std::filesystem::path filePath = assetNode["FilePath"].as<std::string>();
-				AssetType type = StringToAssetType(assetNode["AssetType"].as<std::string>());
-				uint64_t lastModifiedTime = assetNode["LastModifiedTime"].as<uint64_t>();
-				AssetMetadata metadata;
-				metadata.FilePath = filePath;
-				metadata.Type = type;
-				metadata.LastModifiedTime = lastModifiedTime;
-
-				m_AssetRegistry[handle] = metadata;
+				for (const auto& assetNode : assetsNode)
+				{
+					AssetHandle handle = assetNode["Handle"].as<uint64_t>();
+					std::filesystem::path filePath = assetNode["FilePath"].as<std::string>();
+					AssetType type = StringToAssetType(assetNode["AssetType"].as<std::string>());
+					uint64_t lastModifiedTime = assetNode["LastModifiedTime"].as<uint64_t>();
+					AssetMetadata metadata;
+					metadata.FilePath = filePath;
+					metadata.Type = type;
+					metadata.LastModifiedTime = lastModifiedTime;
+
+					if (YAML::Node textureNode = assetNode["TextureImport"])
+					{
+						if (textureNode["Compression"])
+							metadata.TextureSettings.Compression = StringToTextureCompression(textureNode["Compression"].as<std::string>());
+						if (textureNode["GenerateMipmaps"])
+							metadata.TextureSettings.GenerateMipmaps = textureNode["GenerateMipmaps"].as<bool>();
+						if (textureNode["MipFilter"])
+							metadata.TextureSettings.MipFilter = StringToTextureMipFilter(textureNode["MipFilter"].as<std::string>());
+						if (textureNode["SRGB"])
+							metadata.TextureSettings.SRGB = textureNode["SRGB"].as<bool>();
+					}
+
+					m_AssetRegistry[handle] = metadata;
+				}
 			}
+
+			GX_CORE_INFO("Converted asset registry to binary: {0} assets", m_AssetRegistry.size());
 		}
+		else
+		{
+			GX_CORE_WARN("Asset registry file does not exist: {0}", (libraryDirectory / "AssetRegistry.gxreg").string());
+		}
+
+		m_RegistryStore.Reset(libraryDirectory, m_AssetRegistry);
+		RebuildPathIndex();
 	}
 
 	bool EditorAssetManager::IsAssetLoaded(AssetHandle handle) const
@@ -231,36 +667,24 @@ namespace Gravix
 		return m_LoadedAssets.contains(handle);
 	}
 
+	bool EditorAssetManager::IsAssetLoading(AssetHandle handle) const
+	{
+		return m_LoadingAssets.contains(handle);
+	}
+
 	Ref<Asset> EditorAssetManager::GetAsset(AssetHandle handle)
 	{
 		if(!IsAssetHandleValid(handle))
 			return nullptr;
 
-		AssetMetadata metadata = GetAssetMetadata(handle);
-		if(m_LoadingAssets.contains(handle))
-		{
-			GX_CORE_INFO("Asset is still loading: {0}", metadata.FilePath.string());
-			return nullptr; // Asset is still loading
-		}
-
 		if (IsAssetLoaded(handle))
 		{
+			m_Residency.Touch(handle);
 			return m_LoadedAssets.at(handle);
 		}
 
-		Ref<AsyncLoadRequest> request = CreateRef<AsyncLoadRequest>();
-		request->Handle = handle;
-		request->FilePath = metadata.FilePath;
-		request->State = AssetState::NotLoaded;
-		request->Priority = LoadPriority::Normal;
-
-		m_LoadingAssets[handle] = request;
-		m_AssetRegistry[handle] = metadata;
-
-		AsyncLoadTask* loadTask = new AsyncLoadTask(1); // enkiTS manages this
-		loadTask->LoadRequests.push_back(request);
-		Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(loadTask);
-		return nullptr;
+		RequestLoad(handle);
+		return nullptr; // Asset is still loading
 	}
 
 	// File Watching Implementation
@@ -291,7 +715,7 @@ namespace Gravix
 	{
 		if (m_FileWatcher)
 		{
-			// Check for file changes (polling)
+			// Check for file changes
 			m_FileWatcher->CheckForChanges();
 			// Process pending changes
 			m_FileWatcher->ProcessChanges();
@@ -300,26 +724,17 @@ namespace Gravix
 
 	void EditorAssetManager::OnAssetChanged(const AssetChangeInfo& changeInfo)
 	{
-		// Find asset handle for this file path
-		AssetHandle changedHandle = 0;
-		for (const auto& [handle, metadata] : m_AssetRegistry)
-		{
-			if (metadata.FilePath == changeInfo.FilePath)
-			{
-				changedHandle = handle;
-				break;
-			}
-		}
+		AssetHandle changedHandle = GetAssetHandle(changeInfo.FilePath);
+		MappedFileCache::Evict(Project::GetAssetDirectory() / ToAssetRelativePath(changeInfo.FilePath));
 
 		switch (changeInfo.Event)
 		{
 		case AssetWatchEvent::Modified:
 		{
+			// A newer timestamp alone proves nothing (touch, checkout, save without changes), so
+			// the file is hashed on a worker before anything is reimported
 			if (changedHandle != 0)
-			{
-				GX_CORE_INFO("Asset modified: {0}", changeInfo.FilePath.filename().string());
-				ReloadAsset(changedHandle);
-			}
+				m_ContentHasher.Enqueue(changedHandle, Project::GetAssetDirectory() / GetAssetFilePath(changedHandle));
 			break;
 		}
 		case AssetWatchEvent::Removed:
@@ -328,7 +743,11 @@ namespace Gravix
 			{
 				GX_CORE_INFO("Asset removed: {0}", changeInfo.FilePath.filename().string());
 				UnloadAsset(changedHandle);
+				m_SlotTable.Release(changedHandle);
 				m_AssetRegistry.erase(changedHandle);
+				m_PathIndex.erase(NormalizeAssetPath(changeInfo.FilePath));
+				m_DependencyGraph.RemoveAsset(changedHandle);
+				m_RegistryStore.Remove(changedHandle);
 			}
 			break;
 		}
@@ -342,7 +761,63 @@ namespace Gravix
 		}
 	}
 
+	void EditorAssetManager::ProcessContentHashes()
+	{
+		m_ContentHashResultsCache.clear();
+		m_ContentHasher.Update(m_ContentHashResultsCache);
+
+		for (const AssetContentHasher::Result& result : m_ContentHashResultsCache)
+		{
+			// Removed while it was being hashed
+			auto it = m_AssetRegistry.find(result.Handle);
+			if (it == m_AssetRegistry.end())
+				continue;
+
+			AssetMetadata& metadata = it->second;
+			bool unchanged = result.ContentHash != 0 && result.ContentHash == metadata.ContentHash;
+			metadata.LastModifiedTime = result.LastModifiedTime;
+			metadata.ContentHash = result.ContentHash;
+			m_RegistryStore.Put(result.Handle, metadata);
+
+			if (unchanged)
+			{
+				GX_CORE_TRACE("Asset touched but unchanged, not reimporting: {0}", metadata.FilePath.string());
+				continue;
+			}
+
+			GX_CORE_INFO("Asset modified: {0}", metadata.FilePath.filename().string());
+			ReloadAsset(result.Handle);
+		}
+	}
+
+	void EditorAssetManager::RecordContentHash(AssetHandle handle, uint64_t contentHash)
+	{
+		auto it = m_AssetRegistry.find(handle);
+		if (contentHash == 0 || it == m_AssetRegistry.end() || it->second.ContentHash == contentHash)
+			return;
+
+		it->second.ContentHash = contentHash;
+		m_RegistryStore.Put(handle, it->second);
+	}
+
 	void EditorAssetManager::ReloadAsset(AssetHandle handle)
+	{
+		QueueReload(handle);
+
+		// Whatever baked this asset in when it was created is rebuilt too, e.g. the shaders
+		// importing a changed .slang file and the materials built from those shaders. Dependents
+		// come after their dependencies, and materials wait for the new shader to land.
+		std::vector<AssetHandle> dependents;
+		m_DependencyGraph.CollectDependents(handle, dependents, [this](AssetHandle dependent)
+			{
+				return GetDependencyPolicy(GetAssetType(dependent)).Rebuild;
+			});
+
+		for (AssetHandle dependent : dependents)
+			QueueReload(dependent);
+	}
+
+	void EditorAssetManager::QueueReload(AssetHandle handle)
 	{
 		// Check if asset is loaded
 		auto it = m_LoadedAssets.find(handle);
@@ -357,15 +832,11 @@ namespace Gravix
 
 		GX_CORE_INFO("Reloading asset: {0} ({1})", metadata.FilePath.filename().string(), AssetTypeToString(metadata.Type));
 
-		// Unload old asset (this will destroy Vulkan resources)
-		UnloadAsset(handle);
-
-		// Wait a bit for GPU operations to complete
-		// TODO: Better synchronization with rendering system
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
-		// Reload asset asynchronously
-		GetAsset(handle);
+		// The old asset stays published until the new one is ready, so nothing draws a hole
+		// in between; ProcessAsyncLoads swaps them and defers the old one's destruction
+		AssetLoadOptions options;
+		options.Priority = LoadPriority::High;
+		QueueAssetLoad(handle, metadata, options);
 	}
 
 	void EditorAssetManager::UnloadAsset(AssetHandle handle)
@@ -374,10 +845,32 @@ namespace Gravix
 		if (it != m_LoadedAssets.end())
 		{
 			// Asset destructor will clean up Vulkan resources
-			// (Texture, Material, Mesh all have proper destructors)
+			// (Texture, Material, Mesh all have proper destructors) once the GPU is done with them
+			m_TextureStreamer.Unregister(handle);
+			Application::Get().GetWindow().GetDevice()->DeferRelease(std::move(it->second));
 			m_LoadedAssets.erase(it);
+			m_SlotTable.Evict(handle);
+			m_Residency.OnUnloaded(handle);
 			GX_CORE_INFO("Asset unloaded: {0}", (uint64_t)handle);
 		}
 	}
 
+	void EditorAssetManager::EnforceResidencyBudget()
+	{
+		const std::vector<AssetHandle>& evictions = m_Residency.SelectEvictions();
+		if (evictions.empty())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		// Copied because unloading feeds back into the residency tracker
+		std::vector<AssetHandle> handles = evictions;
+		for (AssetHandle handle : handles)
+			UnloadAsset(handle);
+
+		const AssetResidencyStats& stats = m_Residency.GetStats();
+		GX_CORE_INFO("Evicted {0} assets to stay within budget ({1} MB CPU, {2} MB GPU resident)", handles.size(),
+			stats.Total.CPUBytes / (1024 * 1024), stats.Total.GPUBytes / (1024 * 1024));
+	}
+
 }
\ No newline at end of file
@@ -3,36 +3,75 @@
 #include "AssetManagerBase.h"
 #include "AssetMetadata.h"
 #include "AssetFileWatcher.h"
+#include "AssetContentHasher.h"
+#include "AssetLoadBatcher.h"
+#include "AssetDependencyGraph.h"
+#include "AssetRegistryStore.h"
+#include "TextureStreamer.h"
 
-#include <mutex>
-#include <queue>
+#include <chrono>
+#include <deque>
 
 namespace Gravix
 {
 
-	using AssetRegistry = std::map<AssetHandle, AssetMetadata>;
+	// Files registered by ImportUnregisteredAssets and how many of them have finished loading
+	struct AssetImportProgress
+	{
+		uint32_t Total = 0;
+		uint32_t Completed = 0;
+
+		bool IsRunning() const { return Completed < Total; }
+	};
 
 	class EditorAssetManager : public AssetManagerBase
 	{
 	public:
 		virtual Ref<Asset> GetAsset(AssetHandle handle) override;
+		virtual void RequestLoad(AssetHandle handle, const AssetLoadOptions& options = {}) override;
 
 		virtual bool IsAssetLoaded(AssetHandle handle) const override;
+		virtual bool IsAssetLoading(AssetHandle handle) const override;
 		virtual bool IsAssetHandleValid(AssetHandle handle) const override;
 		virtual AssetType GetAssetType(AssetHandle handle) const override;
 
 		virtual void PushToCompletionQueue(Ref<AsyncLoadRequest> request) override;
 		virtual void ProcessAsyncLoads() override;
+		virtual void ProcessCompletedLoads() override;
 
-		void ImportAsset(const std::filesystem::path& filePath);
+		// Registers the file and starts loading it. A path that is already registered keeps its
+		// handle and is reloaded instead. Accepts absolute or asset directory relative paths.
+		AssetHandle ImportAsset(const std::filesystem::path& filePath);
+		// Registers every file in the asset directory that is not registered yet in one pass, then
+		// loads them over the following frames. Returns how many files were registered.
+		uint32_t ImportUnregisteredAssets();
+		const AssetImportProgress& GetImportProgress() const { return m_ImportProgress; }
 
 		const AssetMetadata& GetAssetMetadata(AssetHandle handle) const;
 		const AssetRegistry& GetAssetRegistry() const { return m_AssetRegistry; }
 
 		const std::filesystem::path& GetAssetFilePath(AssetHandle handle) const;
+		// 0 when nothing is registered at the path. Accepts absolute or asset directory relative paths.
+		AssetHandle GetAssetHandle(const std::filesystem::path& filePath) const;
+		// For moves and renames done in the editor; the file itself must already be at the new path
+		void SetAssetFilePath(AssetHandle handle, const std::filesystem::path& filePath);
+
+		// Saves the settings and recooks the texture if it is loaded
+		void SetTextureImportSettings(AssetHandle handle, const TextureImportSettings& settings);
 
 		void ClearLoadedAssets();
 
+		// Main thread time ProcessAsyncLoads spends creating loaded assets per frame; whatever does
+		// not fit waits for the next frame. At least one asset is created every frame.
+		void SetPublishTimeBudget(std::chrono::microseconds budget) { m_PublishTimeBudget = budget; }
+
+		// Budget applies from the next frame; evictions happen in ProcessAsyncLoads
+		void SetResidencyBudget(const AssetResidencyBudget& budget) { m_Residency.SetBudget(budget); }
+		// Device memory streamed texture levels may take together
+		void SetTextureStreamingBudget(uint64_t bytes) { m_TextureStreamer.SetBudget(bytes); }
+		const TextureStreamingStats& GetTextureStreamingStats() const { return m_TextureStreamer.GetStats(); }
+
+		// Hands registry changes to the background writer; ProcessAsyncLoads does this every frame
 		void SerializeAssetRegistry();
 		void DeserializeAssetRegistry();
 
@@ -42,21 +81,81 @@ namespace Gravix
 		void ProcessAssetChanges(); // Call from update loop
 	private:
 		void OnAssetChanged(const AssetChangeInfo& changeInfo);
+		// Reimports the files whose content really changed; the rest only get their new timestamp
+		void ProcessContentHashes();
+		void RecordContentHash(AssetHandle handle, uint64_t contentHash);
+		// Reloads the asset if loaded, then every loaded asset that baked it in
 		void ReloadAsset(AssetHandle handle);
+		void QueueReload(AssetHandle handle);
 		void UnloadAsset(AssetHandle handle);
+		void EnforceResidencyBudget();
+		// Retires finished bulk imports and tops the loads in flight back up
+		void UpdateBulkImport();
+
+		// Relative to the asset directory and lexically normal, as stored in metadata
+		static std::filesystem::path ToAssetRelativePath(const std::filesystem::path& filePath);
+		// Key for m_PathIndex: the relative path '/' separated, and case folded where the filesystem ignores case
+		static std::string NormalizeAssetPath(const std::filesystem::path& filePath);
+		void RebuildPathIndex();
+
+		// Registers the request as in flight and hands it to the batcher for the next flush
+		void QueueAssetLoad(AssetHandle handle, const AssetMetadata& metadata, const AssetLoadOptions& options);
+
+		// How an asset type uses what it references
+		struct DependencyPolicy
+		{
+			bool Load;    // Loading the asset loads its dependencies
+			bool Wait;    // The asset is only created once none of them is still loading
+			bool Rebuild; // The asset is reloaded when one of them changes
+		};
+		static DependencyPolicy GetDependencyPolicy(AssetType type);
+
+		// Records the edges a worker found and requests the dependencies that have to load
+		void LinkDependencies(const Ref<AsyncLoadRequest>& request);
+		void RequestDependencies(AssetHandle handle, const Ref<LoadCancellationToken>& cancelToken);
+		bool IsWaitingOnDependencies(AssetHandle handle) const;
+		void ProcessWaitingRequests();
+		// Creates ready assets, most urgent first, until the deadline passes
+		void PublishReadyRequests(std::chrono::steady_clock::time_point deadline);
+		void ProcessLoads(bool withinBudget);
+
+		void ProcessCompletedRequest(const Ref<AsyncLoadRequest>& request);
+		void CancelAsyncLoad(const Ref<AsyncLoadRequest>& request);
+		// Creates the asset from a request that is ready for the GPU and publishes it
+		void FinishAsyncLoad(const Ref<AsyncLoadRequest>& request);
 
 	private:
 		AssetRegistry m_AssetRegistry;
+		AssetRegistryStore m_RegistryStore;
+		// Reverse of m_AssetRegistry, so file events and path lookups never scan the registry
+		std::unordered_map<std::string, AssetHandle> m_PathIndex;
 		AssetMap m_LoadedAssets;
 
 		std::unordered_map<AssetHandle, Ref<AsyncLoadRequest>> m_LoadingAssets;
-		std::queue<Ref<AsyncLoadRequest>> m_CompletionQueue;
-		std::mutex m_CompletionQueueMutex;
+		AssetLoadBatcher m_LoadBatcher;
+
+		AssetDependencyGraph m_DependencyGraph;
+		// Read by a worker, waiting for dependencies before the asset is created; still in m_LoadingAssets
+		std::vector<Ref<AsyncLoadRequest>> m_WaitingRequests;
+		// CPU work done and dependencies published, waiting for a turn within the frame's budget
+		std::deque<Ref<AsyncLoadRequest>> m_ReadyRequests;
+		std::chrono::microseconds m_PublishTimeBudget{ 4000 };
+
+		TextureStreamer m_TextureStreamer;
+
+		// Registered by ImportUnregisteredAssets, waiting for their turn to load
+		std::vector<AssetHandle> m_BulkImportQueue;
+		size_t m_BulkImportNext = 0;
+		std::vector<AssetHandle> m_BulkImportsInFlight;
+		AssetImportProgress m_ImportProgress;
 
-		// Reused vector to avoid allocations in ProcessAsyncLoads
+		// Reused vectors to avoid allocations in ProcessAsyncLoads
 		std::vector<Ref<AsyncLoadRequest>> m_CompletedRequestsCache;
+		std::vector<AssetHandle> m_StreamedTexturesCache;
 
 		// File watcher
 		Scope<AssetFileWatcher> m_FileWatcher;
+		AssetContentHasher m_ContentHasher;
+		std::vector<AssetContentHasher::Result> m_ContentHashResultsCache;
 	};
 }
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "Renderer/Generic/Types/Shader.h"
 #include "Renderer/Generic/Types/Pipeline.h"
 
-#include "Asset/EditorAssetManager.h"
+#include "Asset/AssetManager.h"
+#include "Core/MappedFileCache.h"
+#include "Core/MemoryStream.h"
 #include "Project/Project.h"
 
 #include <yaml-cpp/yaml.h>
@@ -17,13 +19,16 @@ namespace Gravix
 	{
 		std::filesystem::path fullPath = Project::GetAssetDirectory() / metadata.FilePath;
 
-		if (!std::filesystem::exists(fullPath))
+		// An async load still holds the mapping its dependency scan read, so this is the same one
+		Ref<MappedFile> file = MappedFileCache::Open(fullPath);
+		if (!file)
 		{
 			GX_CORE_ERROR("Material file not found: {0}", fullPath.string());
 			return nullptr;
 		}
 
-		YAML::Node data = YAML::LoadFile(fullPath.string());
+		MemoryInputStream stream(file->GetData(), file->GetSize());
+		YAML::Node data = YAML::Load(stream);
 
 		if (!data["Material"])
 		{
@@ -43,18 +48,20 @@ namespace Gravix
 		AssetHandle shaderHandle = materialNode["Shader"].as<uint64_t>();
 		AssetHandle pipelineHandle = materialNode["Pipeline"].as<uint64_t>();
 
-		// Load Shader and Pipeline assets through AssetManager
-		// This ensures they are compiled/loaded before the Material is created
-		auto assetManager = Project::GetActive()->GetEditorAssetManager();
+		// The asset manager loads both ahead of the material, so these waits normally return at once;
+		// a dependency evicted or reloaded in between is finished here instead of failing the material
+		AssetFuture<Shader> shaderFuture = AssetManager::LoadAsync<Shader>(shaderHandle);
+		AssetFuture<Pipeline> pipelineFuture = AssetManager::LoadAsync<Pipeline>(pipelineHandle);
+		WhenAll(shaderFuture, pipelineFuture).Wait();
 
-		Ref<Shader> shader = assetManager->GetAsset(shaderHandle);
+		Ref<Shader> shader = shaderFuture.Get();
 		if (!shader)
 		{
 			GX_CORE_ERROR("Failed to load shader for material: {0}", fullPath.string());
 			return nullptr;
 		}
 
-		Ref<Pipeline> pipeline = assetManager->GetAsset(pipelineHandle);
+		Ref<Pipeline> pipeline = pipelineFuture.Get();
 		if (!pipeline)
 		{
 			GX_CORE_ERROR("Failed to load pipeline for material: {0}", fullPath.string());
@@ -75,6 +82,30 @@ namespace Gravix
 		return material;
 	}
 
+	std::vector<AssetHandle> MaterialImporter::ReadDependencies(const MappedFile& file)
+	{
+		std::vector<AssetHandle> dependencies;
+
+		try
+		{
+			MemoryInputStream stream(file.GetData(), file.GetSize());
+			YAML::Node materialNode = YAML::Load(stream)["Material"];
+			if (!materialNode)
+				return dependencies;
+
+			if (materialNode["Shader"])
+				dependencies.push_back(materialNode["Shader"].as<uint64_t>());
+			if (materialNode["Pipeline"])
+				dependencies.push_back(materialNode["Pipeline"].as<uint64_t>());
+		}
+		catch (const YAML::Exception& e)
+		{
+			GX_CORE_ERROR("Failed to read material dependencies from {0}: {1}", file.GetPath().string(), e.what());
+		}
+
+		return dependencies;
+	}
+
 	void MaterialImporter::ExportMaterial(const std::filesystem::path& path, AssetHandle shaderHandle, AssetHandle pipelineHandle)
 	{
 		YAML::Emitter out;
@@ -88,6 +119,8 @@ namespace Gravix
 		out << YAML::EndMap; // Material
 		out << YAML::EndMap;
 
+		// Unmap it first, in case it was read recently
+		MappedFileCache::Evict(path);
 		std::ofstream fout(path);
 		fout << out.c_str();
 		fout.close();
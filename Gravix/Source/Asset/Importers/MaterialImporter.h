@@ -2,6 +2,7 @@
 
 #include "Asset/Asset.h"
 #include "Asset/AssetMetadata.h"
+#include "Core/MappedFile.h"
 
 #include "Renderer/Generic/Types/Material.h"
 #include "Renderer/Generic/Types/Framebuffer.h"
@@ -17,6 +18,10 @@ namespace Gravix
 		// Note: Call SetFramebuffer() on the material before using it for rendering
 		static Ref<Material> ImportMaterial(AssetHandle handle, const AssetMetadata& metadata);
 
+		// Shader and pipeline handles the material file references, without loading either.
+		// Safe to call from a worker.
+		static std::vector<AssetHandle> ReadDependencies(const MappedFile& file);
+
 		// Export material to .orbmat YAML file
 		static void ExportMaterial(const std::filesystem::path& path, AssetHandle shaderHandle, AssetHandle pipelineHandle);
 
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "PipelineImporter.h"
 
+#include "Core/MappedFileCache.h"
+#include "Core/MemoryStream.h"
 #include "Project/Project.h"
 #include <yaml-cpp/yaml.h>
 #include <fstream>
@@ -139,13 +141,15 @@ namespace Gravix
 	{
 		std::filesystem::path fullPath = Project::GetAssetDirectory() / metadata.FilePath;
 
-		if (!std::filesystem::exists(fullPath))
+		Ref<MappedFile> file = MappedFileCache::Open(fullPath);
+		if (!file)
 		{
 			GX_CORE_ERROR("Pipeline file not found: {0}", fullPath.string());
 			return nullptr;
 		}
 
-		YAML::Node data = YAML::LoadFile(fullPath.string());
+		MemoryInputStream stream(file->GetData(), file->GetSize());
+		YAML::Node data = YAML::Load(stream);
 
 		if (!data["Pipeline"])
 		{
@@ -219,6 +223,7 @@ namespace Gravix
 		out << YAML::EndMap; // Pipeline
 		out << YAML::EndMap;
 
+		MappedFileCache::Evict(path);
 		std::ofstream fout(path);
 		fout << out.c_str();
 		fout.close();
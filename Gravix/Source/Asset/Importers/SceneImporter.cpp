@@ -18,15 +18,22 @@ namespace Gravix
 		return scene;
 	}
 
-	YAML::Node SceneImporter::LoadSceneToYAML(const std::filesystem::path& path, std::vector<AssetHandle>* outDependencies /*= nullptr*/)
+	Ref<ParsedScene> SceneImporter::ParseScene(const std::filesystem::path& path)
+	{
+		Ref<ParsedScene> parsedScene = CreateRef<ParsedScene>();
+		if (!SceneSerializer::Parse(path, *parsedScene))
+			return nullptr;
+
+		return parsedScene;
+	}
+
+	Ref<Scene> SceneImporter::InstantiateScene(const ParsedScene& parsedScene)
 	{
 		Ref<Scene> scene = CreateRef<Scene>();
 		SceneSerializer serializer(scene);
-		YAML::Node node; 
-		serializer.Deserialize(path, &node);
+		serializer.Instantiate(parsedScene);
 
-		scene->ExtractSceneDependencies(outDependencies);
-		return node;
+		return scene;
 	}
 
 }
\ No newline at end of file
@@ -4,19 +4,22 @@
 
 #include "Asset/Asset.h"
 #include "Asset/AssetMetadata.h"
+#include "Serialization/Scene/ParsedScene.h"
 
-#include <yaml-cpp/yaml.h>
 #include <filesystem>
-#include <vector>
 
 namespace Gravix
 {
+	class Scene;
+
 	class SceneImporter
 	{
 	public:
 		static Ref<Asset> ImportScene(AssetHandle handle, const AssetMetadata& metadata);
 
-		static YAML::Node LoadSceneToYAML(const std::filesystem::path& path, std::vector<AssetHandle>* outDependencies = nullptr);
+		// The two halves of ImportScene: parsing is safe on a worker, instantiating is main thread only
+		static Ref<ParsedScene> ParseScene(const std::filesystem::path& path);
+		static Ref<Scene> InstantiateScene(const ParsedScene& parsedScene);
 	};
 }
 
@@ -2,12 +2,10 @@
 #include "ShaderImporter.h"
 
 #include "Utils/ShaderCompilerSystem.h"
+#include "Core/MappedFileCache.h"
 #include "Project/Project.h"
 #include "Reflections/ShaderReflection.h"
 
-#include <fstream>
-#include <sstream>
-
 namespace Gravix
 {
 
@@ -84,17 +82,15 @@ namespace Gravix
 
 	ShaderType ShaderImporter::DetectShaderType(const std::filesystem::path& shaderPath)
 	{
-		// Open file and check for compute shader entry point or keywords
-		std::ifstream file(shaderPath);
-		if (!file.is_open())
+		// Check the source for compute shader entry points or keywords; the compiler reads the same mapping next
+		Ref<MappedFile> file = MappedFileCache::Open(shaderPath);
+		if (!file)
 		{
 			GX_CORE_WARN("Could not open shader file for type detection: {0}", shaderPath.string());
 			return ShaderType::Graphics; // Default to graphics
 		}
 
-		std::stringstream buffer;
-		buffer << file.rdbuf();
-		std::string content = buffer.str();
+		std::string_view content = file->GetText();
 
 		// Check for compute shader indicators
 		if (content.find("[shader(\"compute\")]") != std::string::npos ||
@@ -118,4 +114,54 @@ namespace Gravix
 		return ShaderType::Graphics;
 	}
 
+	std::vector<std::filesystem::path> ShaderImporter::ReadImportedFiles(const MappedFile& file)
+	{
+		std::vector<std::filesystem::path> importedFiles;
+
+		std::filesystem::path directory = file.GetPath().parent_path();
+		std::string_view source = file.GetText();
+		while (!source.empty())
+		{
+			size_t lineEnd = source.find('\n');
+			std::string_view line = source.substr(0, lineEnd);
+			source.remove_prefix(lineEnd == std::string_view::npos ? source.size() : lineEnd + 1);
+
+			size_t start = line.find_first_not_of(" \t");
+			if (start == std::string_view::npos)
+				continue;
+
+			std::string_view text = line.substr(start);
+			std::filesystem::path importedFile;
+			if (text.starts_with("#include") || text.starts_with("__include") || text.starts_with("import "))
+			{
+				size_t open = text.find('"');
+				size_t close = open != std::string_view::npos ? text.find('"', open + 1) : std::string_view::npos;
+				if (close != std::string_view::npos)
+				{
+					// Quoted: a path relative to the including file
+					importedFile = directory / std::string(text.substr(open + 1, close - open - 1));
+				}
+				else if (!text.starts_with("#include"))
+				{
+					// Module name: dots separate directories, e.g. "import lighting.brdf;"
+					size_t nameStart = text.find(' ');
+					size_t nameEnd = text.find(';');
+					if (nameStart == std::string_view::npos || nameEnd == std::string_view::npos || nameEnd <= nameStart)
+						continue;
+
+					std::string moduleName(text.substr(nameStart + 1, nameEnd - nameStart - 1));
+					moduleName.erase(std::remove_if(moduleName.begin(), moduleName.end(), [](unsigned char c) { return std::isspace(c); }), moduleName.end());
+					std::replace(moduleName.begin(), moduleName.end(), '.', '/');
+					importedFile = directory / (moduleName + ".slang");
+				}
+			}
+
+			std::error_code error;
+			if (!importedFile.empty() && std::filesystem::is_regular_file(importedFile, error))
+				importedFiles.push_back(importedFile.lexically_normal());
+		}
+
+		return importedFiles;
+	}
+
 }
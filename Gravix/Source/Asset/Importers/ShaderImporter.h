@@ -2,6 +2,7 @@
 
 #include "Asset/Asset.h"
 #include "Asset/AssetMetadata.h"
+#include "Core/MappedFile.h"
 #include "Renderer/Generic/Types/Shader.h"
 
 namespace Gravix
@@ -20,6 +21,10 @@ namespace Gravix
 
 		// Determine shader type from file or metadata
 		static ShaderType DetectShaderType(const std::filesystem::path& shaderPath);
+
+		// Existing files the shader pulls in through import, __include or #include, resolved
+		// next to the shader the way the compiler looks them up. Safe to call from a worker.
+		static std::vector<std::filesystem::path> ReadImportedFiles(const MappedFile& file);
 	};
 
 }
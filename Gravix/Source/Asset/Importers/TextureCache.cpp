@@ -0,0 +1,261 @@
+#include "pch.h"
+#include "TextureCache.h"
+
+#include "TextureImporter.h"
+
+#include "Core/Hash.h"
+#include "Core/MappedFile.h"
+#include "Core/MappedFileCache.h"
+#include "Core/UUID.h"
+#include "Project/Project.h"
+#include "Renderer/Generic/Types/Texture.h"
+
+#include <fstream>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		constexpr char TextureCacheSignature[4] = { 'G', 'T', 'E', 'X' };
+
+		uint64_t ComputeSettingsSeed(const TextureImportSettings& settings)
+		{
+			// Packed field by field so padding never leaks into the key
+			uint32_t fields[5] = {
+				TextureCache::TextureCacheVersion,
+				static_cast<uint32_t>(settings.Compression),
+				settings.GenerateMipmaps ? 1u : 0u,
+				static_cast<uint32_t>(settings.MipFilter),
+				settings.SRGB ? 1u : 0u
+			};
+			return Hash::Compute64(fields, sizeof(fields));
+		}
+
+		std::filesystem::path GetEntryPath(uint64_t key)
+		{
+			return TextureCache::GetCacheDirectory() / fmt::format("{:016x}.gtex", key);
+		}
+
+		CookedTexture2D CookErrorTexture()
+		{
+			int width, height, channels;
+			Buffer pixels = TextureImporter::CreateErrorTexture2D(&width, &height, &channels);
+
+			CookedTexture2D cooked;
+			cooked.Data = pixels;
+			cooked.Width = static_cast<uint32_t>(width);
+			cooked.Height = static_cast<uint32_t>(height);
+			return cooked;
+		}
+
+		uint64_t GetLevelSize(const CookedTexture2D& cooked, uint32_t mip)
+		{
+			return GetTextureLevelSize(cooked.Format, std::max(cooked.Width >> mip, 1u), std::max(cooked.Height >> mip, 1u));
+		}
+
+		// Offset of a level from the start of the level data
+		uint64_t GetLevelOffset(const CookedTexture2D& cooked, uint32_t mip)
+		{
+			return GetTextureMipChainSize(cooked.Format, cooked.Width, cooked.Height, mip);
+		}
+
+		// Reads levels from firstMip down, or from the first no larger than maxDimension if that is smaller,
+		// verifying only the levels it reads
+		bool ReadEntry(const std::filesystem::path& path, uint64_t key, uint32_t firstMip, uint32_t maxDimension, CookedTexture2D& outCooked)
+		{
+			std::error_code error;
+			if (!std::filesystem::is_regular_file(path, error))
+				return false;
+
+			MappedFile file;
+			if (!file.Open(path) || file.GetSize() < sizeof(TextureCacheHeader))
+				return false;
+
+			TextureCacheHeader header;
+			std::memcpy(&header, file.GetData(), sizeof(header));
+
+			TextureFormat format = static_cast<TextureFormat>(header.Format);
+			uint64_t tableSize = static_cast<uint64_t>(header.MipLevels) * sizeof(uint64_t);
+			bool valid = std::memcmp(header.Signature, TextureCacheSignature, sizeof(TextureCacheSignature)) == 0
+				&& header.Version == TextureCache::TextureCacheVersion
+				&& header.Key == key
+				&& format <= TextureFormat::BC4
+				&& header.MipLevels > 0 && header.MipLevels <= GetFullMipChainLevels(header.Width, header.Height)
+				&& header.DataSize == GetTextureMipChainSize(format, header.Width, header.Height, header.MipLevels)
+				&& file.GetSize() == sizeof(TextureCacheHeader) + tableSize + header.DataSize;
+			if (!valid)
+			{
+				GX_CORE_WARN("Ignoring invalid texture cache entry: {}", path.string());
+				return false;
+			}
+
+			const uint8_t* table = file.GetData() + sizeof(TextureCacheHeader);
+			const uint8_t* data = table + tableSize;
+			if (Hash::Compute64(table, tableSize) != header.TableChecksum)
+			{
+				GX_CORE_WARN("Texture cache entry is corrupt: {}", path.string());
+				return false;
+			}
+
+			outCooked.Width = header.Width;
+			outCooked.Height = header.Height;
+			outCooked.Format = format;
+			outCooked.MipLevels = header.MipLevels;
+			outCooked.FirstMip = std::max(std::min(firstMip, header.MipLevels - 1),
+				GetFirstMipWithin(header.Width, header.Height, header.MipLevels, maxDimension));
+
+			for (uint32_t mip = outCooked.FirstMip; mip < header.MipLevels; mip++)
+			{
+				uint64_t levelChecksum;
+				std::memcpy(&levelChecksum, table + mip * sizeof(uint64_t), sizeof(levelChecksum));
+
+				if (Hash::Compute64(data + GetLevelOffset(outCooked, mip), GetLevelSize(outCooked, mip)) != levelChecksum)
+				{
+					GX_CORE_WARN("Texture cache entry is corrupt: {}", path.string());
+					return false;
+				}
+			}
+
+			uint64_t offset = GetLevelOffset(outCooked, outCooked.FirstMip);
+			uint64_t size = header.DataSize - offset;
+			outCooked.Data.Allocate(size);
+			std::memcpy(outCooked.Data.Data, data + offset, size);
+			return true;
+		}
+
+		void WriteEntry(const std::filesystem::path& path, uint64_t key, const CookedTexture2D& cooked)
+		{
+			TextureCacheHeader header{};
+			std::memcpy(header.Signature, TextureCacheSignature, sizeof(TextureCacheSignature));
+			header.Version = TextureCache::TextureCacheVersion;
+			header.Key = key;
+			header.Width = cooked.Width;
+			header.Height = cooked.Height;
+			header.Format = static_cast<uint32_t>(cooked.Format);
+			header.MipLevels = cooked.MipLevels;
+			header.DataSize = GetTextureMipChainSize(cooked.Format, cooked.Width, cooked.Height, cooked.MipLevels);
+
+			std::vector<uint64_t> levelChecksums(cooked.MipLevels);
+			for (uint32_t mip = 0; mip < cooked.MipLevels; mip++)
+				levelChecksums[mip] = Hash::Compute64(cooked.Data.Data + GetLevelOffset(cooked, mip), GetLevelSize(cooked, mip));
+			header.TableChecksum = Hash::Compute64(levelChecksums.data(), levelChecksums.size() * sizeof(uint64_t));
+
+			// Written aside and renamed into place, so readers and other workers cooking the
+			// same image never see a partial file
+			std::filesystem::path tempPath = path;
+			tempPath += fmt::format(".{}.tmp", UUID().ToString());
+
+			std::error_code error;
+			std::filesystem::create_directories(path.parent_path(), error);
+
+			{
+				std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+				out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				out.write(reinterpret_cast<const char*>(levelChecksums.data()), static_cast<std::streamsize>(levelChecksums.size() * sizeof(uint64_t)));
+				out.write(reinterpret_cast<const char*>(cooked.Data.Data), static_cast<std::streamsize>(header.DataSize));
+				if (!out)
+				{
+					GX_CORE_WARN("Failed to write texture cache entry: {}", path.string());
+					out.close();
+					std::filesystem::remove(tempPath, error);
+					return;
+				}
+			}
+
+			std::filesystem::rename(tempPath, path, error);
+			if (error)
+			{
+				GX_CORE_WARN("Failed to store texture cache entry {}: {}", path.string(), error.message());
+				std::filesystem::remove(tempPath, error);
+			}
+		}
+
+		// Drops the levels above firstMip from a whole chain
+		void TrimLevels(CookedTexture2D& cooked, uint32_t firstMip)
+		{
+			if (firstMip == 0)
+				return;
+
+			uint64_t offset = GetLevelOffset(cooked, firstMip);
+			Buffer trimmed;
+			trimmed.Allocate(cooked.Data.Size - offset);
+			std::memcpy(trimmed.Data, cooked.Data.Data + offset, trimmed.Size);
+
+			cooked.Data.Release();
+			cooked.Data = trimmed;
+			cooked.FirstMip = firstMip;
+		}
+
+		CookedTexture2D LoadLevels(const std::filesystem::path& sourcePath, const TextureImportSettings& settings, uint32_t maxDimension,
+			uint64_t& outKey, uint64_t& outContentHash)
+		{
+			outKey = 0;
+			outContentHash = 0;
+
+			// Hashed and, on a miss, decoded straight from the mapping
+			Ref<MappedFile> source = MappedFileCache::Open(sourcePath);
+			if (!source)
+			{
+				GX_CORE_ERROR("Failed to load texture: {0}", sourcePath.string());
+				return CookErrorTexture();
+			}
+
+			// Keyed by what the source holds, never by where it is or when it was written
+			outContentHash = Hash::ComputeContent64(source->GetData(), source->GetSize());
+			uint64_t key = Hash::Compute64(&outContentHash, sizeof(outContentHash), ComputeSettingsSeed(settings));
+			std::filesystem::path entryPath = GetEntryPath(key);
+
+			CookedTexture2D cooked;
+			if (ReadEntry(entryPath, key, 0, maxDimension, cooked))
+			{
+				outKey = key;
+				return cooked;
+			}
+
+			int width, height, channels;
+			Buffer pixels = TextureImporter::DecodeTexture2D(source->GetData(), source->GetSize(), &width, &height, &channels);
+			if (!pixels)
+			{
+				GX_CORE_ERROR("Failed to decode texture: {0}", sourcePath.string());
+				return CookErrorTexture();
+			}
+
+			cooked = TextureCompressor::Cook(pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height), settings);
+			WriteEntry(entryPath, key, cooked);
+			TrimLevels(cooked, GetFirstMipWithin(cooked.Width, cooked.Height, cooked.MipLevels, maxDimension));
+
+			outKey = key;
+			return cooked;
+		}
+	}
+
+	std::filesystem::path TextureCache::GetCacheDirectory()
+	{
+		return Project::GetLibraryDirectory() / "TextureCache";
+	}
+
+	CookedTexture2D TextureCache::Load(const std::filesystem::path& sourcePath, const TextureImportSettings& settings)
+	{
+		GX_PROFILE_FUNCTION();
+
+		uint64_t key, contentHash;
+		return LoadLevels(sourcePath, settings, UINT32_MAX, key, contentHash);
+	}
+
+	CookedTexture2D TextureCache::LoadForStreaming(const std::filesystem::path& sourcePath, const TextureImportSettings& settings,
+		uint32_t maxDimension, uint64_t& outKey, uint64_t& outContentHash)
+	{
+		GX_PROFILE_FUNCTION();
+
+		return LoadLevels(sourcePath, settings, maxDimension, outKey, outContentHash);
+	}
+
+	bool TextureCache::ReadLevels(uint64_t key, uint32_t firstMip, CookedTexture2D& outCooked)
+	{
+		GX_PROFILE_FUNCTION();
+
+		return ReadEntry(GetEntryPath(key), key, firstMip, UINT32_MAX, outCooked);
+	}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#ifdef GRAVIX_EDITOR_BUILD
+
+#include "TextureCompressor.h"
+
+#include <filesystem>
+
+namespace Gravix
+{
+
+	/*
+	 * Cooked texture cache under <Library>/TextureCache
+	 *
+	 * One file per cooked texture, named after the source's content hash (the same one
+	 * the asset registry stores) hashed again with the import settings and
+	 * TextureCacheVersion, so editing the image,
+	 * changing its settings or changing the cook itself all miss naturally:
+	 *
+	 *   [TextureCacheHeader][uint64_t checksum x MipLevels][levels in Format, largest first, tightly packed]
+	 *
+	 * Each level has its own checksum so streaming can read and verify a few levels
+	 * without touching the rest of the file.
+	 *
+	 * Stale entries are never read again but are not deleted either; clearing the
+	 * directory is always safe.
+	 */
+	struct TextureCacheHeader
+	{
+		char     Signature[4]; // "GTEX"
+		uint32_t Version;
+		uint64_t Key;
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t Format;       // TextureFormat
+		uint32_t MipLevels;
+		uint64_t DataSize;     // Level data only
+		uint64_t TableChecksum; // Hash::Compute64 of the level checksum table
+	};
+	static_assert(sizeof(TextureCacheHeader) == 48, "TextureCacheHeader layout is part of the file format");
+
+	class TextureCache
+	{
+	public:
+		// Cooked texture for the image at sourcePath. A cache hit is a mapped read; a miss
+		// decodes and cooks, then stores the result. Safe to call from several workers.
+		static CookedTexture2D Load(const std::filesystem::path& sourcePath, const TextureImportSettings& settings);
+
+		// Like Load, but keeps only the levels no larger than maxDimension on either side, and
+		// always at least the smallest. outKey names the entry the other levels stream from;
+		// outContentHash is Hash::ComputeContent64 of the source, 0 if it could not be read.
+		static CookedTexture2D LoadForStreaming(const std::filesystem::path& sourcePath, const TextureImportSettings& settings,
+			uint32_t maxDimension, uint64_t& outKey, uint64_t& outContentHash);
+
+		// Levels from firstMip down of the entry key names. False when the entry has been
+		// deleted or damaged since.
+		static bool ReadLevels(uint64_t key, uint32_t firstMip, CookedTexture2D& outCooked);
+
+		static std::filesystem::path GetCacheDirectory();
+
+		// Bump whenever the cook output for the same input changes
+		static constexpr uint32_t TextureCacheVersion = 2;
+	};
+
+}
+
+#endif // GRAVIX_EDITOR_BUILD
@@ -0,0 +1,434 @@
+#include "pch.h"
+#include "TextureCompressor.h"
+#include "TextureMipGenerator.h"
+
+#include "Core/Application.h"
+#include "Core/Scheduler.h"
+#include "Renderer/Generic/Types/Texture.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Below this many texels compression saves next to nothing and its artifacts show most
+		constexpr uint64_t AutoCompressMinTexels = 64 * 64;
+
+		// Images with fewer block rows than this are encoded on the calling thread
+		constexpr uint32_t ParallelEncodeMinBlockRows = 32;
+
+		constexpr int BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		// Copies the 4x4 block at (blockX, blockY), repeating edge texels for partial blocks
+		void FetchBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t block[64])
+		{
+			for (uint32_t y = 0; y < 4; y++)
+			{
+				uint32_t sy = std::min(blockY * 4 + y, height - 1);
+				for (uint32_t x = 0; x < 4; x++)
+				{
+					uint32_t sx = std::min(blockX * 4 + x, width - 1);
+					std::memcpy(block + (y * 4 + x) * 4, pixels + (static_cast<size_t>(sy) * width + sx) * 4, 4);
+				}
+			}
+		}
+
+		// One channel, 8 bytes. Always uses the eight value mode.
+		void EncodeBC4Block(const uint8_t block[64], uint32_t channel, uint8_t* out)
+		{
+			uint8_t values[16];
+			uint8_t minValue = 255, maxValue = 0;
+			for (int i = 0; i < 16; i++)
+			{
+				values[i] = block[i * 4 + channel];
+				minValue = std::min(minValue, values[i]);
+				maxValue = std::max(maxValue, values[i]);
+			}
+
+			out[0] = maxValue;
+			out[1] = minValue;
+
+			uint64_t indices = 0;
+			if (maxValue != minValue)
+			{
+				// Palette order is e0, e1, then six steps from e0 towards e1
+				int palette[8];
+				palette[0] = maxValue;
+				palette[1] = minValue;
+				for (int k = 2; k < 8; k++)
+					palette[k] = ((8 - k) * maxValue + (k - 1) * minValue + 3) / 7;
+
+				for (int i = 0; i < 16; i++)
+				{
+					int best = 0;
+					int bestError = INT_MAX;
+					for (int k = 0; k < 8; k++)
+					{
+						int error = std::abs(palette[k] - values[i]);
+						if (error < bestError)
+						{
+							bestError = error;
+							best = k;
+						}
+					}
+					indices |= static_cast<uint64_t>(best) << (i * 3);
+				}
+			}
+
+			for (int i = 0; i < 6; i++)
+				out[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+		}
+
+		struct BC7Endpoints
+		{
+			int Quantized[2][4]; // 7 bit per channel
+			int PBit[2];
+		};
+
+		int ReconstructBC7Endpoint(const BC7Endpoints& endpoints, int endpoint, int channel)
+		{
+			return (endpoints.Quantized[endpoint][channel] << 1) | endpoints.PBit[endpoint];
+		}
+
+		// Picks the 7 bit values and shared p-bit closest to an 8 bit endpoint
+		void QuantizeBC7Endpoint(const float value[4], BC7Endpoints& endpoints, int endpoint)
+		{
+			float bestError = FLT_MAX;
+			for (int p = 0; p < 2; p++)
+			{
+				int quantized[4];
+				float error = 0.0f;
+				for (int c = 0; c < 4; c++)
+				{
+					quantized[c] = std::clamp(static_cast<int>(std::lround((value[c] - p) * 0.5f)), 0, 127);
+					float difference = static_cast<float>((quantized[c] << 1) | p) - value[c];
+					error += difference * difference;
+				}
+
+				if (error < bestError)
+				{
+					bestError = error;
+					endpoints.PBit[endpoint] = p;
+					std::copy(quantized, quantized + 4, endpoints.Quantized[endpoint]);
+				}
+			}
+		}
+
+		// Chooses the nearest palette entry per texel, returns the total squared error
+		uint32_t SelectBC7Indices(const uint8_t block[64], const BC7Endpoints& endpoints, uint8_t indices[16])
+		{
+			int palette[16][4];
+			for (int c = 0; c < 4; c++)
+			{
+				int e0 = ReconstructBC7Endpoint(endpoints, 0, c);
+				int e1 = ReconstructBC7Endpoint(endpoints, 1, c);
+				for (int k = 0; k < 16; k++)
+					palette[k][c] = ((64 - BC7Weights4[k]) * e0 + BC7Weights4[k] * e1 + 32) >> 6;
+			}
+
+			uint32_t totalError = 0;
+			for (int i = 0; i < 16; i++)
+			{
+				const uint8_t* texel = block + i * 4;
+				uint32_t bestError = UINT32_MAX;
+				for (int k = 0; k < 16; k++)
+				{
+					uint32_t error = 0;
+					for (int c = 0; c < 4; c++)
+					{
+						int difference = palette[k][c] - texel[c];
+						error += difference * difference;
+					}
+					if (error < bestError)
+					{
+						bestError = error;
+						indices[i] = static_cast<uint8_t>(k);
+					}
+				}
+				totalError += bestError;
+			}
+			return totalError;
+		}
+
+		// Refits both endpoints to the chosen indices by least squares. False if the fit is degenerate.
+		bool RefitBC7Endpoints(const uint8_t block[64], const uint8_t indices[16], float e0[4], float e1[4])
+		{
+			float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+			float ax[4] = {}, bx[4] = {};
+			for (int i = 0; i < 16; i++)
+			{
+				float w = BC7Weights4[indices[i]] / 64.0f;
+				float a = 1.0f - w;
+				aa += a * a;
+				ab += a * w;
+				bb += w * w;
+				for (int c = 0; c < 4; c++)
+				{
+					ax[c] += a * block[i * 4 + c];
+					bx[c] += w * block[i * 4 + c];
+				}
+			}
+
+			float determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			float inverse = 1.0f / determinant;
+			for (int c = 0; c < 4; c++)
+			{
+				e0[c] = std::clamp((ax[c] * bb - bx[c] * ab) * inverse, 0.0f, 255.0f);
+				e1[c] = std::clamp((bx[c] * aa - ax[c] * ab) * inverse, 0.0f, 255.0f);
+			}
+			return true;
+		}
+
+		// Mode 6: one subset, RGBA 7.7.7.7 endpoints with a p-bit each, 4 bit indices
+		void EncodeBC7Block(const uint8_t block[64], uint8_t* out)
+		{
+			// Principal axis of the texels in RGBA space
+			float mean[4] = {};
+			for (int i = 0; i < 16; i++)
+				for (int c = 0; c < 4; c++)
+					mean[c] += block[i * 4 + c];
+			for (int c = 0; c < 4; c++)
+				mean[c] /= 16.0f;
+
+			float covariance[4][4] = {};
+			for (int i = 0; i < 16; i++)
+			{
+				float d[4];
+				for (int c = 0; c < 4; c++)
+					d[c] = block[i * 4 + c] - mean[c];
+				for (int r = 0; r < 4; r++)
+					for (int c = 0; c < 4; c++)
+						covariance[r][c] += d[r] * d[c];
+			}
+
+			float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			for (int iteration = 0; iteration < 8; iteration++)
+			{
+				float next[4] = {};
+				for (int r = 0; r < 4; r++)
+					for (int c = 0; c < 4; c++)
+						next[r] += covariance[r][c] * axis[c];
+
+				float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2] + next[3] * next[3]);
+				if (length < 1e-6f)
+					break;
+				for (int c = 0; c < 4; c++)
+					axis[c] = next[c] / length;
+			}
+
+			float minT = FLT_MAX, maxT = -FLT_MAX;
+			for (int i = 0; i < 16; i++)
+			{
+				float t = 0.0f;
+				for (int c = 0; c < 4; c++)
+					t += (block[i * 4 + c] - mean[c]) * axis[c];
+				minT = std::min(minT, t);
+				maxT = std::max(maxT, t);
+			}
+
+			float e0[4], e1[4];
+			for (int c = 0; c < 4; c++)
+			{
+				e0[c] = std::clamp(mean[c] + minT * axis[c], 0.0f, 255.0f);
+				e1[c] = std::clamp(mean[c] + maxT * axis[c], 0.0f, 255.0f);
+			}
+
+			BC7Endpoints endpoints;
+			QuantizeBC7Endpoint(e0, endpoints, 0);
+			QuantizeBC7Endpoint(e1, endpoints, 1);
+
+			uint8_t indices[16];
+			uint32_t error = SelectBC7Indices(block, endpoints, indices);
+
+			// The bounding endpoints are rarely the best ones; one refit usually helps
+			float refit0[4], refit1[4];
+			if (error > 0 && RefitBC7Endpoints(block, indices, refit0, refit1))
+			{
+				BC7Endpoints refitted;
+				QuantizeBC7Endpoint(refit0, refitted, 0);
+				QuantizeBC7Endpoint(refit1, refitted, 1);
+
+				uint8_t refittedIndices[16];
+				if (SelectBC7Indices(block, refitted, refittedIndices) < error)
+				{
+					endpoints = refitted;
+					std::copy(refittedIndices, refittedIndices + 16, indices);
+				}
+			}
+
+			// The first texel's index is stored without its top bit, so it has to be below 8
+			if (indices[0] >= 8)
+			{
+				std::swap(endpoints.Quantized[0], endpoints.Quantized[1]);
+				std::swap(endpoints.PBit[0], endpoints.PBit[1]);
+				for (int i = 0; i < 16; i++)
+					indices[i] = static_cast<uint8_t>(15 - indices[i]);
+			}
+
+			uint64_t bits[2] = {};
+			uint32_t position = 0;
+			auto write = [&](uint64_t value, uint32_t count)
+				{
+					for (uint32_t i = 0; i < count; i++, position++)
+						bits[position >> 6] |= ((value >> i) & 1) << (position & 63);
+				};
+
+			write(1 << 6, 7);
+			for (int c = 0; c < 4; c++)
+			{
+				write(endpoints.Quantized[0][c], 7);
+				write(endpoints.Quantized[1][c], 7);
+			}
+			write(endpoints.PBit[0], 1);
+			write(endpoints.PBit[1], 1);
+			write(indices[0], 3);
+			for (int i = 1; i < 16; i++)
+				write(indices[i], 4);
+
+			std::memcpy(out, bits, 16);
+		}
+
+		void EncodeBlockRows(TextureFormat format, const uint8_t* pixels, uint32_t width, uint32_t height,
+			uint32_t firstRow, uint32_t lastRow, uint8_t* dst)
+		{
+			uint32_t blocksX = (width + 3) / 4;
+			size_t blockBytes = format == TextureFormat::BC4 ? 8 : 16;
+
+			uint8_t block[64];
+			for (uint32_t blockY = firstRow; blockY < lastRow; blockY++)
+			{
+				uint8_t* out = dst + static_cast<size_t>(blockY) * blocksX * blockBytes;
+				for (uint32_t blockX = 0; blockX < blocksX; blockX++, out += blockBytes)
+				{
+					FetchBlock(pixels, width, height, blockX, blockY, block);
+
+					switch (format)
+					{
+					case TextureFormat::BC7:
+						EncodeBC7Block(block, out);
+						break;
+					case TextureFormat::BC5:
+						EncodeBC4Block(block, 0, out);
+						EncodeBC4Block(block, 1, out + 8);
+						break;
+					case TextureFormat::BC4:
+						EncodeBC4Block(block, 0, out);
+						break;
+					default:
+						break;
+					}
+				}
+			}
+		}
+
+		struct EncodeBlockRowsTask : public enki::ITaskSet
+		{
+			TextureFormat Format;
+			const uint8_t* Pixels;
+			uint32_t Width, Height;
+			uint8_t* Destination;
+
+			void ExecuteRange(enki::TaskSetPartition range, uint32_t threadnum) override
+			{
+				EncodeBlockRows(Format, Pixels, Width, Height, range.start, range.end, Destination);
+			}
+		};
+
+	}
+
+	TextureFormat TextureCompressor::SelectFormat(const uint8_t* pixels, uint32_t width, uint32_t height, TextureCompression compression)
+	{
+		switch (compression)
+		{
+		case TextureCompression::None: return TextureFormat::RGBA8;
+		case TextureCompression::BC7:  return TextureFormat::BC7;
+		case TextureCompression::BC5:  return TextureFormat::BC5;
+		case TextureCompression::BC4:  return TextureFormat::BC4;
+		default: break;
+		}
+
+		uint64_t texelCount = static_cast<uint64_t>(width) * height;
+		if (texelCount < AutoCompressMinTexels)
+			return TextureFormat::RGBA8;
+
+		// Opaque grayscale fits in a single channel at half the size of BC7
+		for (uint64_t i = 0; i < texelCount; i++)
+		{
+			const uint8_t* texel = pixels + i * 4;
+			if (texel[0] != texel[1] || texel[1] != texel[2] || texel[3] != 255)
+				return TextureFormat::BC7;
+		}
+		return TextureFormat::BC4;
+	}
+
+	CookedTexture2D TextureCompressor::Cook(Buffer pixels, uint32_t width, uint32_t height, const TextureImportSettings& settings)
+	{
+		GX_PROFILE_FUNCTION();
+
+		CookedTexture2D cooked;
+		cooked.Width = width;
+		cooked.Height = height;
+		cooked.Format = SelectFormat(pixels.Data, width, height, settings.Compression);
+		cooked.MipLevels = settings.GenerateMipmaps ? GetFullMipChainLevels(width, height) : 1;
+
+		if (cooked.Format == TextureFormat::RGBA8 && cooked.MipLevels == 1)
+		{
+			cooked.Data = pixels;
+			return cooked;
+		}
+
+		cooked.Data.Allocate(GetTextureMipChainSize(cooked.Format, width, height, cooked.MipLevels));
+
+		uint8_t* dst = cooked.Data.Data;
+		TextureMipGenerator::Generate(pixels.Data, width, height, cooked.MipLevels, settings,
+			[&](uint32_t mip, const uint8_t* levelPixels, uint32_t levelWidth, uint32_t levelHeight)
+			{
+				Encode(cooked.Format, levelPixels, levelWidth, levelHeight, dst);
+				dst += GetTextureLevelSize(cooked.Format, levelWidth, levelHeight);
+			});
+
+		pixels.Release();
+		return cooked;
+	}
+
+	void TextureCompressor::Encode(TextureFormat format, const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* dst)
+	{
+		GX_PROFILE_FUNCTION();
+
+		if (format == TextureFormat::RGBA8)
+		{
+			std::memcpy(dst, pixels, static_cast<size_t>(width) * height * 4);
+			return;
+		}
+
+		uint32_t blockRows = (height + 3) / 4;
+		if (blockRows < ParallelEncodeMinBlockRows)
+		{
+			EncodeBlockRows(format, pixels, width, height, 0, blockRows, dst);
+			return;
+		}
+
+		// Waiting from inside a worker runs other tasks meanwhile, so this is safe from async loads too
+		enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+
+		EncodeBlockRowsTask task;
+		task.Format = format;
+		task.Pixels = pixels;
+		task.Width = width;
+		task.Height = height;
+		task.Destination = dst;
+		task.m_SetSize = blockRows;
+		task.m_MinRange = 8;
+
+		scheduler.AddTaskSetToPipe(&task);
+		scheduler.WaitforTask(&task);
+	}
+
+}
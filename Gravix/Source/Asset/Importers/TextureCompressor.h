@@ -0,0 +1,42 @@
+#pragma once
+
+#ifdef GRAVIX_EDITOR_BUILD
+
+#include "Asset/AssetMetadata.h"
+
+#include "Core/Buffer.h"
+#include "Renderer/Specification.h"
+
+namespace Gravix
+{
+
+	// A texture in the format it is uploaded in: every level tightly packed, largest first.
+	// Width, Height and MipLevels describe the whole chain; Data starts at FirstMip.
+	struct CookedTexture2D
+	{
+		Buffer Data;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t MipLevels = 1;
+		uint32_t FirstMip = 0;
+		TextureFormat Format = TextureFormat::RGBA8;
+	};
+
+	// Turns decoded RGBA8 pixels into the format the import settings ask for.
+	// CPU heavy; meant for worker threads, and large images are split further
+	// across the task scheduler.
+	class TextureCompressor
+	{
+	public:
+		static TextureFormat SelectFormat(const uint8_t* pixels, uint32_t width, uint32_t height, TextureCompression compression);
+
+		// Takes ownership of pixels, which must be width * height RGBA8
+		static CookedTexture2D Cook(Buffer pixels, uint32_t width, uint32_t height, const TextureImportSettings& settings);
+
+		// Encodes one level; dst must hold GetTextureLevelSize(format, width, height) bytes
+		static void Encode(TextureFormat format, const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* dst);
+	};
+
+}
+
+#endif // GRAVIX_EDITOR_BUILD
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "TextureImporter.h"
 
+#include "TextureCache.h"
+
+#include "Core/MappedFileCache.h"
 #include "Project/Project.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -11,7 +14,21 @@ namespace Gravix
 
 	Ref<Texture2D> TextureImporter::ImportTexture2D(AssetHandle handle, const AssetMetadata& metadata)
 	{
-		return LoadTexture2D(Project::GetAssetDirectory() / metadata.FilePath);
+		CookedTexture2D cooked = TextureCache::Load(Project::GetAssetDirectory() / metadata.FilePath, metadata.TextureSettings);
+		Ref<Texture2D> texture = CreateTexture2D(cooked.Data, cooked.Width, cooked.Height, cooked.Format, cooked.MipLevels, metadata.FilePath.filename().string());
+		cooked.Data.Release();
+
+		return texture;
+	}
+
+	Ref<Texture2D> TextureImporter::CreateTexture2D(Buffer data, uint32_t width, uint32_t height, TextureFormat format, uint32_t mipLevels, const std::string& debugName, uint32_t residentMip /*= 0*/)
+	{
+		TextureSpecification spec;
+		spec.DebugName = debugName;
+		spec.Format = format;
+		spec.MipLevels = mipLevels;
+		spec.ResidentMip = residentMip;
+		return Texture2D::Create(data, width, height, spec);
 	}
 
 	Ref<Texture2D> TextureImporter::LoadTexture2D(const std::filesystem::path& path)
@@ -29,38 +46,57 @@ namespace Gravix
 
 	Buffer TextureImporter::LoadTexture2DToBuffer(const std::filesystem::path& path, int* width, int* height, int* channels)
 	{
-		// Force RGBA format for consistency
-		stbi_set_flip_vertically_on_load(false); // Vulkan has inverted Y compared to OpenGL
-
-		Buffer data;
-		data.Data = stbi_load(path.string().c_str(), width, height, channels, STBI_rgb_alpha);
+		Ref<MappedFile> file = MappedFileCache::Open(path);
+		if (!file)
+		{
+			GX_CORE_ERROR("Failed to load texture: {0}", path.string());
+			return CreateErrorTexture2D(width, height, channels);
+		}
 
-		if (!(stbi_uc*)data.Data)
+		Buffer data = DecodeTexture2D(file->GetData(), file->GetSize(), width, height, channels);
+		if (!data)
 		{
 			GX_CORE_ERROR("Failed to load texture: {0} - {1}", path.string(), stbi_failure_reason());
+			return CreateErrorTexture2D(width, height, channels);
+		}
 
-			*width = 16;
-			*height = 16;
-			*channels = 4;
+		return data;
+	}
 
-			// Allocate error texture using malloc to match Buffer::Release() which uses free()
-			const size_t pixelCount = 16 * 16;
-			uint32_t* pixels = (uint32_t*)malloc(sizeof(uint32_t) * pixelCount);
+	Buffer TextureImporter::DecodeTexture2D(const uint8_t* data, size_t size, int* width, int* height, int* channels)
+	{
+		stbi_set_flip_vertically_on_load(false);
 
-			uint32_t black = glm::packUnorm4x8(glm::vec4(0, 0, 0, 1));
-			uint32_t magenta = glm::packUnorm4x8(glm::vec4(1, 0, 1, 1));
+		Buffer pixels;
+		pixels.Data = stbi_load_from_memory(data, static_cast<int>(size), width, height, channels, STBI_rgb_alpha);
+		if (pixels.Data)
+			pixels.Size = static_cast<uint64_t>(*width) * *height * 4;
 
-			for (int x = 0; x < 16; x++) {
-				for (int y = 0; y < 16; y++) {
-					pixels[y * 16 + x] = ((x % 2) ^ (y % 2)) ? magenta : black;
-				}
-			}
+		return pixels;
+	}
 
-			data.Data = reinterpret_cast<uint8_t*>(pixels);
-			data.Size = sizeof(uint32_t) * pixelCount;
+	Buffer TextureImporter::CreateErrorTexture2D(int* width, int* height, int* channels)
+	{
+		*width = 16;
+		*height = 16;
+		*channels = 4;
+
+		// Allocate error texture using malloc to match Buffer::Release() which uses free()
+		const size_t pixelCount = 16 * 16;
+		uint32_t* pixels = (uint32_t*)malloc(sizeof(uint32_t) * pixelCount);
+
+		uint32_t black = glm::packUnorm4x8(glm::vec4(0, 0, 0, 1));
+		uint32_t magenta = glm::packUnorm4x8(glm::vec4(1, 0, 1, 1));
+
+		for (int x = 0; x < 16; x++) {
+			for (int y = 0; y < 16; y++) {
+				pixels[y * 16 + x] = ((x % 2) ^ (y % 2)) ? magenta : black;
+			}
 		}
-		else { data.Size = *width * *height * *channels; }
 
+		Buffer data;
+		data.Data = reinterpret_cast<uint8_t*>(pixels);
+		data.Size = sizeof(uint32_t) * pixelCount;
 		return data;
 	}
 
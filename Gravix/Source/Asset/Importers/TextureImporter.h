@@ -13,13 +13,22 @@ namespace Gravix
 	class TextureImporter
 	{
 	public:
-		// AssetMetadata filepath is relative to asset directory
+		// AssetMetadata filepath is relative to asset directory. Cooked with the metadata's import settings.
 		static Ref<Texture2D> ImportTexture2D(AssetHandle handle, const AssetMetadata& metadata);
 
+		// data holds mipLevels levels in format, largest first; it is copied, not taken over
+		static Ref<Texture2D> CreateTexture2D(Buffer data, uint32_t width, uint32_t height, TextureFormat format, uint32_t mipLevels, const std::string& debugName, uint32_t residentMip = 0);
+
 		// Load texture from file path (i.e. path has to absolute or relative to working directory)
 		static Ref<Texture2D> LoadTexture2D(const std::filesystem::path& path);
 
 		static Buffer LoadTexture2DToBuffer(const std::filesystem::path& metadata, int* width, int* height, int* channels);
+
+		// Decodes an encoded image (PNG, JPG, ...) held in memory to RGBA8. Empty buffer on failure.
+		static Buffer DecodeTexture2D(const uint8_t* data, size_t size, int* width, int* height, int* channels);
+
+		// Magenta and black checkerboard used in place of images that fail to load
+		static Buffer CreateErrorTexture2D(int* width, int* height, int* channels);
 	};
 
 }
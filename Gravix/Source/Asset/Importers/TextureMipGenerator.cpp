@@ -0,0 +1,273 @@
+#include "pch.h"
+#include "TextureMipGenerator.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define GX_MIP_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// One RGBA texel in linear float; a single SSE register where available
+#if GX_MIP_SSE
+		using Texel = __m128;
+
+		Texel LoadTexel(const float* p) { return _mm_loadu_ps(p); }
+		void StoreTexel(float* p, Texel value) { _mm_storeu_ps(p, value); }
+		Texel ZeroTexel() { return _mm_setzero_ps(); }
+		Texel AddTexel(Texel a, Texel b) { return _mm_add_ps(a, b); }
+		Texel ScaleTexel(Texel value, float scale) { return _mm_mul_ps(value, _mm_set1_ps(scale)); }
+		Texel MulAddTexel(Texel accumulator, Texel value, float weight) { return _mm_add_ps(accumulator, _mm_mul_ps(value, _mm_set1_ps(weight))); }
+#else
+		struct Texel { float V[4]; };
+
+		Texel LoadTexel(const float* p) { return { p[0], p[1], p[2], p[3] }; }
+		void StoreTexel(float* p, Texel value) { std::memcpy(p, value.V, sizeof(value.V)); }
+		Texel ZeroTexel() { return {}; }
+		Texel AddTexel(Texel a, Texel b) { return { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] }; }
+		Texel ScaleTexel(Texel value, float scale) { return { value.V[0] * scale, value.V[1] * scale, value.V[2] * scale, value.V[3] * scale }; }
+		Texel MulAddTexel(Texel accumulator, Texel value, float weight) { return AddTexel(accumulator, ScaleTexel(value, weight)); }
+#endif
+
+		struct SRGBTables
+		{
+			float ToLinear[256];
+			uint8_t FromLinear[4096]; // Indexed by linear value * 4095; fine enough to round trip every byte
+		};
+
+		const SRGBTables& GetSRGBTables()
+		{
+			static const SRGBTables tables = []()
+				{
+					SRGBTables result;
+					for (int i = 0; i < 256; i++)
+					{
+						float c = i / 255.0f;
+						result.ToLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+					}
+					for (int i = 0; i < 4096; i++)
+					{
+						float l = i / 4095.0f;
+						float s = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+						result.FromLinear[i] = static_cast<uint8_t>(std::clamp(s * 255.0f + 0.5f, 0.0f, 255.0f));
+					}
+					return result;
+				}();
+			return tables;
+		}
+
+		// Six taps per axis for a 2x reduction, centred between the two source texels each output covers
+		constexpr int KaiserTaps = 6;
+
+		const std::array<float, KaiserTaps>& GetKaiserWeights()
+		{
+			static const std::array<float, KaiserTaps> weights = []()
+				{
+					constexpr float Pi = 3.14159265358979f;
+					constexpr float Beta = 4.0f;
+					constexpr float HalfWidth = 1.5f; // In output texels
+
+					auto besselI0 = [](float x)
+						{
+							float sum = 1.0f, term = 1.0f;
+							for (int k = 1; k < 16; k++)
+							{
+								term *= (x / (2.0f * k)) * (x / (2.0f * k));
+								sum += term;
+							}
+							return sum;
+						};
+
+					std::array<float, KaiserTaps> result;
+					float total = 0.0f;
+					for (int k = 0; k < KaiserTaps; k++)
+					{
+						float t = (k - (KaiserTaps - 1) * 0.5f) * 0.5f;
+						float sinc = std::sin(Pi * t) / (Pi * t);
+						float window = besselI0(Beta * std::sqrt(1.0f - (t / HalfWidth) * (t / HalfWidth))) / besselI0(Beta);
+						result[k] = sinc * window;
+						total += result[k];
+					}
+					for (float& weight : result)
+						weight /= total;
+					return result;
+				}();
+			return weights;
+		}
+
+		void ToLinear(const uint8_t* pixels, size_t texelCount, const TextureImportSettings& settings, float* out)
+		{
+			const SRGBTables& tables = GetSRGBTables();
+			for (size_t i = 0; i < texelCount; i++)
+			{
+				const uint8_t* texel = pixels + i * 4;
+				float* result = out + i * 4;
+
+				float alpha = texel[3] / 255.0f;
+				for (int c = 0; c < 3; c++)
+					result[c] = settings.SRGB ? tables.ToLinear[texel[c]] : texel[c] / 255.0f;
+				result[3] = alpha;
+
+				// Premultiplied, so fully transparent texels add nothing to their neighbours' color
+				if (settings.SRGB)
+				{
+					for (int c = 0; c < 3; c++)
+						result[c] *= alpha;
+				}
+			}
+		}
+
+		void ToBytes(const float* linear, size_t texelCount, const TextureImportSettings& settings, uint8_t* out)
+		{
+			const SRGBTables& tables = GetSRGBTables();
+			for (size_t i = 0; i < texelCount; i++)
+			{
+				const float* texel = linear + i * 4;
+				uint8_t* result = out + i * 4;
+
+				float alpha = std::clamp(texel[3], 0.0f, 1.0f);
+				float unpremultiply = settings.SRGB && alpha > 0.0f ? 1.0f / alpha : 1.0f;
+				for (int c = 0; c < 3; c++)
+				{
+					float value = std::clamp(texel[c] * unpremultiply, 0.0f, 1.0f);
+					result[c] = settings.SRGB
+						? tables.FromLinear[static_cast<int>(value * 4095.0f + 0.5f)]
+						: static_cast<uint8_t>(value * 255.0f + 0.5f);
+				}
+				result[3] = static_cast<uint8_t>(alpha * 255.0f + 0.5f);
+			}
+		}
+
+		// 2x2 average; odd edges fold the last row or column in twice
+		void DownsampleBox(const float* src, uint32_t width, uint32_t height, float* dst)
+		{
+			uint32_t dstWidth = std::max(width >> 1, 1u);
+			uint32_t dstHeight = std::max(height >> 1, 1u);
+
+			for (uint32_t y = 0; y < dstHeight; y++)
+			{
+				const float* row0 = src + static_cast<size_t>(std::min(y * 2, height - 1)) * width * 4;
+				const float* row1 = src + static_cast<size_t>(std::min(y * 2 + 1, height - 1)) * width * 4;
+				float* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					uint32_t x0 = std::min(x * 2, width - 1) * 4;
+					uint32_t x1 = std::min(x * 2 + 1, width - 1) * 4;
+
+					Texel sum = AddTexel(AddTexel(LoadTexel(row0 + x0), LoadTexel(row0 + x1)),
+						AddTexel(LoadTexel(row1 + x0), LoadTexel(row1 + x1)));
+					StoreTexel(out + x * 4, ScaleTexel(sum, 0.25f));
+				}
+			}
+		}
+
+		// Separable: rows into scratch, then columns. Taps past the edge clamp to it.
+		void DownsampleKaiser(const float* src, uint32_t width, uint32_t height, float* dst, std::vector<float>& scratch)
+		{
+			const std::array<float, KaiserTaps>& weights = GetKaiserWeights();
+			constexpr int FirstTap = -(KaiserTaps / 2 - 1);
+
+			uint32_t dstWidth = std::max(width >> 1, 1u);
+			uint32_t dstHeight = std::max(height >> 1, 1u);
+
+			scratch.resize(static_cast<size_t>(dstWidth) * height * 4);
+
+			for (uint32_t y = 0; y < height; y++)
+			{
+				const float* row = src + static_cast<size_t>(y) * width * 4;
+				float* out = scratch.data() + static_cast<size_t>(y) * dstWidth * 4;
+
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					// An axis that is already one texel wide is not reduced
+					if (width == 1)
+					{
+						StoreTexel(out + x * 4, LoadTexel(row));
+						continue;
+					}
+
+					Texel sum = ZeroTexel();
+					for (int k = 0; k < KaiserTaps; k++)
+					{
+						int sx = std::clamp(static_cast<int>(x * 2) + FirstTap + k, 0, static_cast<int>(width) - 1);
+						sum = MulAddTexel(sum, LoadTexel(row + sx * 4), weights[k]);
+					}
+					StoreTexel(out + x * 4, sum);
+				}
+			}
+
+			for (uint32_t y = 0; y < dstHeight; y++)
+			{
+				float* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+				if (height == 1)
+				{
+					std::memcpy(out, scratch.data(), static_cast<size_t>(dstWidth) * 4 * sizeof(float));
+					continue;
+				}
+
+				const float* rows[KaiserTaps];
+				for (int k = 0; k < KaiserTaps; k++)
+				{
+					int sy = std::clamp(static_cast<int>(y * 2) + FirstTap + k, 0, static_cast<int>(height) - 1);
+					rows[k] = scratch.data() + static_cast<size_t>(sy) * dstWidth * 4;
+				}
+
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					Texel sum = ZeroTexel();
+					for (int k = 0; k < KaiserTaps; k++)
+						sum = MulAddTexel(sum, LoadTexel(rows[k] + x * 4), weights[k]);
+					StoreTexel(out + x * 4, sum);
+				}
+			}
+		}
+	}
+
+	void TextureMipGenerator::Generate(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipLevels,
+		const TextureImportSettings& settings, const LevelCallback& callback)
+	{
+		GX_PROFILE_FUNCTION();
+
+		callback(0, pixels, width, height);
+		if (mipLevels <= 1)
+			return;
+
+		// Every level is filtered from the previous one at full float precision
+		std::vector<float> level(static_cast<size_t>(width) * height * 4);
+		ToLinear(pixels, static_cast<size_t>(width) * height, settings, level.data());
+
+		std::vector<float> next;
+		std::vector<float> scratch;
+		std::vector<uint8_t> bytes;
+
+		for (uint32_t mip = 1; mip < mipLevels; mip++)
+		{
+			uint32_t nextWidth = std::max(width >> 1, 1u);
+			uint32_t nextHeight = std::max(height >> 1, 1u);
+			size_t texelCount = static_cast<size_t>(nextWidth) * nextHeight;
+
+			next.resize(texelCount * 4);
+			if (settings.MipFilter == TextureMipFilter::Kaiser)
+				DownsampleKaiser(level.data(), width, height, next.data(), scratch);
+			else
+				DownsampleBox(level.data(), width, height, next.data());
+
+			bytes.resize(texelCount * 4);
+			ToBytes(next.data(), texelCount, settings, bytes.data());
+			callback(mip, bytes.data(), nextWidth, nextHeight);
+
+			std::swap(level, next);
+			width = nextWidth;
+			height = nextHeight;
+		}
+	}
+
+}
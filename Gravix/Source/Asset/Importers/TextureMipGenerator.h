@@ -0,0 +1,27 @@
+#pragma once
+
+#ifdef GRAVIX_EDITOR_BUILD
+
+#include "Asset/AssetMetadata.h"
+
+#include <functional>
+
+namespace Gravix
+{
+
+	// Builds a mip chain from RGBA8 pixels. Filtering happens in linear float, so
+	// sRGB color is averaged as light rather than as gamma encoded values, and
+	// color is weighted by alpha so transparent texels do not darken the edges.
+	class TextureMipGenerator
+	{
+	public:
+		// Called once per level, largest first; pixels are RGBA8 and only valid during the call
+		using LevelCallback = std::function<void(uint32_t mip, const uint8_t* pixels, uint32_t width, uint32_t height)>;
+
+		static void Generate(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipLevels,
+			const TextureImportSettings& settings, const LevelCallback& callback);
+	};
+
+}
+
+#endif // GRAVIX_EDITOR_BUILD
@@ -1,9 +1,570 @@
 #include "pch.h"
 #include "RuntimeAssetManager.h"
 
-namespace Gravix 
+#include "Core/Application.h"
+#include "Core/Hash.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+#include "Renderer/Generic/Types/Texture.h"
+#include "Renderer/Generic/Types/Shader.h"
+#include "Renderer/Generic/Types/Pipeline.h"
+#include "Renderer/Generic/Types/Material.h"
+
+#include "AssetPack/PakCompression.h"
+
+#include "Scene/Scene.h"
+#include "Serialization/BinaryDeserializer.h"
+#include "Serialization/Scene/SceneSerializer.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Gravix
 {
 
+	bool RuntimeAssetManager::OpenPak(const std::filesystem::path& pakPath)
+	{
+		GX_PROFILE_FUNCTION();
+
+		ClosePak();
+
+		if (!m_PakFile.Open(pakPath))
+			return false;
+
+		const uint8_t* data = m_PakFile.GetData();
+		uint64_t size = m_PakFile.GetSize();
+
+		if (size < sizeof(PakHeader))
+		{
+			GX_CORE_ERROR("Asset pack is too small to be valid: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		PakHeader header;
+		std::memcpy(&header, data, sizeof(PakHeader));
+
+		if (std::memcmp(header.Signature, PAK_SIGNATURE, sizeof(header.Signature)) != 0)
+		{
+			GX_CORE_ERROR("Not a GPAK archive: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		if (header.Version != PAK_VERSION)
+		{
+			GX_CORE_ERROR("Asset pack version {} is not supported (expected {}): {}", header.Version, PAK_VERSION, pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		if (header.Compression != CompressionFlags::None && header.Compression != CompressionFlags::LZ4)
+		{
+			GX_CORE_ERROR("Asset pack uses a compression codec this build does not include: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		if (header.Alignment < 8 || (header.Alignment & (header.Alignment - 1)) != 0)
+		{
+			GX_CORE_ERROR("Asset pack has an invalid blob alignment: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		uint64_t tocSize = static_cast<uint64_t>(header.AssetCount) * sizeof(PakTOCEntry);
+		if (header.TOCOffset % alignof(PakTOCEntry) != 0 || header.TOCOffset > size || size - header.TOCOffset < tocSize)
+		{
+			GX_CORE_ERROR("Asset pack table of contents is out of bounds: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		const uint8_t* tocData = data + header.TOCOffset;
+		if (Hash::Compute64(tocData, tocSize) != header.TOCChecksum)
+		{
+			GX_CORE_ERROR("Asset pack table of contents is corrupt: {}", pakPath.string());
+			ClosePak();
+			return false;
+		}
+
+		m_TOC = reinterpret_cast<const PakTOCEntry*>(tocData);
+		m_EntryCount = header.AssetCount;
+		m_VerifiedEntries.assign(m_EntryCount, false);
+
+		// The dictionary is stored under the null handle, so it is always the first entry when present
+		if (m_EntryCount > 0 && m_TOC[0].Handle == PAK_DICTIONARY_HANDLE)
+		{
+			if (m_TOC[0].Flags != 0 || !VerifyEntry(m_TOC[0]))
+			{
+				GX_CORE_ERROR("Asset pack compression dictionary is corrupt: {}", pakPath.string());
+				ClosePak();
+				return false;
+			}
+
+			m_Dictionary = data + m_TOC[0].Offset;
+			m_DictionarySize = m_TOC[0].Size;
+		}
+
+		GX_CORE_INFO("Opened asset pack {} ({} assets)", pakPath.string(), m_EntryCount);
+		return true;
+	}
+
+	void RuntimeAssetManager::ClosePak()
+	{
+		Device* device = Application::Get().GetWindow().GetDevice();
+		for (auto& [handle, asset] : m_LoadedAssets)
+		{
+			m_Residency.OnUnloaded(handle);
+			device->DeferRelease(std::move(asset));
+		}
+
+		m_LoadedAssets.clear();
+		m_SlotTable.Clear();
+		m_VerifiedEntries.clear();
+
+		m_TOC = nullptr;
+		m_EntryCount = 0;
+		m_Dictionary = nullptr;
+		m_DictionarySize = 0;
+		m_PakFile.Close();
+	}
+
+	const PakTOCEntry* RuntimeAssetManager::FindEntry(AssetHandle handle) const
+	{
+		if (m_TOC == nullptr || handle == PAK_DICTIONARY_HANDLE)
+			return nullptr;
+
+		uint64_t key = static_cast<uint64_t>(handle);
+		const PakTOCEntry* end = m_TOC + m_EntryCount;
+		const PakTOCEntry* it = std::lower_bound(m_TOC, end, key, [](const PakTOCEntry& entry, uint64_t value) { return entry.Handle < value; });
+
+		return (it != end && it->Handle == key) ? it : nullptr;
+	}
+
+	bool RuntimeAssetManager::VerifyEntry(const PakTOCEntry& entry)
+	{
+		size_t index = static_cast<size_t>(&entry - m_TOC);
+		if (m_VerifiedEntries[index])
+			return true;
+
+		if (entry.Offset > m_PakFile.GetSize() || m_PakFile.GetSize() - entry.Offset < entry.Size)
+		{
+			GX_CORE_ERROR("Asset {} lies outside the asset pack", entry.Handle);
+			return false;
+		}
+
+		const uint8_t* blob = m_PakFile.GetData() + entry.Offset;
+
+		// Compressed entries only checksum their chunk table here; each chunk is checked as it is decompressed
+		uint64_t checkedSize = entry.Size;
+		if (entry.Flags & PakEntryCompressed)
+		{
+			if (entry.Size < sizeof(PakChunkTable))
+			{
+				GX_CORE_ERROR("Asset {} has a truncated chunk table", entry.Handle);
+				return false;
+			}
+
+			const PakChunkTable* table = reinterpret_cast<const PakChunkTable*>(blob);
+			checkedSize = sizeof(PakChunkTable) + static_cast<uint64_t>(table->ChunkCount) * sizeof(PakChunk);
+
+			bool validTable = table->ChunkSize > 0 && checkedSize <= entry.Size &&
+				table->ChunkCount == (table->UncompressedSize + table->ChunkSize - 1) / table->ChunkSize;
+			if (!validTable)
+			{
+				GX_CORE_ERROR("Asset {} has an invalid chunk table", entry.Handle);
+				return false;
+			}
+
+			const PakChunk* chunks = reinterpret_cast<const PakChunk*>(blob + sizeof(PakChunkTable));
+			for (uint32_t i = 0; i < table->ChunkCount; i++)
+			{
+				if (chunks[i].Offset > entry.Size || entry.Size - chunks[i].Offset < chunks[i].StoredSize)
+				{
+					GX_CORE_ERROR("Asset {} has a chunk outside its blob", entry.Handle);
+					return false;
+				}
+			}
+
+			if ((entry.Flags & PakEntryDictionary) && m_Dictionary == nullptr)
+			{
+				GX_CORE_ERROR("Asset {} needs the compression dictionary but the pack has none", entry.Handle);
+				return false;
+			}
+		}
+
+		if (Hash::Compute64(blob, checkedSize) != entry.Checksum)
+		{
+			GX_CORE_ERROR("Asset {} failed its checksum, the asset pack is corrupt", entry.Handle);
+			return false;
+		}
+
+		m_VerifiedEntries[index] = true;
+		return true;
+	}
+
+	bool RuntimeAssetManager::IsAssetHandleValid(AssetHandle handle) const
+	{
+		return handle != 0 && FindEntry(handle) != nullptr;
+	}
+
+	bool RuntimeAssetManager::IsAssetLoaded(AssetHandle handle) const
+	{
+		return m_LoadedAssets.contains(handle);
+	}
+
+	AssetType RuntimeAssetManager::GetAssetType(AssetHandle handle) const
+	{
+		const PakTOCEntry* entry = FindEntry(handle);
+		return entry ? entry->Type : AssetType::None;
+	}
+
+	uint64_t RuntimeAssetManager::GetUncompressedSize(const PakTOCEntry& entry) const
+	{
+		if (entry.Flags & PakEntryCompressed)
+			return reinterpret_cast<const PakChunkTable*>(m_PakFile.GetData() + entry.Offset)->UncompressedSize;
+
+		return entry.Size;
+	}
+
+	uint64_t RuntimeAssetManager::GetAssetSize(AssetHandle handle)
+	{
+		const PakTOCEntry* entry = FindEntry(handle);
+		if (entry == nullptr || !VerifyEntry(*entry))
+			return 0;
+
+		return GetUncompressedSize(*entry);
+	}
+
+	bool RuntimeAssetManager::ReadAsset(AssetHandle handle, std::vector<uint8_t>& outData)
+	{
+		const PakTOCEntry* entry = FindEntry(handle);
+		if (entry == nullptr || !VerifyEntry(*entry))
+			return false;
+
+		outData.resize(GetUncompressedSize(*entry));
+		return ReadEntryRange(*entry, 0, outData.size(), outData.data());
+	}
+
+	bool RuntimeAssetManager::ReadAssetRange(AssetHandle handle, uint64_t offset, uint64_t size, void* outData)
+	{
+		const PakTOCEntry* entry = FindEntry(handle);
+		if (entry == nullptr || !VerifyEntry(*entry))
+			return false;
+
+		return ReadEntryRange(*entry, offset, size, static_cast<uint8_t*>(outData));
+	}
+
+	bool RuntimeAssetManager::ReadEntryRange(const PakTOCEntry& entry, uint64_t offset, uint64_t size, uint8_t* outData)
+	{
+		GX_PROFILE_FUNCTION();
+
+		uint64_t totalSize = GetUncompressedSize(entry);
+		if (offset > totalSize || totalSize - offset < size)
+		{
+			GX_CORE_ERROR("Read of {} bytes at {} is outside asset {} ({} bytes)", size, offset, entry.Handle, totalSize);
+			return false;
+		}
+
+		if (size == 0)
+			return true;
+
+		if (!(entry.Flags & PakEntryCompressed))
+		{
+			std::memcpy(outData, m_PakFile.GetData() + entry.Offset + offset, size);
+			return true;
+		}
+
+		const PakChunkTable* table = reinterpret_cast<const PakChunkTable*>(m_PakFile.GetData() + entry.Offset);
+		uint32_t firstChunk = static_cast<uint32_t>(offset / table->ChunkSize);
+		uint32_t lastChunk = static_cast<uint32_t>((offset + size - 1) / table->ChunkSize);
+
+		std::atomic<bool> failed = false;
+		auto readChunk = [&](uint32_t chunk)
+			{
+				uint64_t chunkBegin = static_cast<uint64_t>(chunk) * table->ChunkSize;
+				uint64_t chunkSize = std::min<uint64_t>(table->ChunkSize, table->UncompressedSize - chunkBegin);
+
+				uint64_t copyBegin = std::max(offset, chunkBegin);
+				uint64_t copyEnd = std::min(offset + size, chunkBegin + chunkSize);
+
+				if (copyBegin == chunkBegin && copyEnd == chunkBegin + chunkSize)
+				{
+					if (!DecompressChunk(entry, chunk, outData + (chunkBegin - offset)))
+						failed = true;
+					return;
+				}
+
+				// Partially covered chunk at either end of the range
+				std::vector<uint8_t> scratch(chunkSize);
+				if (!DecompressChunk(entry, chunk, scratch.data()))
+				{
+					failed = true;
+					return;
+				}
+				std::memcpy(outData + (copyBegin - offset), scratch.data() + (copyBegin - chunkBegin), copyEnd - copyBegin);
+			};
+
+		if (firstChunk == lastChunk)
+		{
+			readChunk(firstChunk);
+		}
+		else
+		{
+			enki::TaskSet decompressTask(lastChunk - firstChunk + 1, [&](enki::TaskSetPartition range, uint32_t threadnum)
+				{
+					for (uint32_t i = range.start; i < range.end; i++)
+						readChunk(firstChunk + i);
+				});
+
+			enki::TaskScheduler& scheduler = Application::Get().GetScheduler().GetTaskScheduler();
+			scheduler.AddTaskSetToPipe(&decompressTask);
+			scheduler.WaitforTask(&decompressTask);
+		}
+
+		return !failed;
+	}
+
+	bool RuntimeAssetManager::DecompressChunk(const PakTOCEntry& entry, uint32_t chunkIndex, uint8_t* outData) const
+	{
+		const uint8_t* blob = m_PakFile.GetData() + entry.Offset;
+		const PakChunkTable* table = reinterpret_cast<const PakChunkTable*>(blob);
+		const PakChunk& chunk = reinterpret_cast<const PakChunk*>(blob + sizeof(PakChunkTable))[chunkIndex];
+
+		uint64_t chunkBegin = static_cast<uint64_t>(chunkIndex) * table->ChunkSize;
+		uint64_t chunkSize = std::min<uint64_t>(table->ChunkSize, table->UncompressedSize - chunkBegin);
+		const uint8_t* payload = blob + chunk.Offset;
+
+		if (Hash::Compute64(payload, chunk.StoredSize) != chunk.Checksum)
+		{
+			GX_CORE_ERROR("Chunk {} of asset {} failed its checksum, the asset pack is corrupt", chunkIndex, entry.Handle);
+			return false;
+		}
+
+		if (chunk.Flags & PakChunkStored)
+		{
+			if (chunk.StoredSize != chunkSize)
+				return false;
+
+			std::memcpy(outData, payload, chunkSize);
+			return true;
+		}
+
+		bool useDictionary = (entry.Flags & PakEntryDictionary) != 0;
+		if (!PakCompression::Decompress(payload, chunk.StoredSize, outData, chunkSize,
+			useDictionary ? m_Dictionary : nullptr, useDictionary ? m_DictionarySize : 0))
+		{
+			GX_CORE_ERROR("Chunk {} of asset {} failed to decompress", chunkIndex, entry.Handle);
+			return false;
+		}
+
+		return true;
+	}
+
+	Ref<Asset> RuntimeAssetManager::GetAsset(AssetHandle handle)
+	{
+		GX_PROFILE_FUNCTION();
+
+		auto it = m_LoadedAssets.find(handle);
+		if (it != m_LoadedAssets.end())
+		{
+			m_Residency.Touch(handle);
+			return it->second;
+		}
+
+		const PakTOCEntry* entry = FindEntry(handle);
+		if (entry == nullptr)
+			return nullptr;
+
+		if (!VerifyEntry(*entry))
+			return nullptr;
+
+		Ref<Asset> asset = LoadAsset(*entry);
+		if (asset)
+		{
+			m_LoadedAssets[handle] = asset;
+			m_SlotTable.Publish(handle, asset);
+			m_Residency.OnLoaded(handle, asset.Raw());
+		}
+
+		return asset;
+	}
+
+	void RuntimeAssetManager::RequestLoad(AssetHandle handle, const AssetLoadOptions& options)
+	{
+		// Pack reads are memory reads, so there is nothing worth deferring
+		if (options.CancelToken && options.CancelToken->IsCancelled())
+			return;
+
+		GetAsset(handle);
+	}
+
+	Ref<Asset> RuntimeAssetManager::LoadAsset(const PakTOCEntry& entry)
+	{
+		GX_PROFILE_FUNCTION();
+
+		AssetHandle handle = entry.Handle;
+
+		// Raw entries are read straight out of the mapping; large payloads are handed on without a copy
+		const uint8_t* data = m_PakFile.GetData() + entry.Offset;
+		uint64_t size = entry.Size;
+
+		std::vector<uint8_t> decompressed;
+		if (entry.Flags & PakEntryCompressed)
+		{
+			decompressed.resize(GetUncompressedSize(entry));
+			if (!ReadEntryRange(entry, 0, decompressed.size(), decompressed.data()))
+				return nullptr;
+
+			data = decompressed.data();
+			size = decompressed.size();
+		}
+
+		try
+		{
+			BinaryDeserializer deserializer(data, size, PAK_ASSET_VERSION, false);
+
+			switch (entry.Type)
+			{
+			case AssetType::Texture2D:
+			{
+				uint32_t width = deserializer.Read<uint32_t>();
+				uint32_t height = deserializer.Read<uint32_t>();
+				TextureSpecification spec;
+				spec.Format = static_cast<TextureFormat>(deserializer.Read<uint32_t>());
+				spec.MipLevels = deserializer.Read<uint32_t>();
+				spec.DebugName = handle.ToString();
+
+				if (spec.Format > TextureFormat::BC4 || spec.MipLevels == 0 || spec.MipLevels > GetFullMipChainLevels(width, height))
+				{
+					GX_CORE_ERROR("Texture {} has an invalid format in the asset pack", handle.ToString());
+					return nullptr;
+				}
+
+				uint64_t dataSize = GetTextureMipChainSize(spec.Format, width, height, spec.MipLevels);
+				if (deserializer.GetRemainingSize() < dataSize)
+				{
+					GX_CORE_ERROR("Texture {} is truncated in the asset pack", handle.ToString());
+					return nullptr;
+				}
+
+				// Texture2D::Create copies into GPU memory and does not take ownership
+				Buffer data;
+				data.Data = const_cast<uint8_t*>(deserializer.GetReadPointer());
+				data.Size = dataSize;
+
+				return Texture2D::Create(data, width, height, spec);
+			}
+			case AssetType::Shader:
+			{
+				ShaderType type = static_cast<ShaderType>(deserializer.Read<uint32_t>());
+
+				uint64_t stageCount = deserializer.Read<uint64_t>();
+				std::vector<std::vector<uint32_t>> spirv(stageCount);
+				for (std::vector<uint32_t>& stage : spirv)
+				{
+					stage.resize(deserializer.Read<uint64_t>());
+					deserializer.ReadBytes(stage.data(), stage.size() * sizeof(uint32_t));
+				}
+
+				ShaderReflection reflection = deserializer.Read<ShaderReflection>();
+				return Shader::Create(handle.ToString(), type, spirv, reflection);
+			}
+			case AssetType::Pipeline:
+				return CreateRef<Pipeline>(deserializer.Read<PipelineConfiguration>());
+			case AssetType::Material:
+			{
+				AssetHandle shaderHandle = deserializer.Read<uint64_t>();
+				AssetHandle pipelineHandle = deserializer.Read<uint64_t>();
+
+				Ref<Shader> shader = Cast<Shader>(GetAsset(shaderHandle));
+				Ref<Pipeline> pipeline = Cast<Pipeline>(GetAsset(pipelineHandle));
+				if (!shader || !pipeline)
+				{
+					GX_CORE_ERROR("Material {} references a shader or pipeline missing from the asset pack", handle.ToString());
+					return nullptr;
+				}
+
+				return Material::Create(shader, pipeline);
+			}
+			case AssetType::Scene:
+			{
+				Ref<Scene> scene = CreateRef<Scene>();
+				SceneSerializer serializer(scene);
+				if (!serializer.DeserializeRuntime(deserializer))
+					return nullptr;
+
+				return scene;
+			}
+			default:
+				GX_CORE_ERROR("Asset {} has unsupported type {} in the asset pack", handle.ToString(), AssetTypeToString(entry.Type));
+				return nullptr;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			GX_CORE_ERROR("Failed to load asset {} from pack: {}", handle.ToString(), e.what());
+			return nullptr;
+		}
+	}
+
+	void RuntimeAssetManager::PushToCompletionQueue(Ref<AsyncLoadRequest> request)
+	{
+		m_CompletionQueue.Push(std::move(request));
+	}
+
+	void RuntimeAssetManager::ProcessAsyncLoads()
+	{
+		GX_PROFILE_FUNCTION();
+
+		m_SlotTable.SetFrame(m_Residency.BeginFrame());
+
+		ProcessCompletedLoads();
+
+		// Evicted assets reload from the mapped pack on their next use
+		Device* device = Application::Get().GetWindow().GetDevice();
+		for (AssetHandle handle : m_Residency.SelectEvictions())
+		{
+			auto it = m_LoadedAssets.find(handle);
+			if (it == m_LoadedAssets.end())
+				continue;
+
+			device->DeferRelease(std::move(it->second));
+			m_LoadedAssets.erase(it);
+			m_SlotTable.Evict(handle);
+			m_Residency.OnUnloaded(handle);
+		}
+	}
+
+	void RuntimeAssetManager::ProcessCompletedLoads()
+	{
+		// Taken out of the member, since creating an asset may wait on another and come back in here
+		std::vector<Ref<AsyncLoadRequest>> completedRequests = std::move(m_CompletedRequestsCache);
+		completedRequests.clear();
+		{
+			Ref<AsyncLoadRequest> request;
+			while (m_CompletionQueue.TryPop(request))
+				completedRequests.push_back(std::move(request));
+		}
+
+		// Pack reads are plain memory reads, so the GPU-side creation happens here on the main thread
+		for (Ref<AsyncLoadRequest>& request : completedRequests)
+		{
+			if (request->State == AssetState::Failed || !GetAsset(request->Handle))
+			{
+				GX_CORE_ERROR("Failed to load asset {} from pack", request->Handle.ToString());
+				request->State = AssetState::Failed;
+				continue;
+			}
+
+			request->State = AssetState::Loaded;
+		}
+		completedRequests.clear();
+		m_CompletedRequestsCache = std::move(completedRequests);
 
+		ResolveLoadStates();
+	}
 
-}
\ No newline at end of file
+}
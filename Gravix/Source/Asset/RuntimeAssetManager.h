@@ -1,10 +1,75 @@
 #pragma once
 
 #include "AssetManagerBase.h"
+#include "AssetPack/PakFormat.h"
+#include "Core/MappedFile.h"
+#include "Core/MPSCQueue.h"
+
+#include <filesystem>
+#include <vector>
 
 namespace Gravix 
 {
+
+	// Serves assets out of a memory-mapped GPAK archive built by PakBuilder.
+	// Lookups binary search the TOC in place; no file is opened after OpenPak.
 	class RuntimeAssetManager : public AssetManagerBase
 	{
+	public:
+		RuntimeAssetManager() = default;
+		virtual ~RuntimeAssetManager() = default;
+
+		bool OpenPak(const std::filesystem::path& pakPath);
+		void ClosePak();
+
+		virtual Ref<Asset> GetAsset(AssetHandle handle) override;
+		virtual void RequestLoad(AssetHandle handle, const AssetLoadOptions& options = {}) override;
+
+		virtual bool IsAssetHandleValid(AssetHandle handle) const override;
+		virtual bool IsAssetLoaded(AssetHandle handle) const override;
+		// Loads finish inside RequestLoad, so nothing is ever in progress
+		virtual bool IsAssetLoading(AssetHandle handle) const override { return false; }
+		virtual AssetType GetAssetType(AssetHandle handle) const override;
+
+		virtual void PushToCompletionQueue(Ref<AsyncLoadRequest> request) override;
+		virtual void ProcessAsyncLoads() override;
+		virtual void ProcessCompletedLoads() override;
+
+		// Cooked bytes of an asset. Compressed chunks are spread over the task scheduler.
+		bool ReadAsset(AssetHandle handle, std::vector<uint8_t>& outData);
+		// Reads [offset, offset + size) of the cooked bytes, decompressing only the chunks it overlaps
+		bool ReadAssetRange(AssetHandle handle, uint64_t offset, uint64_t size, void* outData);
+		uint64_t GetAssetSize(AssetHandle handle);
+
+		void SetResidencyBudget(const AssetResidencyBudget& budget) { m_Residency.SetBudget(budget); }
+
+		uint32_t GetAssetCount() const { return m_EntryCount; }
+		const std::filesystem::path& GetPakPath() const { return m_PakFile.GetPath(); }
+	private:
+		const PakTOCEntry* FindEntry(AssetHandle handle) const;
+		bool VerifyEntry(const PakTOCEntry& entry);
+
+		uint64_t GetUncompressedSize(const PakTOCEntry& entry) const;
+		bool ReadEntryRange(const PakTOCEntry& entry, uint64_t offset, uint64_t size, uint8_t* outData);
+		bool DecompressChunk(const PakTOCEntry& entry, uint32_t chunkIndex, uint8_t* outData) const;
+
+		Ref<Asset> LoadAsset(const PakTOCEntry& entry);
+	private:
+		MappedFile m_PakFile;
+		const PakTOCEntry* m_TOC = nullptr;
+		uint32_t m_EntryCount = 0;
+
+		const uint8_t* m_Dictionary = nullptr;
+		uint64_t m_DictionarySize = 0;
+
+		AssetMap m_LoadedAssets;
+
+		// Entry index -> checksum (or chunk table) already verified, so repeat loads skip the hash
+		std::vector<bool> m_VerifiedEntries;
+
+		MPSCQueue<Ref<AsyncLoadRequest>> m_CompletionQueue;
+
+		// Reused vector to avoid allocations in ProcessAsyncLoads
+		std::vector<Ref<AsyncLoadRequest>> m_CompletedRequestsCache;
 	};
-}
\ No newline at end of file
+}
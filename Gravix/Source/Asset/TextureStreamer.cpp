@@ -0,0 +1,294 @@
+#include "pch.h"
+#include "TextureStreamer.h"
+
+#include "Importers/TextureCache.h"
+
+#include "Core/Application.h"
+#include "Core/Scheduler.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Nothing has drawn the texture for this long, so its detail is the first to go
+		constexpr uint64_t IdleFrames = 120;
+
+		// Keeps one batch from stalling the frame that uploads it
+		constexpr uint64_t MaxBytesPerBatch = 64ull * 1024 * 1024;
+	}
+
+	struct TextureStreamer::ReadTask : enki::ITaskSet
+	{
+		struct Read
+		{
+			AssetHandle Handle;
+			Ref<Texture2D> Texture;
+			uint64_t CacheKey;
+			uint32_t FirstMip;
+
+			// Written by the worker
+			CookedTexture2D Result;
+			bool Succeeded = false;
+		};
+
+		std::vector<Read> Reads;
+
+		void ExecuteRange(enki::TaskSetPartition range, uint32_t threadNum) override
+		{
+			for (uint32_t i = range.start; i < range.end; i++)
+			{
+				Read& read = Reads[i];
+				read.Succeeded = TextureCache::ReadLevels(read.CacheKey, read.FirstMip, read.Result);
+			}
+		}
+	};
+
+	TextureStreamer::TextureStreamer()
+		: m_ReadTask(CreateScope<ReadTask>())
+	{
+		// Textures already draw with what they have; loads something is waiting on go first
+		m_ReadTask->m_Priority = enki::TASK_PRIORITY_LOW;
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		WaitForReads();
+	}
+
+	void TextureStreamer::Register(AssetHandle handle, const Ref<Texture2D>& texture, uint64_t cacheKey)
+	{
+		Entry& entry = m_Entries[handle];
+		entry = Entry{};
+		entry.Texture = texture;
+		entry.CacheKey = cacheKey;
+		entry.WantedMip = texture->GetResidentMip();
+		entry.LastRequestedFrame = m_Frame;
+	}
+
+	void TextureStreamer::Unregister(AssetHandle handle)
+	{
+		// A read still in flight for it is dropped when it completes
+		m_Entries.erase(handle);
+	}
+
+	void TextureStreamer::Clear()
+	{
+		WaitForReads();
+		m_Entries.clear();
+	}
+
+	void TextureStreamer::Update(uint64_t frame, std::vector<AssetHandle>& outChanged)
+	{
+		GX_PROFILE_FUNCTION();
+
+		m_Frame = frame;
+
+		ApplyCompletedReads(outChanged);
+		UpdateWantedMips(frame);
+
+		// One batch at a time, so the plan always starts from what is actually resident
+		if (m_ReadTask->Reads.empty())
+			PlanReads();
+
+		m_Stats.StreamedTextures = static_cast<uint32_t>(m_Entries.size());
+		m_Stats.BudgetBytes = m_Budget;
+		m_Stats.ReadsInFlight = static_cast<uint32_t>(m_ReadTask->Reads.size());
+	}
+
+	void TextureStreamer::ApplyCompletedReads(std::vector<AssetHandle>& outChanged)
+	{
+		if (m_ReadTask->Reads.empty() || !m_ReadTask->GetIsComplete())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		for (ReadTask::Read& read : m_ReadTask->Reads)
+		{
+			// Unregistered or replaced by a reload while the read was in flight
+			auto it = m_Entries.find(read.Handle);
+			if (it == m_Entries.end() || it->second.Texture.Raw() != read.Texture.Raw())
+			{
+				read.Result.Data.Release();
+				continue;
+			}
+
+			Entry& entry = it->second;
+			Texture2D& texture = *entry.Texture;
+
+			bool matches = read.Succeeded
+				&& read.Result.FirstMip == read.FirstMip
+				&& read.Result.Width == texture.GetWidth()
+				&& read.Result.Height == texture.GetHeight()
+				&& read.Result.MipLevels == texture.GetMipLevels()
+				&& read.Result.Format == texture.GetFormat();
+			if (!matches)
+			{
+				GX_CORE_WARN("Texture streaming stopped for asset {0}: its cache entry is missing or changed", (uint64_t)read.Handle);
+				entry.Failed = true;
+				read.Result.Data.Release();
+				continue;
+			}
+
+			bool refined = read.FirstMip < texture.GetResidentMip();
+			texture.SetResidentLevels(read.Result.Data, read.FirstMip);
+			read.Result.Data.Release();
+
+			if (refined)
+				m_Stats.RefinedTotal++;
+			else
+				m_Stats.DroppedTotal++;
+			outChanged.push_back(read.Handle);
+		}
+
+		m_ReadTask->Reads.clear();
+	}
+
+	void TextureStreamer::UpdateWantedMips(uint64_t frame)
+	{
+		for (auto& [handle, entry] : m_Entries)
+		{
+			uint32_t requestedMip = entry.Texture->ConsumeRequestedMip();
+			if (requestedMip != Texture2D::NoMipRequested)
+			{
+				entry.WantedMip = std::min(requestedMip, entry.Texture->GetMipLevels() - 1);
+				entry.LastRequestedFrame = frame;
+			}
+			else if (frame - entry.LastRequestedFrame > IdleFrames)
+			{
+				entry.WantedMip = GetTailMip(*entry.Texture);
+			}
+		}
+	}
+
+	void TextureStreamer::PlanReads()
+	{
+		struct Candidate
+		{
+			AssetHandle Handle;
+			Entry* State;
+			uint32_t ResidentMip;
+		};
+
+		std::vector<Candidate> refines;
+		std::vector<Candidate> drops;
+		uint64_t residentBytes = 0;
+		for (auto& [handle, entry] : m_Entries)
+		{
+			uint32_t residentMip = entry.Texture->GetResidentMip();
+			residentBytes += GetResidentSize(*entry.Texture, residentMip);
+			if (entry.Failed)
+				continue;
+
+			if (residentMip > entry.WantedMip)
+				refines.push_back({ handle, &entry, residentMip });
+			else if (residentMip < entry.WantedMip)
+				drops.push_back({ handle, &entry, residentMip });
+		}
+		m_Stats.ResidentBytes = residentBytes;
+
+		if (refines.empty() && (drops.empty() || residentBytes <= m_Budget))
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		// Whatever is furthest from what the screen needs first; ties go to what was drawn last
+		std::sort(refines.begin(), refines.end(), [](const Candidate& a, const Candidate& b)
+			{
+				uint32_t gapA = a.ResidentMip - a.State->WantedMip;
+				uint32_t gapB = b.ResidentMip - b.State->WantedMip;
+				if (gapA != gapB)
+					return gapA > gapB;
+				return a.State->LastRequestedFrame > b.State->LastRequestedFrame;
+			});
+		// Detail that has gone unused the longest is given back first
+		std::sort(drops.begin(), drops.end(), [](const Candidate& a, const Candidate& b)
+			{
+				return a.State->LastRequestedFrame < b.State->LastRequestedFrame;
+			});
+
+		std::vector<ReadTask::Read>& reads = m_ReadTask->Reads;
+		uint64_t projectedBytes = residentBytes;
+		uint64_t batchBytes = 0;
+		size_t nextDrop = 0;
+
+		auto queueRead = [&](const Candidate& candidate, uint32_t firstMip)
+			{
+				reads.push_back({ candidate.Handle, candidate.State->Texture, candidate.State->CacheKey, firstMip });
+				batchBytes += GetResidentSize(*candidate.State->Texture, firstMip);
+			};
+
+		// Drops only ever go down to what the texture is still drawn at, so nothing on screen loses detail
+		auto dropNext = [&]()
+			{
+				const Candidate& drop = drops[nextDrop++];
+				const Texture2D& texture = *drop.State->Texture;
+				projectedBytes -= GetResidentSize(texture, drop.ResidentMip) - GetResidentSize(texture, drop.State->WantedMip);
+				queueRead(drop, drop.State->WantedMip);
+			};
+
+		for (const Candidate& refine : refines)
+		{
+			if (batchBytes >= MaxBytesPerBatch)
+				break;
+
+			const Texture2D& texture = *refine.State->Texture;
+			uint64_t currentBytes = GetResidentSize(texture, refine.ResidentMip);
+
+			// Make room by giving back idle detail, and settle for less when there is none left
+			uint32_t targetMip = refine.State->WantedMip;
+			while (targetMip < refine.ResidentMip && projectedBytes + GetResidentSize(texture, targetMip) - currentBytes > m_Budget)
+			{
+				if (nextDrop < drops.size())
+					dropNext();
+				else
+					targetMip++;
+			}
+
+			if (targetMip >= refine.ResidentMip)
+				continue;
+
+			projectedBytes += GetResidentSize(texture, targetMip) - currentBytes;
+			queueRead(refine, targetMip);
+		}
+
+		// The budget was lowered, or the scene no longer needs what it streamed in
+		while (projectedBytes > m_Budget && nextDrop < drops.size())
+			dropNext();
+
+		if (reads.empty())
+			return;
+
+		m_ReadTask->m_SetSize = static_cast<uint32_t>(reads.size());
+		m_ReadTask->m_MinRange = 1;
+		Application::Get().GetScheduler().GetTaskScheduler().AddTaskSetToPipe(m_ReadTask.get());
+	}
+
+	void TextureStreamer::WaitForReads()
+	{
+		if (m_ReadTask->Reads.empty())
+			return;
+
+		if (!m_ReadTask->GetIsComplete())
+			Application::Get().GetScheduler().GetTaskScheduler().WaitforTask(m_ReadTask.get());
+
+		for (ReadTask::Read& read : m_ReadTask->Reads)
+			read.Result.Data.Release();
+		m_ReadTask->Reads.clear();
+	}
+
+	uint32_t TextureStreamer::GetTailMip(const Texture2D& texture)
+	{
+		return GetFirstMipWithin(texture.GetWidth(), texture.GetHeight(), texture.GetMipLevels(), InitialMaxDimension);
+	}
+
+	uint64_t TextureStreamer::GetResidentSize(const Texture2D& texture, uint32_t firstMip)
+	{
+		return GetTextureMipChainSize(texture.GetFormat(), std::max(texture.GetWidth() >> firstMip, 1u),
+			std::max(texture.GetHeight() >> firstMip, 1u), texture.GetMipLevels() - firstMip);
+	}
+
+}
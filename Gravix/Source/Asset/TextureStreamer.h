@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Asset.h"
+
+#include "Renderer/Generic/Types/Texture.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	struct TextureStreamingStats
+	{
+		uint32_t StreamedTextures = 0;
+		uint64_t ResidentBytes = 0;
+		uint64_t BudgetBytes = 0;
+		uint32_t ReadsInFlight = 0;
+
+		uint64_t RefinedTotal = 0; // Reads that added detail
+		uint64_t DroppedTotal = 0; // Reads that gave detail back to stay within budget
+	};
+
+	// Streams the mip chains of cooked textures in and out of device memory. Textures load
+	// with only their smallest levels resident; each frame the draws report the most detailed
+	// level they could sample, and the streamer reads the missing levels from the texture
+	// cache on a worker and swaps them in. Everything resident stays within one budget, so
+	// detail nothing has drawn for a while is given back first. Main thread only.
+	class TextureStreamer
+	{
+	public:
+		TextureStreamer();
+		~TextureStreamer();
+
+		TextureStreamer(const TextureStreamer&) = delete;
+		TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+		// cacheKey names the texture cache entry holding the texture's full chain
+		void Register(AssetHandle handle, const Ref<Texture2D>& texture, uint64_t cacheKey);
+		void Unregister(AssetHandle handle);
+		void Clear();
+
+		void SetBudget(uint64_t bytes) { m_Budget = bytes; }
+
+		// Swaps in the levels read since the last call and starts the next reads. Handles whose
+		// resident levels changed are appended to outChanged. Call once per frame.
+		void Update(uint64_t frame, std::vector<AssetHandle>& outChanged);
+
+		const TextureStreamingStats& GetStats() const { return m_Stats; }
+
+		// Loads read levels no larger than this; the rest is streamed
+		static constexpr uint32_t InitialMaxDimension = 64;
+	private:
+		struct Entry
+		{
+			Ref<Texture2D> Texture;
+			uint64_t CacheKey = 0;
+			uint32_t WantedMip = 0;
+			uint64_t LastRequestedFrame = 0;
+			bool Failed = false; // Cache entry unreadable; stays at what it has
+		};
+
+		struct ReadTask;
+
+		void ApplyCompletedReads(std::vector<AssetHandle>& outChanged);
+		void UpdateWantedMips(uint64_t frame);
+		void PlanReads();
+		void WaitForReads();
+
+		static uint32_t GetTailMip(const Texture2D& texture);
+		static uint64_t GetResidentSize(const Texture2D& texture, uint32_t firstMip);
+	private:
+		std::unordered_map<AssetHandle, Entry> m_Entries;
+		uint64_t m_Budget = 512ull * 1024 * 1024;
+		uint64_t m_Frame = 0;
+
+		// Owned by a worker while in flight
+		Scope<ReadTask> m_ReadTask;
+
+		TextureStreamingStats m_Stats;
+	};
+
+}
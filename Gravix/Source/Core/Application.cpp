@@ -10,6 +10,8 @@
 #include "Asset/EditorAssetManager.h"
 #include "Debug/Instrumentor.h"
 
+#include "Platform/Headless/HeadlessWindow.h"
+
 namespace Gravix
 {
 	Application* Application::s_Instance = nullptr;
@@ -25,18 +27,25 @@ namespace Gravix
 		windowSpec.Width = spec.Width;
 		windowSpec.Title = spec.Title;
 
-		m_Window = Window::Create(windowSpec);
+		m_IsHeadless = spec.Headless;
+		if (m_IsHeadless)
+			m_Window = CreateScope<HeadlessWindow>(windowSpec);
+		else
+			m_Window = Window::Create(windowSpec);
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
 
 		m_IsRunning = true;
 		m_LastFrameTime = std::chrono::high_resolution_clock::now();
 		m_IsRuntime = spec.IsRuntime;
+		m_FrameLimit = spec.FrameLimit;
 
 		m_Scheduler = CreateScope<Scheduler>();
 		m_Scheduler->Init(4); // Initialize with 4 threads
 
 #ifdef GRAVIX_EDITOR_BUILD
-		m_ImGuiRender = CreateRef<ImGuiRender>();
+		// ImGui renders through the Vulkan device; there is nothing to draw into when headless
+		if (!m_IsHeadless)
+			m_ImGuiRender = CreateRef<ImGuiRender>();
 #endif
 		ComponentRegistry::Get().RegisterAllComponents();
 
@@ -57,6 +66,7 @@ namespace Gravix
 
 		const float MAX_TIMESTEP = 0.05f; // 50ms max
 		std::chrono::time_point<std::chrono::high_resolution_clock> currentTime;
+		uint32_t frameCount = 0;
 
 		while (m_IsRunning)
 		{
@@ -77,9 +87,9 @@ namespace Gravix
 					GX_PROFILE_SCOPE("ProcessAsyncLoads");
 					if (auto activeProject = Project::GetActive())
 					{
-						if (auto editorAssetManager = activeProject->GetEditorAssetManager())
+						if (auto assetManager = activeProject->GetAssetManager())
 						{
-							editorAssetManager->ProcessAsyncLoads();
+							assetManager->ProcessAsyncLoads();
 						}
 					}
 				}
@@ -96,7 +106,7 @@ namespace Gravix
 						layer->OnRender();
 				}
 
-				if (!m_IsRuntime)
+				if (!m_IsRuntime && !m_IsHeadless)
 				{
 #ifdef GRAVIX_EDITOR_BUILD
 					{
@@ -123,6 +133,9 @@ namespace Gravix
 			}
 
 			m_Window->GetDevice()->EndFrame();
+
+			if (m_FrameLimit != 0 && ++frameCount >= m_FrameLimit)
+				Shutdown();
 		}
 
 		// ImGuiRender will be automatically cleaned up by Ref<>
@@ -143,7 +156,8 @@ namespace Gravix
 		dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FN(OnWindowResize));
 
 #ifdef GRAVIX_EDITOR_BUILD
-		m_ImGuiRender->OnEvent(event);
+		if (m_ImGuiRender)
+			m_ImGuiRender->OnEvent(event);
 #endif
 		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin();)
 		{
@@ -38,6 +38,8 @@ namespace Gravix
 		bool IsRuntime = false;         ///< Runtime mode (packaged game) vs editor mode
 
 		bool VSync = true;              ///< Enable vertical synchronization
+		bool Headless = false;          ///< No window or GPU: render through the Null device (servers, CI, benchmarks)
+		uint32_t FrameLimit = 0;        ///< Stop after this many frames; 0 runs until Shutdown()
 	};
 
 	/**
@@ -127,6 +129,12 @@ namespace Gravix
 		 */
 		bool IsRuntime() { return m_IsRuntime; }
 
+		/**
+		 * @brief Check if running without a window or GPU
+		 * @return true if rendering through the Null device
+		 */
+		bool IsHeadless() { return m_IsHeadless; }
+
 		/**
 		 * @brief Get the application window
 		 * @return Reference to the main window
@@ -178,6 +186,8 @@ namespace Gravix
 		bool m_IsRunning = false;
 		bool m_IsMinimize = false;
 		bool m_IsRuntime = false;
+		bool m_IsHeadless = false;
+		uint32_t m_FrameLimit = 0;
 
 		std::vector<Ref<Layer>> m_LayerStack;
 		std::chrono::time_point<std::chrono::high_resolution_clock> m_LastFrameTime;
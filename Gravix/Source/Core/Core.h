@@ -10,9 +10,14 @@
 #endif
 
 #ifdef GX_ENABLE_ASSERTS
-#define GX_ASSERT(x, ...) {if(!(x)) { GX_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); }}
+#ifdef ENGINE_PLATFORM_WINDOWS
 #define GX_DEBUGBREAK() __debugbreak();
-#define GX_VERIFY(...) { GX_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); }
+#else
+#include <csignal>
+#define GX_DEBUGBREAK() std::raise(SIGTRAP);
+#endif
+#define GX_ASSERT(x, ...) {if(!(x)) { GX_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); GX_DEBUGBREAK() }}
+#define GX_VERIFY(...) { GX_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); GX_DEBUGBREAK() }
 #else
 #define GX_ASSERT(x, ...)
 #define GX_DEBUGBREAK()
@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "FileWatcher.h"
 #include "Core/Log.h"
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+#include <unordered_set>
 
 namespace Gravix
 {
@@ -34,11 +38,14 @@ namespace Gravix
 		m_Callback = callback;
 		m_IsWatching = true;
 
+		// Before the scan, so nothing written while it runs goes unreported
+		m_Notifier = FileChangeNotifier::Create(m_WatchPath);
+
 		// Initial scan to populate file modification times
 		ScanDirectory();
 
-		GX_CORE_INFO("FileWatcher: Started watching {0} (found {1} files)",
-			m_WatchPath.string(), m_FileModTimes.size());
+		GX_CORE_INFO("FileWatcher: Started watching {0} (found {1} files, {2})",
+			m_WatchPath.string(), m_FileModTimes.size(), m_Notifier ? "notifications" : "polling");
 	}
 
 	void FileWatcher::StopWatching()
@@ -47,7 +54,10 @@ namespace Gravix
 			return;
 
 		m_IsWatching = false;
+		m_Notifier.reset();
 		m_FileModTimes.clear();
+		m_ScannedFiles.clear();
+		m_Changes.clear();
 		m_Callback = nullptr;
 	}
 
@@ -67,10 +77,133 @@ namespace Gravix
 		if (!m_IsWatching)
 			return;
 
+		if (!m_Notifier)
+		{
+			PollForChanges();
+			return;
+		}
+
+		m_Changes.clear();
+		if (!m_Notifier->ReadChanges(m_Changes))
+		{
+			// Events were dropped, so nothing short of a full rescan is reliable. A new notifier
+			// also picks up directories whose creation was among the lost events.
+			GX_CORE_WARN("FileWatcher: Lost change notifications for {0}, rescanning", m_WatchPath.string());
+			m_Notifier = FileChangeNotifier::Create(m_WatchPath);
+			PollForChanges();
+			return;
+		}
+
+		if (m_Changes.empty())
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		// A save usually touches the same file several times
+		std::sort(m_Changes.begin(), m_Changes.end(), [](const auto& a, const auto& b)
+			{
+				return a.Path != b.Path ? a.Path < b.Path : a.IsDirectory < b.IsDirectory;
+			});
+		m_Changes.erase(std::unique(m_Changes.begin(), m_Changes.end(), [](const auto& a, const auto& b)
+			{
+				return a.Path == b.Path && a.IsDirectory == b.IsDirectory;
+			}), m_Changes.end());
+
+		for (const FileChangeNotifier::Change& change : m_Changes)
+		{
+			if (change.IsDirectory)
+				CheckDirectory(change.Path);
+			else
+				CheckFile(change.Path);
+		}
+	}
+
+	void FileWatcher::CheckFile(const std::filesystem::path& path)
+	{
+		if (!PassesFilter(path))
+			return;
+
+		std::error_code error;
+		bool isFile = std::filesystem::is_regular_file(path, error);
+		auto lastWriteTime = isFile ? std::filesystem::last_write_time(path, error) : std::filesystem::file_time_type{};
+		if (error)
+			isFile = false;
+
+		std::string pathStr = path.string();
+		auto it = m_FileModTimes.find(pathStr);
+		if (!isFile)
+		{
+			if (it == m_FileModTimes.end())
+				return;
+
+			m_FileModTimes.erase(it);
+			if (m_Callback)
+				m_Callback(path, EventType::Removed);
+			return;
+		}
+
+		if (it == m_FileModTimes.end())
+		{
+			m_FileModTimes.emplace(std::move(pathStr), lastWriteTime);
+			if (m_Callback)
+				m_Callback(path, EventType::Added);
+		}
+		else if (it->second != lastWriteTime)
+		{
+			it->second = lastWriteTime;
+			if (m_Callback)
+				m_Callback(path, EventType::Modified);
+		}
+	}
+
+	void FileWatcher::CheckDirectory(const std::filesystem::path& directory)
+	{
+		std::unordered_set<std::string> presentFiles;
+
+		std::error_code error;
+		std::filesystem::recursive_directory_iterator it(directory, std::filesystem::directory_options::skip_permission_denied, error);
+		for (; !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			std::error_code statusError;
+			if (!it->is_regular_file(statusError) || !PassesFilter(it->path()))
+				continue;
+
+			presentFiles.insert(it->path().string());
+			CheckFile(it->path());
+		}
+
+		// Whatever is tracked under the directory but no longer in it went with the directory
+		std::string prefix = (directory / "").string();
+		std::vector<std::filesystem::path> removedFiles;
+		for (auto fileIt = m_FileModTimes.begin(); fileIt != m_FileModTimes.end();)
+		{
+			if (fileIt->first.starts_with(prefix) && !presentFiles.contains(fileIt->first))
+			{
+				removedFiles.emplace_back(fileIt->first);
+				fileIt = m_FileModTimes.erase(fileIt);
+			}
+			else
+			{
+				++fileIt;
+			}
+		}
+
+		if (m_Callback)
+		{
+			for (const std::filesystem::path& path : removedFiles)
+				m_Callback(path, EventType::Removed);
+		}
+	}
+
+	void FileWatcher::PollForChanges()
+	{
+		GX_PROFILE_FUNCTION();
+
 		try
 		{
 			// Scan directory for changes
-			std::unordered_map<std::string, std::filesystem::file_time_type> currentFiles;
+			std::unordered_map<std::string, std::filesystem::file_time_type>& currentFiles = m_ScannedFiles;
+			currentFiles.clear();
 
 			for (const auto& entry : std::filesystem::recursive_directory_iterator(
 				m_WatchPath,
@@ -124,7 +257,7 @@ namespace Gravix
 			}
 
 			// Update tracked files
-			m_FileModTimes = std::move(currentFiles);
+			std::swap(m_FileModTimes, currentFiles);
 		}
 		catch (const std::filesystem::filesystem_error& e)
 		{
@@ -7,15 +7,47 @@
 #include <unordered_map>
 #include <string>
 #include <chrono>
+#include <vector>
 
 namespace Gravix
 {
 
 	/**
-	 * @brief Cross-platform file watcher using std::filesystem polling
+	 * @brief Kernel change notifications for one directory tree
+	 *
+	 * Implemented per platform (inotify on Linux). Only says where to look; FileWatcher
+	 * stats those paths itself to decide what changed.
+	 */
+	class FileChangeNotifier
+	{
+	public:
+		struct Change
+		{
+			std::filesystem::path Path;
+			bool IsDirectory;
+		};
+
+		virtual ~FileChangeNotifier() = default;
+
+		/**
+		 * @brief Append the paths touched since the last call, without blocking
+		 * @return false if events were lost and the whole tree has to be rescanned
+		 */
+		virtual bool ReadChanges(std::vector<Change>& outChanges) = 0;
+
+		/**
+		 * @brief Watch a directory recursively
+		 * @return nullptr where the platform has no backend or it could not start
+		 */
+		static Scope<FileChangeNotifier> Create(const std::filesystem::path& directory);
+	};
+
+	/**
+	 * @brief Cross-platform file watcher
 	 *
 	 * Watches a directory recursively for file changes (added, modified, removed).
-	 * Works on Windows, Linux, and macOS.
+	 * Uses kernel notifications where FileChangeNotifier has a backend, so an idle check
+	 * costs nothing however large the tree is, and polls with std::filesystem elsewhere.
 	 *
 	 * Usage:
 	 *   FileWatcher watcher;
@@ -76,13 +108,26 @@ namespace Gravix
 		 */
 		const std::filesystem::path& GetWatchPath() const { return m_WatchPath; }
 
+		/**
+		 * @brief Whether changes come from kernel notifications rather than polling
+		 */
+		bool IsUsingNotifications() const { return (bool)m_Notifier; }
+
 	private:
 		void ScanDirectory();
+		void PollForChanges();
+		// Compare one path against what is tracked, reporting and recording any difference
+		void CheckFile(const std::filesystem::path& path);
+		// For directories that appeared, vanished or moved: their files report nothing themselves
+		void CheckDirectory(const std::filesystem::path& directory);
 		bool PassesFilter(const std::filesystem::path& path) const;
 
 	private:
 		std::filesystem::path m_WatchPath;
 		std::unordered_map<std::string, std::filesystem::file_time_type> m_FileModTimes;
+		std::unordered_map<std::string, std::filesystem::file_time_type> m_ScannedFiles; // Reused by each poll
+		Scope<FileChangeNotifier> m_Notifier;
+		std::vector<FileChangeNotifier::Change> m_Changes;
 		Callback m_Callback;
 		bool m_IsWatching = false;
 		std::string m_FileFilter; // Extension filter (e.g., ".cs")
@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "Hash.h"
+
+#include "Core/MappedFileCache.h"
+
+namespace Gravix
+{
+
+	static constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+	static constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+	static constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+	static constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+	static constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+	static inline uint64_t RotateLeft(uint64_t value, int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	static inline uint64_t Read64(const uint8_t* ptr)
+	{
+		uint64_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	static inline uint32_t Read32(const uint8_t* ptr)
+	{
+		uint32_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	static inline uint64_t Round(uint64_t acc, uint64_t input)
+	{
+		acc += input * PRIME64_2;
+		acc = RotateLeft(acc, 31);
+		return acc * PRIME64_1;
+	}
+
+	static inline uint64_t MergeRound(uint64_t acc, uint64_t value)
+	{
+		acc ^= Round(0, value);
+		return acc * PRIME64_1 + PRIME64_4;
+	}
+
+	uint64_t Hash::Compute64(const void* data, size_t size, uint64_t seed /*= 0*/)
+	{
+		const uint8_t* ptr = static_cast<const uint8_t*>(data);
+		const uint8_t* end = ptr + size;
+		uint64_t hash;
+
+		if (size >= 32)
+		{
+			// Four independent lanes over 32-byte stripes keep the multiplier pipeline busy
+			uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+			uint64_t v2 = seed + PRIME64_2;
+			uint64_t v3 = seed;
+			uint64_t v4 = seed - PRIME64_1;
+
+			const uint8_t* limit = end - 32;
+			do
+			{
+				v1 = Round(v1, Read64(ptr));      ptr += 8;
+				v2 = Round(v2, Read64(ptr));      ptr += 8;
+				v3 = Round(v3, Read64(ptr));      ptr += 8;
+				v4 = Round(v4, Read64(ptr));      ptr += 8;
+			} while (ptr <= limit);
+
+			hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+			hash = MergeRound(hash, v1);
+			hash = MergeRound(hash, v2);
+			hash = MergeRound(hash, v3);
+			hash = MergeRound(hash, v4);
+		}
+		else
+		{
+			hash = seed + PRIME64_5;
+		}
+
+		hash += static_cast<uint64_t>(size);
+
+		while (ptr + 8 <= end)
+		{
+			hash ^= Round(0, Read64(ptr));
+			hash = RotateLeft(hash, 27) * PRIME64_1 + PRIME64_4;
+			ptr += 8;
+		}
+
+		if (ptr + 4 <= end)
+		{
+			hash ^= static_cast<uint64_t>(Read32(ptr)) * PRIME64_1;
+			hash = RotateLeft(hash, 23) * PRIME64_2 + PRIME64_3;
+			ptr += 4;
+		}
+
+		while (ptr < end)
+		{
+			hash ^= static_cast<uint64_t>(*ptr) * PRIME64_5;
+			hash = RotateLeft(hash, 11) * PRIME64_1;
+			ptr++;
+		}
+
+		// Avalanche
+		hash ^= hash >> 33;
+		hash *= PRIME64_2;
+		hash ^= hash >> 29;
+		hash *= PRIME64_3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+
+	uint64_t Hash::ComputeContent64(const void* data, size_t size)
+	{
+		uint64_t hash = Compute64(data, size);
+		return hash != 0 ? hash : 1;
+	}
+
+	uint64_t Hash::ComputeFile64(const std::filesystem::path& path)
+	{
+		Ref<MappedFile> file = MappedFileCache::Open(path);
+		if (!file)
+			return 0;
+
+		return ComputeContent64(file->GetData(), file->GetSize());
+	}
+
+}
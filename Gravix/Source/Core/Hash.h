@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+
+namespace Gravix
+{
+
+	class Hash
+	{
+	public:
+		// 64-bit XXH64 of a byte range. Fast enough to run over whole assets; not cryptographic.
+		static uint64_t Compute64(const void* data, size_t size, uint64_t seed = 0);
+		// Compute64 for identifying file contents; never 0, which stands for "unknown"
+		static uint64_t ComputeContent64(const void* data, size_t size);
+		// ComputeContent64 of a whole file, read through MappedFileCache. 0 when the file cannot be read.
+		static uint64_t ComputeFile64(const std::filesystem::path& path);
+	};
+
+}
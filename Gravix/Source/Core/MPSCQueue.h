@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace Gravix
+{
+
+	// Unbounded multi-producer single-consumer queue (Vyukov). Push is lock-free on the
+	// queue links but allocates one node per push, and may be called from any thread;
+	// TryPop must only be called from the one consumer.
+	// An item whose producer is preempted mid-push shows up on a later TryPop.
+	template<typename T>
+	class MPSCQueue
+	{
+	public:
+		MPSCQueue()
+		{
+			Node* stub = new Node();
+			m_Head.store(stub, std::memory_order_relaxed);
+			m_Tail = stub;
+		}
+
+		~MPSCQueue()
+		{
+			T discarded;
+			while (TryPop(discarded)) {}
+			delete m_Tail;
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		void Push(T value)
+		{
+			// The allocation is the only part that can block; linking is a single exchange
+			Node* node = new Node();
+			node->Value = std::move(value);
+
+			Node* previous = m_Head.exchange(node, std::memory_order_acq_rel);
+			previous->Next.store(node, std::memory_order_release);
+		}
+
+		bool TryPop(T& outValue)
+		{
+			Node* tail = m_Tail;
+			Node* next = tail->Next.load(std::memory_order_acquire);
+			if (next == nullptr)
+				return false;
+
+			outValue = std::move(next->Value);
+			next->Value = T();
+
+			// The popped node becomes the new stub
+			m_Tail = next;
+			delete tail;
+			return true;
+		}
+
+		bool IsEmpty() const
+		{
+			return m_Tail->Next.load(std::memory_order_acquire) == nullptr;
+		}
+	private:
+		struct Node
+		{
+			std::atomic<Node*> Next = nullptr;
+			T Value{};
+		};
+
+		std::atomic<Node*> m_Head;
+		Node* m_Tail;
+	};
+
+}
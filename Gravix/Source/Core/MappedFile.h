@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/Buffer.h"
+
+#include <filesystem>
+#include <string_view>
+
+namespace Gravix
+{
+
+	// How the mapping will be read; tunes the OS read-ahead
+	enum class FileAccessPattern
+	{
+		Random,    // Lookups into an archive
+		Sequential // Decoded or parsed front to back
+	};
+
+	// Read-only memory mapping of a whole file. The OS pages data in on first
+	// touch, so opening is cheap regardless of file size.
+	class MappedFile : public RefCounted
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::filesystem::path& path, FileAccessPattern pattern = FileAccessPattern::Random);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+
+		const uint8_t* GetData() const { return m_Data; }
+		uint64_t GetSize() const { return m_Size; }
+		std::string_view GetText() const { return std::string_view(reinterpret_cast<const char*>(m_Data), m_Size); }
+		// The mapping itself, not a copy. Read-only: never write to it or release it.
+		Buffer GetBuffer() const
+		{
+			Buffer view;
+			view.Data = const_cast<uint8_t*>(m_Data);
+			view.Size = m_Size;
+			return view;
+		}
+		const std::filesystem::path& GetPath() const { return m_Path; }
+	private:
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+		std::filesystem::path m_Path;
+
+		// Mapping object on Windows, unused elsewhere. The file itself is closed once mapped.
+		void* m_MappingHandle = nullptr;
+	};
+
+}
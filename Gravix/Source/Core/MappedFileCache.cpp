@@ -0,0 +1,131 @@
+#include "pch.h"
+#include "MappedFileCache.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Held by plain pointer; the mapping leaves the cache when its last reader lets go of it
+		struct CachedFile
+		{
+			MappedFile* File = nullptr;
+			std::filesystem::file_time_type WriteTime;
+			uint64_t Size = 0;
+		};
+
+		struct CacheState
+		{
+			std::mutex Mutex;
+			std::unordered_map<std::string, CachedFile> Files;
+		};
+
+		CacheState& GetState()
+		{
+			static CacheState state;
+			return state;
+		}
+
+		std::string GetKey(const std::filesystem::path& path)
+		{
+			return path.lexically_normal().generic_string();
+		}
+
+		class CachedMappedFile : public MappedFile
+		{
+		public:
+			explicit CachedMappedFile(std::string key) : m_Key(std::move(key)) {}
+
+			~CachedMappedFile() override
+			{
+				// Only if still the cached one; an evicted or replaced mapping is no longer listed
+				CacheState& state = GetState();
+				std::lock_guard lock(state.Mutex);
+				auto it = state.Files.find(m_Key);
+				if (it != state.Files.end() && it->second.File == this)
+					state.Files.erase(it);
+			}
+		private:
+			std::string m_Key;
+		};
+
+		// Call with the lock held. Null if the mapping is already on its way out.
+		Ref<MappedFile> Acquire(MappedFile* file)
+		{
+			if (!file->TryIncRefCount())
+				return nullptr;
+
+			// Ref takes its own reference, so the one taken above is handed back
+			Ref<MappedFile> result(file);
+			file->DecRefCount();
+			return result;
+		}
+	}
+
+	Ref<MappedFile> MappedFileCache::Open(const std::filesystem::path& path)
+	{
+		// Checked on every open, so an edited file is never served from its old mapping
+		std::error_code error;
+		std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, error);
+		uint64_t size = error ? 0 : static_cast<uint64_t>(std::filesystem::file_size(path, error));
+		if (error)
+		{
+			Evict(path);
+			return nullptr;
+		}
+
+		CacheState& state = GetState();
+		std::string key = GetKey(path);
+		{
+			std::lock_guard lock(state.Mutex);
+			auto it = state.Files.find(key);
+			if (it != state.Files.end())
+			{
+				if (it->second.WriteTime == writeTime && it->second.Size == size)
+				{
+					if (Ref<MappedFile> cached = Acquire(it->second.File))
+						return cached;
+				}
+				state.Files.erase(it);
+			}
+		}
+
+		// Mapped outside the lock; a thread that raced us here maps the file too and the first one in wins
+		Ref<MappedFile> file = CreateRef<CachedMappedFile>(key);
+		if (!file->Open(path, FileAccessPattern::Sequential))
+			return nullptr;
+
+		Ref<MappedFile> existing;
+		{
+			std::lock_guard lock(state.Mutex);
+			auto [it, inserted] = state.Files.try_emplace(key, CachedFile{ file.Raw(), writeTime, size });
+			if (!inserted)
+			{
+				existing = Acquire(it->second.File);
+				if (!existing)
+					it->second = CachedFile{ file.Raw(), writeTime, size };
+			}
+		}
+
+		// Outside the lock: dropping the unused mapping takes it again
+		return existing ? existing : file;
+	}
+
+	void MappedFileCache::Evict(const std::filesystem::path& path)
+	{
+		CacheState& state = GetState();
+		std::lock_guard lock(state.Mutex);
+		state.Files.erase(GetKey(path));
+	}
+
+	void MappedFileCache::Clear()
+	{
+		CacheState& state = GetState();
+		std::lock_guard lock(state.Mutex);
+		state.Files.clear();
+	}
+
+}
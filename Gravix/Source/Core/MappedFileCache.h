@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Core/MappedFile.h"
+
+#include <filesystem>
+
+namespace Gravix
+{
+
+	// Engine-wide cache of read-only file mappings. Every stage that reads a source file asks
+	// here, so readers working on the same file at once (a dependency scan on a worker and the
+	// import) share one mapping. A mapping only lives as long as someone holds it: Windows will
+	// not let a mapped file be saved over, so nothing stays mapped once its readers are done.
+	// An edited file is mapped afresh; views already handed out stay valid. Thread safe.
+	class MappedFileCache
+	{
+	public:
+		// nullptr when the file is missing, empty or cannot be mapped
+		static Ref<MappedFile> Open(const std::filesystem::path& path);
+
+		// Later opens map the file again; current readers keep the old mapping
+		static void Evict(const std::filesystem::path& path);
+		static void Clear();
+	};
+
+}
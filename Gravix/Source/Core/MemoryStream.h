@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <streambuf>
+
+namespace Gravix
+{
+
+	// std::istream reading straight from memory it does not own, for parsers that only take
+	// streams (yaml-cpp). The memory has to outlive the stream.
+	class MemoryInputStream : private std::streambuf, public std::istream
+	{
+	public:
+		MemoryInputStream(const void* data, uint64_t size)
+			: std::istream(static_cast<std::streambuf*>(this))
+		{
+			char* begin = const_cast<char*>(static_cast<const char*>(data));
+			setg(begin, begin, begin + size);
+		}
+	};
+
+}
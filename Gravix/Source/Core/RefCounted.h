@@ -26,6 +26,19 @@ namespace Gravix
 			}
 		}
 
+		// Takes a reference only while the object is still alive, for holders that keep a
+		// plain pointer to it and may find it already on its way to deletion
+		bool TryIncRefCount() const
+		{
+			uint32_t count = m_RefCount.load(std::memory_order_relaxed);
+			while (count != 0)
+			{
+				if (m_RefCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+					return true;
+			}
+			return false;
+		}
+
 		uint32_t GetRefCount() const { return m_RefCount.load(std::memory_order_relaxed); }
 
 	private:
@@ -3,6 +3,21 @@
 
 namespace Gravix
 {
+
+	struct Scheduler::FunctionTask : enki::ITaskSet
+	{
+		std::function<void()> Function;
+
+		void ExecuteRange(enki::TaskSetPartition range, uint32_t threadNum) override
+		{
+			// Moved out so whatever it captured is released as soon as it has run
+			std::function<void()> function = std::move(Function);
+			function();
+		}
+	};
+
+	Scheduler::Scheduler() = default;
+	Scheduler::~Scheduler() = default;
 	
 	void Scheduler::Init(uint32_t threadCount /*= std::thread::hardware_concurrency()*/)
 	{
@@ -12,5 +27,24 @@ namespace Gravix
 		m_TaskScheduler.Initialize(config);
 	}
 
+	void Scheduler::Dispatch(std::function<void()> function, enki::TaskPriority priority)
+	{
+		FunctionTask* task = nullptr;
+		for (Scope<FunctionTask>& pooled : m_FunctionTasks)
+		{
+			if (pooled->GetIsComplete())
+			{
+				task = pooled.get();
+				break;
+			}
+		}
+
+		if (!task)
+			task = m_FunctionTasks.emplace_back(CreateScope<FunctionTask>()).get();
+
+		task->Function = std::move(function);
+		task->m_Priority = priority;
+		m_TaskScheduler.AddTaskSetToPipe(task);
+	}
 	
-}
\ No newline at end of file
+}
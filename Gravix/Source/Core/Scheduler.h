@@ -9,82 +9,137 @@
 #include "Asset/AssetImporter.h"
 #ifdef GRAVIX_EDITOR_BUILD
 #include "Asset/Importers/TextureImporter.h"
+#include "Asset/Importers/TextureCache.h"
+#include "Asset/TextureStreamer.h"
 #include "Asset/Importers/SceneImporter.h"
+#include "Asset/Importers/MaterialImporter.h"
+#include "Asset/Importers/ShaderImporter.h"
 #endif
 
 #include "Project/Project.h"
 #include "Core/Application.h"
+#include "Core/Hash.h"
+#include "Core/MappedFileCache.h"
+#include "Core/MPSCQueue.h"
 
 #include <TaskScheduler.h>
 #ifdef GRAVIX_EDITOR_BUILD
 #include <yaml-cpp/yaml.h>
 #endif
 #include <filesystem>
+#include <functional>
 #include <vector>
 #include <unordered_set>
 
 namespace Gravix
 {
 
+	// A batch of load requests, pooled and reused by AssetLoadBatcher
 	struct AsyncLoadTask : public enki::ITaskSet
 	{
 		std::vector<Ref<AsyncLoadRequest>> LoadRequests;
+		MPSCQueue<Ref<AsyncLoadRequest>>* CompletionQueue = nullptr;
 
-		AsyncLoadTask(size_t count)
+		AsyncLoadTask(MPSCQueue<Ref<AsyncLoadRequest>>* completionQueue)
+			: CompletionQueue(completionQueue)
 		{
-			m_SetSize = static_cast<uint32_t>(count);
 		}
 
 		void ExecuteRange(enki::TaskSetPartition range_, uint32_t threadnum_) override
 		{
 			for (uint32_t i = range_.start; i < range_.end; ++i)
 			{
-				Ref<AsyncLoadRequest> request = LoadRequests[i];
-				LoadAsset(request);
-				AssetManager::PushToCompletionQueue(request);
-				request->State = AssetState::ReadyForGPU;
+				Ref<AsyncLoadRequest>& request = LoadRequests[i];
+
+				// Checked before the file read and again after decode, the two expensive stages
+				if (!request->IsCancelled())
+					LoadAsset(request);
+
+				if (request->IsCancelled())
+				{
+					request->ReleaseCPUData();
+					request->State = AssetState::Cancelled;
+				}
+				else
+				{
+					request->State = AssetState::ReadyForGPU;
+				}
+
+				// State has to be final before the request becomes visible to the consumer
+				CompletionQueue->Push(request);
 			}
 		}
 
-		void LoadAsset(Ref<AsyncLoadRequest> request)
+		void LoadAsset(const Ref<AsyncLoadRequest>& request)
 		{
 #ifdef GRAVIX_EDITOR_BUILD
 			if (!Application::Get().IsRuntime())
 			{
-				if (Project::GetActive()->GetEditorAssetManager()->IsAssetHandleValid(request->Handle))
-				{
-					AssetMetadata metadata = Project::GetActive()->GetEditorAssetManager()->GetAssetMetadata(request->Handle);
-					SetCPUDataEditor(request, metadata);
-				}
+				SetCPUDataEditor(request);
 			}
 #endif
 		}
 
 #ifdef GRAVIX_EDITOR_BUILD
-		void SetCPUDataEditor(Ref<AsyncLoadRequest> request, AssetMetadata metadata)
+		void SetCPUDataEditor(const Ref<AsyncLoadRequest>& request)
 		{
-			if (metadata.Type == AssetType::Texture2D)
+			// Hashed before anything reads it, so an edit landing mid-load can never be recorded as
+			// already loaded. The texture cook hashes the exact bytes it decodes itself.
+			if (request->Type != AssetType::Texture2D)
+			{
+				// Every later stage, including the import on the main thread, reads this one mapping
+				request->SourceFile = MappedFileCache::Open(Project::GetAssetDirectory() / request->FilePath);
+				if (request->SourceFile)
+					request->ContentHash = Hash::ComputeContent64(request->SourceFile->GetData(), request->SourceFile->GetSize());
+			}
+
+			if (request->Type == AssetType::Texture2D)
 			{
-				int width, height, channels;
-				Buffer data = TextureImporter::LoadTexture2DToBuffer(Project::GetAssetDirectory() / request->FilePath, &width, &height, &channels);
+				// Decode, mips and block compression are the expensive part of a texture load, so they
+				// happen here too; after the first cook this is a read from the texture cache. Only the
+				// smallest levels come back, so the texture shows up at once and streams the rest.
+				uint64_t cacheKey;
+				CookedTexture2D cooked = TextureCache::LoadForStreaming(Project::GetAssetDirectory() / request->FilePath, request->TextureSettings,
+					TextureStreamer::InitialMaxDimension, cacheKey, request->ContentHash);
 				AsyncLoadRequest::TextureData textureData = {
-					data,
-					(uint32_t)width,
-					(uint32_t)height,
-					(uint32_t)channels
+					cooked.Data,
+					cooked.Width,
+					cooked.Height,
+					4,
+					cooked.Format,
+					cooked.MipLevels,
+					cooked.FirstMip,
+					cacheKey
 				};
 
 				request->CPUData = textureData;
 			}
-			else if (metadata.Type == AssetType::Scene)
+			else if (request->Type == AssetType::Scene)
 			{
-				std::vector<AssetHandle> dependencies;
-				YAML::Node sceneNode = SceneImporter::LoadSceneToYAML(Project::GetAssetDirectory() / request->FilePath, &dependencies);
-				AsyncLoadRequest::SceneData sceneData = {
-					sceneNode,
-					dependencies
-				};
-				request->CPUData = sceneData;
+				// The whole parse happens here, leaving only the entity creation to the main thread
+				Ref<ParsedScene> parsedScene = SceneImporter::ParseScene(Project::GetAssetDirectory() / request->FilePath);
+				if (parsedScene)
+				{
+					request->Dependencies = parsedScene->Dependencies;
+					AsyncLoadRequest::SceneData sceneData = {
+						parsedScene
+					};
+					request->CPUData = sceneData;
+				}
+
+				// Instantiating works from the parsed records, so the file is not needed again
+				request->SourceFile = nullptr;
+			}
+			else if (request->Type == AssetType::Material)
+			{
+				// Only the references; the material itself is created once they have loaded
+				if (request->SourceFile)
+					request->Dependencies = MaterialImporter::ReadDependencies(*request->SourceFile);
+			}
+			else if (request->Type == AssetType::Shader)
+			{
+				if (request->SourceFile)
+					request->DependencyFiles = ShaderImporter::ReadImportedFiles(*request->SourceFile);
 			}
 		}
 #endif
@@ -108,16 +163,23 @@ namespace Gravix
 	class Scheduler
 	{
 	public:
-		Scheduler() = default;
-		~Scheduler() = default;
+		Scheduler();
+		~Scheduler();
 
 		// Initialize with specified number of threads (default to number of hardware threads)
 		void Init(uint32_t threadCount = std::thread::hardware_concurrency());
 
 		//void CreateRunPinnedTaskLoop(const RunPinnedTaskLoop& runTask) { m_TaskScheduler.AddPinnedTask(runTask); }
 
+		// Runs the function once on a worker. Main thread only; the task sets are pooled.
+		void Dispatch(std::function<void()> function, enki::TaskPriority priority = enki::TASK_PRIORITY_MED);
+
 		enki::TaskScheduler& GetTaskScheduler() { return m_TaskScheduler; }
 	private:
+		struct FunctionTask;
+	private:
+		// Declared first so the scheduler shuts down, finishing them, before they are destroyed
+		std::vector<Scope<FunctionTask>> m_FunctionTasks;
 		enki::TaskScheduler m_TaskScheduler;
 	};
 }
\ No newline at end of file
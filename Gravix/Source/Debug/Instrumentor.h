@@ -13,11 +13,19 @@
 namespace Gravix
 {
 
+	// Chrome-trace process the event is grouped under
+	enum class ProfileTrack : uint32_t
+	{
+		CPU = 0,
+		GPU = 1,
+	};
+
 	struct ProfileResult
 	{
 		std::string Name;
 		long long Start, End;
 		uint32_t ThreadID;
+		ProfileTrack Track = ProfileTrack::CPU;
 
 		float GetDuration() const { return (End - Start) / 1000.0f; } // Convert to milliseconds
 	};
@@ -77,11 +85,11 @@ namespace Gravix
 			std::replace(name.begin(), name.end(), '"', '\'');
 
 			m_OutputStream << "{";
-			m_OutputStream << "\"cat\":\"function\",";
+			m_OutputStream << "\"cat\":\"" << (result.Track == ProfileTrack::GPU ? "gpu" : "function") << "\",";
 			m_OutputStream << "\"dur\":" << (result.End - result.Start) << ',';
 			m_OutputStream << "\"name\":\"" << name << "\",";
 			m_OutputStream << "\"ph\":\"X\",";
-			m_OutputStream << "\"pid\":0,";
+			m_OutputStream << "\"pid\":" << static_cast<uint32_t>(result.Track) << ',';
 			m_OutputStream << "\"tid\":" << result.ThreadID << ",";
 			m_OutputStream << "\"ts\":" << result.Start;
 			m_OutputStream << "}";
@@ -101,6 +109,12 @@ namespace Gravix
 		void WriteHeader()
 		{
 			m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
+
+			// Name the CPU and GPU processes so they show up as separate tracks
+			m_OutputStream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"CPU\"}},";
+			m_OutputStream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"GPU\"}}";
+			m_ProfileCount = 2;
+
 			m_OutputStream.flush();
 		}
 
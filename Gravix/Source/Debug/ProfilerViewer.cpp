@@ -37,9 +37,26 @@ namespace Gravix
 		float totalProfiledTime = 0.0f;
 		m_FunctionStats.clear();
 
+		m_GPUStats.clear();
+
 		for (const auto& result : results)
 		{
 			float duration = result.GetDuration();
+
+			// GPU results arrive a few frames late, once the frame's fence has signaled
+			if (result.Track == ProfileTrack::GPU)
+			{
+				if (result.Name == "GPU Frame")
+					m_GPUFrameTime = duration;
+
+				auto& gpuStats = m_GPUStats[result.Name];
+				gpuStats.TotalTime += duration;
+				gpuStats.MinTime = std::min(gpuStats.MinTime, duration);
+				gpuStats.MaxTime = std::max(gpuStats.MaxTime, duration);
+				gpuStats.CallCount++;
+				continue;
+			}
+
 			totalProfiledTime += duration;
 
 			// Update function statistics
@@ -61,6 +78,8 @@ namespace Gravix
 		if (m_TimeSinceLastUpdate >= m_UpdateInterval)
 		{
 			m_DisplayStats = m_FunctionStats;
+			m_DisplayGPUStats = m_GPUStats;
+			m_DisplayGPUFrameTime = m_GPUFrameTime;
 			m_DisplayFrameTime = m_FrameTime;
 			m_DisplayFPS = m_FPS;
 			m_TimeSinceLastUpdate = 0.0f;
@@ -93,6 +112,8 @@ namespace Gravix
 		ImGui::Text("Frame Time: %.3f ms", m_DisplayFrameTime);
 		ImGui::SameLine();
 		ImGui::Text("FPS: %.1f", m_DisplayFPS);
+		ImGui::SameLine();
+		ImGui::Text("GPU Frame: %.3f ms", m_DisplayGPUFrameTime);
 
 		// Calculate average frame time
 		float avgFrameTime = std::accumulate(std::begin(m_FrameTimeHistory), std::end(m_FrameTimeHistory), 0.0f) / HISTORY_SIZE;
@@ -149,19 +170,39 @@ namespace Gravix
 		// Update interval control
 		ImGui::SliderFloat("Update Interval (s)", &m_UpdateInterval, 0.1f, 5.0f);
 
+		if (ImGui::BeginTabBar("TimingTracks"))
+		{
+			if (ImGui::BeginTabItem("CPU"))
+			{
+				RenderStatsTable("Functions", m_DisplayStats);
+				ImGui::EndTabItem();
+			}
+
+			if (ImGui::BeginTabItem("GPU"))
+			{
+				RenderStatsTable("GPUScopes", m_DisplayGPUStats);
+				ImGui::EndTabItem();
+			}
+
+			ImGui::EndTabBar();
+		}
+	}
+
+	void ProfilerViewer::RenderStatsTable(const char* tableId, const std::unordered_map<std::string, FunctionStats>& stats)
+	{
 		// Create sorted vector of function stats
 		std::vector<std::pair<std::string, FunctionStats>> sortedStats;
-		sortedStats.reserve(m_DisplayStats.size());
+		sortedStats.reserve(stats.size());
 
 		// Apply filter
 		std::string filter(m_FilterBuffer);
 		std::transform(filter.begin(), filter.end(), filter.begin(), ::tolower);
 
-		for (const auto& [name, stats] : m_DisplayStats)
+		for (const auto& [name, entry] : stats)
 		{
 			if (filter.empty())
 			{
-				sortedStats.emplace_back(name, stats);
+				sortedStats.emplace_back(name, entry);
 			}
 			else
 			{
@@ -169,7 +210,7 @@ namespace Gravix
 				std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
 				if (lowerName.find(filter) != std::string::npos)
 				{
-					sortedStats.emplace_back(name, stats);
+					sortedStats.emplace_back(name, entry);
 				}
 			}
 		}
@@ -196,7 +237,7 @@ namespace Gravix
 		}
 
 		// Display table
-		if (ImGui::BeginTable("Functions", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY))
+		if (ImGui::BeginTable(tableId, 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY))
 		{
 			ImGui::TableSetupScrollFreeze(0, 1);
 			ImGui::TableSetupColumn("Function", ImGuiTableColumnFlags_WidthStretch);
@@ -207,26 +248,26 @@ namespace Gravix
 			ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 60.0f);
 			ImGui::TableHeadersRow();
 
-			for (const auto& [name, stats] : sortedStats)
+			for (const auto& [name, entry] : sortedStats)
 			{
 				ImGui::TableNextRow();
 				ImGui::TableNextColumn();
 				ImGui::TextUnformatted(name.c_str());
 
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", stats.TotalTime);
+				ImGui::Text("%.3f", entry.TotalTime);
 
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", stats.GetAverage());
+				ImGui::Text("%.3f", entry.GetAverage());
 
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", stats.MinTime);
+				ImGui::Text("%.3f", entry.MinTime);
 
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", stats.MaxTime);
+				ImGui::Text("%.3f", entry.MaxTime);
 
 				ImGui::TableNextColumn();
-				ImGui::Text("%u", stats.CallCount);
+				ImGui::Text("%u", entry.CallCount);
 			}
 
 			ImGui::EndTable();
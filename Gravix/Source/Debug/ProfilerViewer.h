@@ -51,6 +51,8 @@ namespace Gravix
 			float GetAverage() const { return CallCount > 0 ? TotalTime / CallCount : 0.0f; }
 		};
 
+		void RenderStatsTable(const char* tableId, const std::unordered_map<std::string, FunctionStats>& stats);
+
 	private:
 		bool m_Visible = false;
 		float m_FrameTime = 0.0f;
@@ -65,13 +67,17 @@ namespace Gravix
 		float m_FrameTimeHistory[HISTORY_SIZE] = {};
 		int m_HistoryOffset = 0;
 
-		// Function statistics
+		// Function statistics (CPU scopes and GPU timestamp scopes are kept apart)
 		std::unordered_map<std::string, FunctionStats> m_FunctionStats;
+		std::unordered_map<std::string, FunctionStats> m_GPUStats;
+		float m_GPUFrameTime = 0.0f;
 
 		// Update rate control (update display every N seconds)
 		float m_UpdateInterval = 1.0f; // Update every second
 		float m_TimeSinceLastUpdate = 0.0f;
 		std::unordered_map<std::string, FunctionStats> m_DisplayStats; // Stats shown on screen
+		std::unordered_map<std::string, FunctionStats> m_DisplayGPUStats;
+		float m_DisplayGPUFrameTime = 0.0f;
 
 		// Sorting and filtering
 		int m_SortMode = 0; // 0=Total, 1=Average, 2=Max, 3=Calls
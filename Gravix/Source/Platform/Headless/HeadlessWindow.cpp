@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "HeadlessWindow.h"
+
+#include "Events/WindowEvents.h"
+#include "Renderer/Null/NullDevice.h"
+
+namespace Gravix
+{
+
+	HeadlessWindow::HeadlessWindow(const WindowSpecification& spec)
+		: m_Title(spec.Title), m_Width(spec.Width), m_Height(spec.Height)
+	{
+		m_Device = CreateScope<NullDevice>(DeviceProperties{ m_Width, m_Height, nullptr, false });
+
+		GX_CORE_INFO("Headless window created with title: '{}'", m_Title);
+	}
+
+	void HeadlessWindow::Resize(uint32_t width, uint32_t height)
+	{
+		m_Width = width;
+		m_Height = height;
+		static_cast<NullDevice*>(m_Device.get())->Resize(width, height);
+
+		if (m_EventCallback)
+		{
+			WindowResizeEvent event(width, height);
+			m_EventCallback(event);
+		}
+	}
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/Window.h"
+
+namespace Gravix
+{
+
+	// Window without an OS surface. Owns a NullDevice and never produces events,
+	// so the application loop runs until Application::Shutdown is called.
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowSpecification& spec);
+		virtual ~HeadlessWindow() = default;
+
+		virtual void OnUpdate() override {}
+
+		virtual uint32_t GetWidth() override { return m_Width; }
+		virtual uint32_t GetHeight() override { return m_Height; }
+
+		virtual void SetCursorMode(CursorMode mode) override {}
+
+		virtual void SetEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+
+		virtual void SetTitle(const std::string& title) override { m_Title = title; }
+
+		virtual void Show() override {}
+		virtual void Hide() override {}
+
+		virtual void* GetWindowHandle() override { return nullptr; }
+
+		virtual Device* GetDevice() override { return m_Device.get(); }
+
+		// Simulates an OS resize so layers see the same WindowResizeEvent they would on a real window
+		void Resize(uint32_t width, uint32_t height);
+	private:
+		std::string m_Title;
+		uint32_t m_Width, m_Height;
+
+		EventCallbackFn m_EventCallback;
+
+		Scope<Device> m_Device;
+	};
+
+}
@@ -0,0 +1,174 @@
+#include "pch.h"
+#include "Core/FileWatcher.h"
+
+#include <cerrno>
+#include <cstring>
+#include <unordered_map>
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace Gravix
+{
+
+	namespace
+	{
+		// Close-write rather than every write, so a file is looked at once it is complete.
+		// Attrib covers a touch, moves cover editors that save through a rename.
+		constexpr uint32_t WatchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO;
+
+		bool IsUnder(const std::filesystem::path& path, const std::filesystem::path& directory)
+		{
+			const std::string& pathStr = path.native();
+			const std::string& directoryStr = directory.native();
+			return pathStr.size() > directoryStr.size() && pathStr.starts_with(directoryStr) && pathStr[directoryStr.size()] == '/';
+		}
+
+		// inotify watches single directories, so every directory in the tree gets its own watch
+		class LinuxFileChangeNotifier : public FileChangeNotifier
+		{
+		public:
+			~LinuxFileChangeNotifier() override
+			{
+				// Closing releases every watch
+				if (m_Fd >= 0)
+					close(m_Fd);
+			}
+
+			bool Start(const std::filesystem::path& directory)
+			{
+				m_Fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (m_Fd < 0)
+				{
+					GX_CORE_WARN("FileWatcher: inotify unavailable ({0})", std::strerror(errno));
+					return false;
+				}
+
+				return AddWatchTree(directory);
+			}
+
+			bool ReadChanges(std::vector<Change>& outChanges) override
+			{
+				bool complete = true;
+
+				alignas(inotify_event) char buffer[16 * 1024];
+				while (true)
+				{
+					ssize_t length = read(m_Fd, buffer, sizeof(buffer));
+					if (length < 0)
+					{
+						if (errno == EINTR)
+							continue;
+						if (errno != EAGAIN)
+						{
+							GX_CORE_ERROR("FileWatcher: Failed to read inotify events ({0})", std::strerror(errno));
+							complete = false;
+						}
+						break;
+					}
+					if (length == 0)
+						break;
+
+					for (char* cursor = buffer; cursor < buffer + length; )
+					{
+						const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+						cursor += sizeof(inotify_event) + event->len;
+
+						if (event->mask & IN_Q_OVERFLOW)
+						{
+							complete = false;
+							continue;
+						}
+
+						// The directory went away or was unwatched
+						if (event->mask & IN_IGNORED)
+						{
+							m_WatchPaths.erase(event->wd);
+							continue;
+						}
+
+						// Events on a watched directory itself are also reported by its parent
+						auto watchIt = m_WatchPaths.find(event->wd);
+						if (watchIt == m_WatchPaths.end() || event->len == 0)
+							continue;
+
+						std::filesystem::path path = watchIt->second / event->name;
+						bool isDirectory = (event->mask & IN_ISDIR) != 0;
+						if (isDirectory)
+						{
+							// Moved watches keep reporting under their old path, so they are dropped
+							// here and, if the directory is still in the tree, added again at its new one
+							if (event->mask & IN_MOVED_FROM)
+								RemoveWatchTree(path);
+							else if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && !AddWatchTree(path))
+								complete = false;
+						}
+
+						outChanges.push_back({ std::move(path), isDirectory });
+					}
+				}
+
+				return complete;
+			}
+		private:
+			bool AddWatchTree(const std::filesystem::path& directory)
+			{
+				if (!AddWatch(directory))
+					return false;
+
+				std::error_code error;
+				std::filesystem::recursive_directory_iterator it(directory, std::filesystem::directory_options::skip_permission_denied, error);
+				for (; !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+				{
+					std::error_code statusError;
+					if (it->is_directory(statusError) && !it->is_symlink(statusError) && !AddWatch(it->path()))
+						return false;
+				}
+
+				return true;
+			}
+
+			bool AddWatch(const std::filesystem::path& directory)
+			{
+				int wd = inotify_add_watch(m_Fd, directory.c_str(), WatchMask | IN_ONLYDIR | IN_DONT_FOLLOW);
+				if (wd < 0)
+				{
+					// Removed between being listed and watched
+					if (errno == ENOENT || errno == ENOTDIR)
+						return true;
+
+					// ENOSPC is the per-user watch limit, fs.inotify.max_user_watches
+					GX_CORE_WARN("FileWatcher: Cannot watch {0} ({1})", directory.string(), std::strerror(errno));
+					return false;
+				}
+
+				// Watching an already watched directory returns its watch, which then takes the new path
+				m_WatchPaths[wd] = directory;
+				return true;
+			}
+
+			void RemoveWatchTree(const std::filesystem::path& directory)
+			{
+				for (const auto& [wd, path] : m_WatchPaths)
+				{
+					// IN_IGNORED follows for each, which is where they are erased
+					if (path == directory || IsUnder(path, directory))
+						inotify_rm_watch(m_Fd, wd);
+				}
+			}
+		private:
+			int m_Fd = -1;
+			std::unordered_map<int, std::filesystem::path> m_WatchPaths;
+		};
+	}
+
+	Scope<FileChangeNotifier> FileChangeNotifier::Create(const std::filesystem::path& directory)
+	{
+		Scope<LinuxFileChangeNotifier> notifier = CreateScope<LinuxFileChangeNotifier>();
+		if (!notifier->Start(directory))
+			return nullptr;
+
+		return notifier;
+	}
+
+}
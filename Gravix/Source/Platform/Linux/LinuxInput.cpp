@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "Core/Input.h"
+
+namespace Gravix
+{
+
+	// Windows on Linux are headless and never receive input, so nothing is ever held down
+
+	bool Input::IsMouseDown(Mouse button)
+	{
+		return false;
+	}
+
+	bool Input::IsKeyDown(Key key)
+	{
+		return false;
+	}
+
+	bool Input::IsKeyPressed(Key key)
+	{
+		return false;
+	}
+
+	float Input::GetMouseX()
+	{
+		return GetMousePosition().x;
+	}
+
+	float Input::GetMouseY()
+	{
+		return GetMousePosition().y;
+	}
+
+	float Input::GetScrollX()
+	{
+		return GetScrollWheel().x;
+	}
+
+	float Input::GetScrollY()
+	{
+		return GetScrollWheel().y;
+	}
+
+	glm::vec2 Input::GetScrollWheel()
+	{
+		return { 0.0f, 0.0f };
+	}
+
+	glm::vec2 Input::GetMousePosition()
+	{
+		return { 0.0f, 0.0f };
+	}
+
+}
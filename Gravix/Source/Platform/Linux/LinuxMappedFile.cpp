@@ -0,0 +1,61 @@
+#include "pch.h"
+#include "Core/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Gravix
+{
+
+	bool MappedFile::Open(const std::filesystem::path& path, FileAccessPattern pattern /*= FileAccessPattern::Random*/)
+	{
+		Close();
+
+		int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+		{
+			GX_CORE_ERROR("Failed to open file for mapping: {}", path.string());
+			return false;
+		}
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+		{
+			GX_CORE_ERROR("Cannot map empty file: {}", path.string());
+			close(fd);
+			return false;
+		}
+
+		void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		// The mapping keeps its own reference to the file
+		close(fd);
+
+		if (view == MAP_FAILED)
+		{
+			GX_CORE_ERROR("Failed to map file: {}", path.string());
+			return false;
+		}
+
+		// Lookups jump around an archive, so read-ahead would only waste I/O there
+		madvise(view, static_cast<size_t>(fileStat.st_size), pattern == FileAccessPattern::Random ? MADV_RANDOM : MADV_SEQUENTIAL);
+
+		m_Data = static_cast<const uint8_t*>(view);
+		m_Size = static_cast<uint64_t>(fileStat.st_size);
+		m_Path = path;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap(const_cast<uint8_t*>(m_Data), static_cast<size_t>(m_Size));
+
+		m_Data = nullptr;
+		m_Size = 0;
+		m_Path.clear();
+	}
+
+}
@@ -0,0 +1,16 @@
+#include "pch.h"
+#include "Core/Window.h"
+
+#include "Platform/Headless/HeadlessWindow.h"
+
+namespace Gravix
+{
+
+	// There is no windowing backend on Linux yet, so every window is headless
+	Scope<Window> Window::Create(const WindowSpecification& spec)
+	{
+		GX_CORE_WARN("No window backend on Linux, running headless");
+		return CreateScope<HeadlessWindow>(spec);
+	}
+
+}
@@ -0,0 +1,13 @@
+#include "pch.h"
+#include "Core/FileWatcher.h"
+
+namespace Gravix
+{
+
+	// No notification backend on Windows yet; the watcher polls
+	Scope<FileChangeNotifier> FileChangeNotifier::Create(const std::filesystem::path& directory)
+	{
+		return nullptr;
+	}
+
+}
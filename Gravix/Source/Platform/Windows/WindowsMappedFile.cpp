@@ -0,0 +1,69 @@
+#include "pch.h"
+#include "Core/MappedFile.h"
+
+#include <windows.h>
+
+namespace Gravix
+{
+
+	bool MappedFile::Open(const std::filesystem::path& path, FileAccessPattern pattern /*= FileAccessPattern::Random*/)
+	{
+		Close();
+
+		DWORD accessFlag = pattern == FileAccessPattern::Random ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN;
+		// Other programs may still write, replace or delete the file while it is mapped
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | accessFlag, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			GX_CORE_ERROR("Failed to open file for mapping: {}", path.string());
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			GX_CORE_ERROR("Cannot map empty file: {}", path.string());
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// The mapping keeps its own reference to the file
+		CloseHandle(file);
+		if (mapping == nullptr)
+		{
+			GX_CORE_ERROR("Failed to create file mapping: {}", path.string());
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr)
+		{
+			GX_CORE_ERROR("Failed to map view of file: {}", path.string());
+			CloseHandle(mapping);
+			return false;
+		}
+
+		m_MappingHandle = mapping;
+		m_Data = static_cast<const uint8_t*>(view);
+		m_Size = static_cast<uint64_t>(fileSize.QuadPart);
+		m_Path = path;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_MappingHandle)
+			CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+
+		m_Data = nullptr;
+		m_Size = 0;
+		m_MappingHandle = nullptr;
+		m_Path.clear();
+	}
+
+}
@@ -25,8 +25,13 @@ namespace Gravix
 		s_ActiveProject->m_Config.StartScene = 0; // Null handle
 
 		// Initialize asset manager
+#ifdef GRAVIX_EDITOR_BUILD
 		Ref<EditorAssetManager> editorAssetManager = CreateRef<EditorAssetManager>();
 		s_ActiveProject->m_AssetManager = editorAssetManager;
+#else
+		// No pak is open, so every handle is invalid until one is loaded through LoadRuntime
+		s_ActiveProject->m_AssetManager = CreateRef<RuntimeAssetManager>();
+#endif
 
 		return s_ActiveProject;
 	}
@@ -86,6 +91,32 @@ namespace Gravix
 		return s_ActiveProject;
 	}
 
+	Ref<Project> Project::LoadRuntime(const std::filesystem::path& pakPath)
+	{
+		Ref<RuntimeAssetManager> runtimeAssetManager = CreateRef<RuntimeAssetManager>();
+		if (!runtimeAssetManager->OpenPak(pakPath))
+			return nullptr;
+
+		s_ActiveProject = CreateRef<Project>();
+		s_ActiveProject->m_WorkingDirectory = pakPath.parent_path();
+		s_ActiveProject->m_Config.StartScene = 0; // Null handle
+		s_ActiveProject->m_AssetManager = runtimeAssetManager;
+
+		return s_ActiveProject;
+	}
+
+	void Project::ApplyMemorySettings()
+	{
+		if (!m_AssetManager)
+			return;
+
+		AssetResidencyBudget budget;
+		budget.CPUBytes = static_cast<uint64_t>(m_Config.Memory.CPUBudgetMB) * 1024 * 1024;
+		budget.GPUBytes = static_cast<uint64_t>(m_Config.Memory.GPUBudgetMB) * 1024 * 1024;
+		budget.MinUnusedFrames = m_Config.Memory.MinUnusedFrames;
+		m_AssetManager->GetResidency().SetBudget(budget);
+	}
+
 #ifdef GRAVIX_EDITOR_BUILD
 	Ref<Project> Project::Load(const std::filesystem::path& path)
 	{
@@ -110,6 +141,7 @@ namespace Gravix
 			Ref<EditorAssetManager> editorAssetManager = CreateRef<EditorAssetManager>();
 			s_ActiveProject->m_AssetManager = editorAssetManager;
 			editorAssetManager->DeserializeAssetRegistry();
+			s_ActiveProject->ApplyMemorySettings();
 			s_ActiveProject->m_WorkingDirectory = path.parent_path();
 
 			// Setup scripting environment (create Sandbox.csproj and copy GravixScripting.dll)
@@ -23,6 +23,13 @@ namespace Gravix
 		float RestitutionThreshold = 2.4f;  // Box2D default: 1.0 m/s (we use 2.4 for pixels)
 	};
 
+	struct MemorySettings
+	{
+		uint32_t CPUBudgetMB = 0;  // 0 = unlimited
+		uint32_t GPUBudgetMB = 0;
+		uint32_t MinUnusedFrames = 120;
+	};
+
 	struct ProjectConfig
 	{
 		std::string Name = "Untitled";
@@ -35,6 +42,7 @@ namespace Gravix
 		std::filesystem::path ScriptEditorPath;
 
 		PhysicsSettings Physics;
+		MemorySettings Memory;
 	};
 
 	class Project : public RefCounted
@@ -68,6 +76,9 @@ namespace Gravix
 
 		ProjectConfig& GetConfig() { return m_Config; }
 
+		// Pushes the Memory settings to the asset manager's residency budget
+		void ApplyMemorySettings();
+
 		static Ref<Project> GetActive() 
 		{
 			GX_ASSERT(s_ActiveProject, "No active project!");
@@ -85,6 +96,8 @@ namespace Gravix
 
 		static Ref<Project> New();
 		static Ref<Project> New(const std::filesystem::path& workingDirectory);
+		// Shipped builds: assets come from a cooked pack instead of the Assets directory
+		static Ref<Project> LoadRuntime(const std::filesystem::path& pakPath);
 #ifdef GRAVIX_EDITOR_BUILD
 		static Ref<Project> Load(const std::filesystem::path& path);
 		static void SaveActive(const std::filesystem::path& path);
@@ -39,6 +39,9 @@ namespace Gravix
 		virtual void EndRendering() = 0;
 
 		virtual void CopyToSwapchain() = 0;
+
+		virtual void BeginGPUScope(const char* name) = 0;
+		virtual void EndGPUScope() = 0;
 	};
 
 }
\ No newline at end of file
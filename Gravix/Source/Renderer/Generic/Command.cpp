@@ -2,7 +2,10 @@
 #include "Command.h"
 
 #include "Core/Application.h"
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/VulkanCommandImpl.h"
+#endif
+#include "Renderer/Null/NullCommandImpl.h"
 #include "Debug/Instrumentor.h"
 
 namespace Gravix
@@ -104,6 +107,18 @@ namespace Gravix
 			m_Impl->ResolveFramebuffer(dst, shaderUse);
 	}
 
+	void Command::BeginGPUScope(const char* name)
+	{
+		if(m_Impl)
+			m_Impl->BeginGPUScope(name);
+	}
+
+	void Command::EndGPUScope()
+	{
+		if(m_Impl)
+			m_Impl->EndGPUScope();
+	}
+
 	void Command::Initialize(Ref<Framebuffer> framebuffer, uint32_t presentIndex, bool shouldCopy)
 	{
 		Device* device = Application::Get().GetWindow().GetDevice();
@@ -111,7 +126,10 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:  m_Impl = new VulkanCommandImpl(device, framebuffer, presentIndex, shouldCopy); return;
+#endif
+		case DeviceType::Null:    m_Impl = new NullCommandImpl(device, framebuffer, presentIndex, shouldCopy); return;
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return;
@@ -226,6 +226,21 @@ namespace Gravix
 		 */
 		void ResolveFramebuffer(Ref<Framebuffer> dst, bool shaderUse) { ResolveFramebuffer(dst.get(), shaderUse); }
 
+		/**
+		 * @brief Open a GPU timing scope
+		 * @param name Scope name shown on the profiler's GPU track (must be a string literal)
+		 *
+		 * Writes a timestamp before the commands that follow. Results are read
+		 * back a few frames later, once the GPU has finished the frame.
+		 * Prefer GX_PROFILE_GPU_SCOPE over calling this directly.
+		 */
+		void BeginGPUScope(const char* name);
+
+		/**
+		 * @brief Close the most recently opened GPU timing scope
+		 */
+		void EndGPUScope();
+
 	private:
 		CommandImpl* m_Impl = nullptr; ///< Platform-specific implementation (Vulkan)
 
@@ -235,4 +250,30 @@ namespace Gravix
 		 */
 		void Initialize(Ref<Framebuffer> framebuffer, uint32_t presentIndex, bool shouldCopy);
 	};
-}
\ No newline at end of file
+
+	/**
+	 * @brief RAII helper that times the commands recorded during its lifetime on the GPU
+	 */
+	class GPUProfileScope
+	{
+	public:
+		GPUProfileScope(Command& cmd, const char* name)
+			: m_Command(cmd)
+		{
+			m_Command.BeginGPUScope(name);
+		}
+
+		~GPUProfileScope()
+		{
+			m_Command.EndGPUScope();
+		}
+	private:
+		Command& m_Command;
+	};
+}
+
+#ifdef GX_PROFILE
+	#define GX_PROFILE_GPU_SCOPE(cmd, name) ::Gravix::GPUProfileScope gpuTimer##__LINE__(cmd, name);
+#else
+	#define GX_PROFILE_GPU_SCOPE(cmd, name)
+#endif
\ No newline at end of file
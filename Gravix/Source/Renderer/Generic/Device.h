@@ -3,6 +3,8 @@
 #include "Types/Framebuffer.h"
 #include "Types/Texture.h"
 
+#include <deque>
+#include <unordered_set>
 #include <vector>
 
 namespace Gravix 
@@ -23,6 +25,7 @@ namespace Gravix
 		None = 0,
 		Vulkan = 1,
 		DirectX12 = 2,
+		Null = 3,      // Headless: records statistics and keeps CPU copies, no GPU work
 	};
 
 	constexpr uint32_t FRAME_OVERLAP = 2;
@@ -43,11 +46,49 @@ namespace Gravix
 		void RegisterFramebuffer(Ref<Framebuffer> framebuffer) { m_Framebuffers.push_back(framebuffer); }
 		std::vector<Ref<Framebuffer>>& GetFramebuffers() { return m_Framebuffers; }
 
-		void RegisterTexture(Ref<Texture2D> texture) { m_Textures.push_back(texture); }
-		std::vector<Ref<Texture2D>>& GetTextures() { return m_Textures; }
+		// Non-owning: textures unregister themselves on destruction so assets can actually be freed
+		void RegisterTexture(Texture2D* texture) { m_Textures.insert(texture); }
+		void UnregisterTexture(Texture2D* texture) { m_Textures.erase(texture); }
+		std::unordered_set<Texture2D*>& GetTextures() { return m_Textures; }
+
+		// Keeps the reference alive until every frame that may have recorded the resource has
+		// finished on the GPU, so dropping the last reference never destroys something in flight.
+		// Main thread only.
+		void DeferRelease(Ref<RefCounted> resource)
+		{
+			if (resource)
+				m_DeferredReleases.push_back({ std::move(resource), m_ReleaseFrame });
+		}
+
+		size_t GetPendingReleaseCount() const { return m_DeferredReleases.size(); }
+	protected:
+		// Backends call this once the GPU has finished every frame up to and including completedFrame.
+		// Expired entries are moved out first, so destructors that defer more releases are fine.
+		void ReleaseCompletedResources(uint64_t completedFrame)
+		{
+			std::vector<DeferredRelease> expired;
+			while (!m_DeferredReleases.empty() && m_DeferredReleases.front().Frame <= completedFrame)
+			{
+				expired.push_back(std::move(m_DeferredReleases.front()));
+				m_DeferredReleases.pop_front();
+			}
+		}
+
+		void ReleaseAllResources() { ReleaseCompletedResources(UINT64_MAX); }
+
+		// Stamped on new releases: the frame being recorded, or the next one between frames.
+		// Backends advance it as frames are submitted.
+		uint64_t m_ReleaseFrame = 0;
 	private:
+		struct DeferredRelease
+		{
+			Ref<RefCounted> Resource;
+			uint64_t Frame;
+		};
+
 		std::vector<Ref<Framebuffer>> m_Framebuffers;
-		std::vector<Ref<Texture2D>> m_Textures;
+		std::unordered_set<Texture2D*> m_Textures;
+		std::deque<DeferredRelease> m_DeferredReleases;
 	};
 
 }
\ No newline at end of file
@@ -5,9 +5,12 @@
 #include "Renderer/Generic/Types/Shader.h"
 #include "Renderer/Generic/Types/Pipeline.h"
 #include "Renderer/Generic/Types/Texture.h"
+#include "Renderer/Generic/Types/Framebuffer.h"
 #include "Renderer/Generic/Types/Mesh.h"
 
+#ifdef GRAVIX_EDITOR_BUILD
 #include "Asset/Importers/ShaderImporter.h"
+#endif
 
 #include "Debug/Instrumentor.h"
 
@@ -76,13 +79,53 @@ namespace Gravix
 
 		uint32_t CircleIndexCount = 0;
 		uint32_t LineVertexCount = 0;
+
+		// For texture streaming feedback
+		Ref<Framebuffer> RenderTarget;
+		glm::mat4 ViewProjection{ 1.0f };
+		glm::vec2 ViewportSize{ 0.0f };
 	};
 
 	static Ref<Renderer2DData> s_Data;
 
+	// Level whose texels come closest to one per pixel for a quad drawn with this transform
+	static uint32_t GetVisibleMip(const glm::mat4& transformMatrix, const Texture2D& texture, float tilingFactor)
+	{
+		glm::mat4 transform = s_Data->ViewProjection * transformMatrix;
+		glm::vec4 origin = transform * s_Data->QuadVertexOffsets[0];
+		glm::vec4 right = transform * s_Data->QuadVertexOffsets[1];
+		glm::vec4 up = transform * s_Data->QuadVertexOffsets[3];
+
+		// Crossing the camera plane means it covers the screen
+		if (origin.w <= 0.0f || right.w <= 0.0f || up.w <= 0.0f)
+			return 0;
+
+		glm::vec2 halfViewport = s_Data->ViewportSize * 0.5f;
+		glm::vec2 originPixels = glm::vec2(origin) / origin.w * halfViewport;
+		float widthPixels = glm::length(glm::vec2(right) / right.w * halfViewport - originPixels);
+		float heightPixels = glm::length(glm::vec2(up) / up.w * halfViewport - originPixels);
+
+		float texelsPerPixel = std::max(texture.GetWidth() * tilingFactor / std::max(widthPixels, 1.0f),
+			texture.GetHeight() * tilingFactor / std::max(heightPixels, 1.0f));
+		return texelsPerPixel <= 1.0f ? 0 : static_cast<uint32_t>(std::log2(texelsPerPixel));
+	}
+
+#ifdef GRAVIX_EDITOR_BUILD
 	void Renderer2D::Init(Ref<Framebuffer> renderTarget)
+	{
+		Renderer2DShaders shaders;
+		shaders.Quad = ShaderImporter::LoadFromFile("Assets/shaders/quad.slang");
+		shaders.Circle = ShaderImporter::LoadFromFile("Assets/shaders/circle.slang");
+		shaders.Line = ShaderImporter::LoadFromFile("Assets/shaders/line.slang");
+
+		Init(renderTarget, shaders);
+	}
+#endif
+
+	void Renderer2D::Init(Ref<Framebuffer> renderTarget, const Renderer2DShaders& shaders)
 	{
 		s_Data = CreateRef<Renderer2DData>();
+		s_Data->RenderTarget = renderTarget;
 		// Create a 1x1 white texture
 		uint32_t whitePixel = 0xffffffff; // RGBA
 		Buffer buffer;
@@ -93,8 +136,6 @@ namespace Gravix
 
 		// Create quad material with new system
 		{
-			Ref<Shader> quadShader = ShaderImporter::LoadFromFile("Assets/shaders/quad.slang");
-
 			PipelineConfiguration quadPipelineConfig{};
 			quadPipelineConfig.BlendingMode = Blending::Alpha;
 			quadPipelineConfig.EnableDepthTest = true;
@@ -103,7 +144,7 @@ namespace Gravix
 
 			Ref<Pipeline> quadPipeline = CreateRef<Pipeline>(quadPipelineConfig);
 
-			s_Data->QuadMaterial = Material::Create(quadShader, quadPipeline);
+			s_Data->QuadMaterial = Material::Create(shaders.Quad, quadPipeline);
 			s_Data->QuadMaterial->SetFramebuffer(renderTarget);
 			s_Data->QuadPushConstants = s_Data->QuadMaterial->GetPushConstantStruct();
 			s_Data->CachedQuadVertex = s_Data->QuadMaterial->GetVertexStruct();
@@ -112,8 +153,6 @@ namespace Gravix
 
 		// Create circle material with new system
 		{
-			Ref<Shader> circleShader = ShaderImporter::LoadFromFile("Assets/shaders/circle.slang");
-
 			PipelineConfiguration circlePipelineConfig{};
 			circlePipelineConfig.BlendingMode = Blending::Alpha;
 			circlePipelineConfig.EnableDepthTest = true;
@@ -122,7 +161,7 @@ namespace Gravix
 
 			Ref<Pipeline> circlePipeline = CreateRef<Pipeline>(circlePipelineConfig);
 
-			s_Data->CircleMaterial = Material::Create(circleShader, circlePipeline);
+			s_Data->CircleMaterial = Material::Create(shaders.Circle, circlePipeline);
 			s_Data->CircleMaterial->SetFramebuffer(renderTarget);
 			s_Data->CirclePushConstants = s_Data->CircleMaterial->GetPushConstantStruct();
 			s_Data->CachedCircleVertex = s_Data->CircleMaterial->GetVertexStruct();
@@ -131,8 +170,6 @@ namespace Gravix
 
 		// Create line material with new system
 		{
-			Ref<Shader> lineShader = ShaderImporter::LoadFromFile("Assets/shaders/line.slang");
-
 			PipelineConfiguration linePipelineConfig{};
 			linePipelineConfig.BlendingMode = Blending::Alpha;
 			linePipelineConfig.EnableDepthTest = true;
@@ -142,7 +179,7 @@ namespace Gravix
 
 			Ref<Pipeline> linePipeline = CreateRef<Pipeline>(linePipelineConfig);
 
-			s_Data->LineMaterial = Material::Create(lineShader, linePipeline);
+			s_Data->LineMaterial = Material::Create(shaders.Line, linePipeline);
 			s_Data->LineMaterial->SetFramebuffer(renderTarget);
 			s_Data->LineMesh = Mesh::Create(s_Data->LineMaterial->GetVertexSize(), s_Data->MaxLineVertices, 0);
 			s_Data->LinePushConstants = s_Data->LineMaterial->GetPushConstantStruct();
@@ -198,6 +235,10 @@ namespace Gravix
 	{
 		GX_PROFILE_FUNCTION();
 
+		// Last scene's references would otherwise keep its textures from ever being evicted
+		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; i++)
+			s_Data->TextureSlots[i] = nullptr;
+
 		s_Data->TextureSlotIndex = 1;
 		s_Data->QuadIndexCount = 0;
 		s_Data->QuadVertexBuffer.clear();
@@ -209,6 +250,8 @@ namespace Gravix
 		s_Data->LineVertexBuffer.clear();
 
 		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+		s_Data->ViewProjection = camera.GetProjection() * glm::inverse(transformMatrix);
+		s_Data->ViewportSize = glm::vec2(s_Data->RenderTarget->GetWidth(), s_Data->RenderTarget->GetHeight());
 		s_Data->QuadPushConstants.Set("viewProjMatrix", camera.GetProjection() * glm::inverse(transformMatrix));
 		s_Data->CirclePushConstants.Set("viewProjMatrix", camera.GetProjection() * glm::inverse(transformMatrix));
 		s_Data->LinePushConstants.Set("viewProjMatrix", camera.GetProjection() * glm::inverse(transformMatrix));
@@ -218,6 +261,10 @@ namespace Gravix
 	{
 		GX_PROFILE_FUNCTION();
 
+		// Last scene's references would otherwise keep its textures from ever being evicted
+		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; i++)
+			s_Data->TextureSlots[i] = nullptr;
+
 		s_Data->TextureSlotIndex = 1;
 		s_Data->QuadIndexCount = 0;
 		s_Data->QuadVertexBuffer.clear();
@@ -229,20 +276,27 @@ namespace Gravix
 		s_Data->LineVertexBuffer.clear();
 
 		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+		s_Data->ViewProjection = camera.GetViewProjection();
+		s_Data->ViewportSize = glm::vec2(s_Data->RenderTarget->GetWidth(), s_Data->RenderTarget->GetHeight());
 		s_Data->QuadPushConstants.Set("viewProjMatrix", camera.GetViewProjection());
 		s_Data->CirclePushConstants.Set("viewProjMatrix", camera.GetViewProjection());
 		s_Data->LinePushConstants.Set("viewProjMatrix", camera.GetViewProjection());
 	}
 
 	void Renderer2D::DrawQuad(const glm::mat4& transformMatrix, uint32_t entityID, const glm::vec4& color /*= { 1.0f, 1.0f, 1.0f, 1.0f }*/, Ref<Texture2D> texture /*= nullptr*/, float tilingFactor /*= 1.0f*/)
+	{
+		DrawQuad(transformMatrix, entityID, color, texture.Raw(), tilingFactor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transformMatrix, uint32_t entityID, const glm::vec4& color, Texture2D* texture, float tilingFactor /*= 1.0f*/)
 	{
 		float textureIndex = 0.0f;
 		if (texture != nullptr)
 		{
-			// Check if texture is already in a slot
+			// Check if texture is already in a slot; only a newly bound texture takes a reference
 			for (uint32_t i = 1; i < s_Data->TextureSlotIndex; i++)
 			{
-				if (*s_Data->TextureSlots[i].get() == *texture.get())
+				if (s_Data->TextureSlots[i].get() == texture || *s_Data->TextureSlots[i].get() == *texture)
 				{
 					textureIndex = (float)i;
 					break;
@@ -261,6 +315,8 @@ namespace Gravix
 				}
 				// If no room, use white texture (fallback)
 			}
+
+			texture->RequestMip(GetVisibleMip(transformMatrix, *texture, tilingFactor));
 		}
 
 		for (int i = 0; i < 4; i++)
@@ -394,22 +450,31 @@ namespace Gravix
 
 	void Renderer2D::Flush(Command& cmd)
 	{
-		cmd.SetActiveMaterial(s_Data->QuadMaterial);
-		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
-			cmd.BindResource(0, i, s_Data->TextureSlots[i]);
-		cmd.BindMaterial(s_Data->QuadPushConstants.Data());
-		cmd.BindMesh(s_Data->QuadMesh);
-		cmd.DrawIndexed(s_Data->QuadIndexCount);
-
-		cmd.SetActiveMaterial(s_Data->CircleMaterial);
-		cmd.BindMaterial(s_Data->CirclePushConstants.Data());
-		cmd.BindMesh(s_Data->CircleMesh);
-		cmd.DrawIndexed(s_Data->CircleIndexCount);
-
-		cmd.SetActiveMaterial(s_Data->LineMaterial);
-		cmd.SetLineWidth(s_Data->LineWidth);
-		cmd.BindMaterial(s_Data->LinePushConstants.Data());
-		cmd.Draw(s_Data->LineVertexCount);
+		{
+			GX_PROFILE_GPU_SCOPE(cmd, "Renderer2D Quads");
+			cmd.SetActiveMaterial(s_Data->QuadMaterial);
+			for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
+				cmd.BindResource(0, i, s_Data->TextureSlots[i]);
+			cmd.BindMaterial(s_Data->QuadPushConstants.Data());
+			cmd.BindMesh(s_Data->QuadMesh);
+			cmd.DrawIndexed(s_Data->QuadIndexCount);
+		}
+
+		{
+			GX_PROFILE_GPU_SCOPE(cmd, "Renderer2D Circles");
+			cmd.SetActiveMaterial(s_Data->CircleMaterial);
+			cmd.BindMaterial(s_Data->CirclePushConstants.Data());
+			cmd.BindMesh(s_Data->CircleMesh);
+			cmd.DrawIndexed(s_Data->CircleIndexCount);
+		}
+
+		{
+			GX_PROFILE_GPU_SCOPE(cmd, "Renderer2D Lines");
+			cmd.SetActiveMaterial(s_Data->LineMaterial);
+			cmd.SetLineWidth(s_Data->LineWidth);
+			cmd.BindMaterial(s_Data->LinePushConstants.Data());
+			cmd.Draw(s_Data->LineVertexCount);
+		}
 	}
 
 	void Renderer2D::Destroy()
@@ -2,6 +2,7 @@
 
 #include "Renderer/Generic/Command.h"
 #include "Renderer/Generic/Types/Texture.h"
+#include "Renderer/Generic/Types/Shader.h"
 
 #include "Scene/EditorCamera.h"
 #include "Scene/SceneCamera.h"
@@ -11,15 +12,28 @@
 namespace Gravix
 {
 	
+	// Shaders for the three batches; their reflection must match Assets/shaders/quad, circle and line.slang
+	struct Renderer2DShaders
+	{
+		Ref<Shader> Quad;
+		Ref<Shader> Circle;
+		Ref<Shader> Line;
+	};
+
 	class Renderer2D
 	{
 	public:
+#ifdef GRAVIX_EDITOR_BUILD
+		// Compiles the shaders from Assets/shaders
 		static void Init(Ref<Framebuffer> renderTarget);
+#endif
+		static void Init(Ref<Framebuffer> renderTarget, const Renderer2DShaders& shaders);
 
 		static void BeginScene(Command& cmd, EditorCamera& camera);
 		static void BeginScene(Command& cmd, Camera& camera, const glm::mat4& transformationMatrix);
 
 		static void DrawQuad(const glm::mat4& transformMatrix, uint32_t entityID, const glm::vec4& color = { 1.0f, 1.0f, 1.0f, 1.0f }, Ref<Texture2D> texture = nullptr, float tilingFactor = 1.0f);
+		static void DrawQuad(const glm::mat4& transformMatrix, uint32_t entityID, const glm::vec4& color, Texture2D* texture, float tilingFactor = 1.0f);
 		static void DrawCircle(const glm::mat4& transformMatrix, uint32_t entityID, const glm::vec4& color = { 1.0f, 1.0f, 1.0f, 1.0f }, float thickness = 0.1f, float fade = 0.005f);
 
 		static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color = { 1.0f, 1.0f, 1.0f, 1.0f });
@@ -3,7 +3,10 @@
 
 #include "Core/Application.h"
 
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/Types/VulkanFramebuffer.h"
+#endif
+#include "Renderer/Null/Types/NullFramebuffer.h"
 
 namespace Gravix 
 {
@@ -15,10 +18,18 @@ namespace Gravix
 		switch (device->GetType())
 		{
 			case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 			case DeviceType::Vulkan: {
 				Ref<VulkanFramebuffer> framebuffer = CreateRef<VulkanFramebuffer>(device, spec);
 				device->RegisterFramebuffer(framebuffer);
 
+				return framebuffer;
+			}
+#endif
+			case DeviceType::Null: {
+				Ref<NullFramebuffer> framebuffer = CreateRef<NullFramebuffer>(device, spec);
+				device->RegisterFramebuffer(framebuffer);
+
 				return framebuffer;
 			}
 		}
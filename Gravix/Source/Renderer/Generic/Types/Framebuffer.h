@@ -50,6 +50,11 @@ namespace Gravix
 
 		virtual int ReadPixel(uint32_t attachmentIndex, int mouseX, int mouseY) = 0;
 
+		// Non-blocking variant of ReadPixel: queues a copy of the pixel into the current
+		// frame and returns the most recent value whose frame has finished on the GPU
+		// (-1 until the first result arrives). Results lag by FRAME_OVERLAP frames.
+		virtual int ReadPixelAsync(uint32_t attachmentIndex, int mouseX, int mouseY) = 0;
+
 		virtual void Resize(uint32_t width, uint32_t height) = 0;
 		virtual void DestroyImGuiDescriptors() = 0;
 
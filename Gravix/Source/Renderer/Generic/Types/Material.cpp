@@ -2,7 +2,10 @@
 #include "Material.h"
 
 #include "Core/Application.h"
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/Types/VulkanMaterial.h"
+#endif
+#include "Renderer/Null/Types/NullMaterial.h"
 
 namespace Gravix
 {
@@ -13,7 +16,10 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:  return CreateRef<VulkanMaterial>(device, shaderHandle, pipelineHandle);
+#endif
+		case DeviceType::Null:    return CreateRef<NullMaterial>(device, shaderHandle, pipelineHandle);
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return nullptr;
@@ -26,7 +32,10 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:  return CreateRef<VulkanMaterial>(device, shader, pipeline);
+#endif
+		case DeviceType::Null:    return CreateRef<NullMaterial>(device, shader, pipeline);
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return nullptr;
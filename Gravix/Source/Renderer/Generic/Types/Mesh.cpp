@@ -3,7 +3,10 @@
 
 #include "Core/Application.h"
 
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/Types/VulkanMesh.h"
+#endif
+#include "Renderer/Null/Types/NullMesh.h"
 
 namespace Gravix 
 {
@@ -15,7 +18,10 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan: return CreateRef<VulkanMesh>(device, vertexSize, vertexCapacity, indexCapacity);
+#endif
+		case DeviceType::Null:   return CreateRef<NullMesh>(device, vertexSize, vertexCapacity, indexCapacity);
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return nullptr;
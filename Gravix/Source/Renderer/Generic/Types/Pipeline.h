@@ -2,6 +2,8 @@
 
 #include "Asset/Asset.h"
 #include "Renderer/Specification.h"
+#include "Serialization/BinarySerializer.h"
+#include "Serialization/BinaryDeserializer.h"
 
 #include <string>
 
@@ -30,6 +32,32 @@ namespace Gravix
 		float LineWidth = 1.0f;
 
 		// RenderTarget is NOT stored here - it's provided by the application at runtime
+
+		void Serialize(BinarySerializer& serializer)
+		{
+			serializer.Write(static_cast<uint32_t>(BlendingMode));
+			serializer.Write(EnableDepthTest);
+			serializer.Write(EnableDepthWrite);
+			serializer.Write(static_cast<uint32_t>(DepthCompareOp));
+			serializer.Write(static_cast<uint32_t>(CullMode));
+			serializer.Write(static_cast<uint32_t>(FrontFaceWinding));
+			serializer.Write(static_cast<uint32_t>(FillMode));
+			serializer.Write(static_cast<uint32_t>(GraphicsTopology));
+			serializer.Write(LineWidth);
+		}
+
+		void Deserialize(BinaryDeserializer& deserializer)
+		{
+			BlendingMode = static_cast<Blending>(deserializer.Read<uint32_t>());
+			EnableDepthTest = deserializer.Read<bool>();
+			EnableDepthWrite = deserializer.Read<bool>();
+			DepthCompareOp = static_cast<CompareOp>(deserializer.Read<uint32_t>());
+			CullMode = static_cast<Cull>(deserializer.Read<uint32_t>());
+			FrontFaceWinding = static_cast<FrontFace>(deserializer.Read<uint32_t>());
+			FillMode = static_cast<Fill>(deserializer.Read<uint32_t>());
+			GraphicsTopology = static_cast<Topology>(deserializer.Read<uint32_t>());
+			LineWidth = deserializer.Read<float>();
+		}
 	};
 
 	// Pipeline Asset - stores graphics pipeline configuration (YAML serialized)
@@ -2,7 +2,10 @@
 #include "Shader.h"
 
 #include "Core/Application.h"
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/Types/VulkanShader.h"
+#endif
+#include "Renderer/Null/Types/NullShader.h"
 
 namespace Gravix
 {
@@ -14,7 +17,10 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:  return CreateRef<VulkanShader>(shaderPath, type);
+#endif
+		case DeviceType::Null:    return CreateRef<NullShader>(shaderPath, type);
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return nullptr;
@@ -29,9 +35,20 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:  return CreateRef<VulkanShader>(sourcePath, type, spirvData, reflection);
+#endif
+		case DeviceType::Null:    return CreateRef<NullShader>(sourcePath, type, spirvData, reflection);
 		}
 		GX_VERIFY("Unknown RendererAPI!");
 		return nullptr;
 	}
+
+	AssetMemoryUsage Shader::GetMemoryUsage() const
+	{
+		AssetMemoryUsage usage;
+		for (const std::vector<uint32_t>& stage : GetSPIRV())
+			usage.CPUBytes += stage.size() * sizeof(uint32_t);
+		return usage;
+	}
 }
@@ -24,6 +24,8 @@ namespace Gravix
 		virtual ~Shader() = default;
 
 		virtual AssetType GetAssetType() const override { return AssetType::Shader; }
+		// SPIR-V is kept on the CPU for reflection and pipeline rebuilds
+		virtual AssetMemoryUsage GetMemoryUsage() const override;
 
 		virtual ShaderType GetShaderType() const = 0;
 		virtual const std::vector<std::vector<uint32_t>>& GetSPIRV() const = 0;
@@ -3,7 +3,10 @@
 
 #include "Core/Application.h"
 
+#ifdef ENGINE_USE_VULKAN
 #include "Renderer/Vulkan/Types/VulkanTexture.h"
+#endif
+#include "Renderer/Null/Types/NullTexture.h"
 
 namespace Gravix
 {
@@ -15,10 +18,18 @@ namespace Gravix
 		switch (device->GetType())
 		{
 		case DeviceType::None:    GX_VERIFY("DeviceType::None is currently not supported!"); return nullptr;
+#ifdef ENGINE_USE_VULKAN
 		case DeviceType::Vulkan:
 		{
 			Ref<Texture2D> texture = CreateRef<VulkanTexture2D>(device, data, width, height, specification);
-			device->RegisterTexture(texture);
+			device->RegisterTexture(texture.Raw());
+			return texture;
+		}
+#endif
+		case DeviceType::Null:
+		{
+			Ref<Texture2D> texture = CreateRef<NullTexture2D>(device, data, width, height, specification);
+			device->RegisterTexture(texture.Raw());
 			return texture;
 		}
 		}
@@ -26,4 +37,53 @@ namespace Gravix
 		return nullptr;
 	}
 
+	AssetMemoryUsage Texture2D::GetMemoryUsage() const
+	{
+		AssetMemoryUsage usage;
+		uint32_t residentMip = GetResidentMip();
+		usage.GPUBytes = GetTextureMipChainSize(GetFormat(), std::max(GetWidth() >> residentMip, 1u),
+			std::max(GetHeight() >> residentMip, 1u), GetMipLevels() - residentMip);
+		return usage;
+	}
+
+	bool IsCompressedTextureFormat(TextureFormat format)
+	{
+		return format != TextureFormat::RGBA8;
+	}
+
+	uint64_t GetTextureLevelSize(TextureFormat format, uint32_t width, uint32_t height)
+	{
+		uint64_t blocks = static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+
+		switch (format)
+		{
+		case TextureFormat::RGBA8: return static_cast<uint64_t>(width) * height * 4;
+		case TextureFormat::BC7:   return blocks * 16;
+		case TextureFormat::BC5:   return blocks * 16;
+		case TextureFormat::BC4:   return blocks * 8;
+		}
+		return 0;
+	}
+
+	uint64_t GetTextureMipChainSize(TextureFormat format, uint32_t width, uint32_t height, uint32_t mipLevels)
+	{
+		uint64_t size = 0;
+		for (uint32_t mip = 0; mip < mipLevels; mip++)
+			size += GetTextureLevelSize(format, std::max(width >> mip, 1u), std::max(height >> mip, 1u));
+		return size;
+	}
+
+	uint32_t GetFullMipChainLevels(uint32_t width, uint32_t height)
+	{
+		return static_cast<uint32_t>(std::floor(std::log2(std::max({ width, height, 1u })))) + 1;
+	}
+
+	uint32_t GetFirstMipWithin(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t maxDimension)
+	{
+		uint32_t mip = 0;
+		while (mip + 1 < mipLevels && std::max(width >> mip, height >> mip) > maxDimension)
+			mip++;
+		return mip;
+	}
+
 }
@@ -21,10 +21,22 @@ namespace Gravix
 		TextureFilter MagFilter = TextureFilter::Linear;
 		TextureWrap WrapS = TextureWrap::Repeat;
 		TextureWrap WrapT = TextureWrap::Repeat;
-		bool GenerateMipmaps = false;
+		bool GenerateMipmaps = false;   // RGBA8 only; compressed data has to bring its own levels
+		TextureFormat Format = TextureFormat::RGBA8;
+		uint32_t MipLevels = 1;         // Levels in the chain, largest first and tightly packed
+		uint32_t ResidentMip = 0;       // First level in the data; the ones above it are left for streaming
 		std::string DebugName = "Texture";
 	};
 
+	bool IsCompressedTextureFormat(TextureFormat format);
+
+	// Bytes one level of the given size takes; block formats round up to whole 4x4 blocks
+	uint64_t GetTextureLevelSize(TextureFormat format, uint32_t width, uint32_t height);
+	uint64_t GetTextureMipChainSize(TextureFormat format, uint32_t width, uint32_t height, uint32_t mipLevels);
+	uint32_t GetFullMipChainLevels(uint32_t width, uint32_t height);
+	// First level of the chain no larger than maxDimension on either side; the last level if none is
+	uint32_t GetFirstMipWithin(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t maxDimension);
+
 	class Texture : public Asset
 	{
 	public:
@@ -33,6 +45,7 @@ namespace Gravix
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
 		virtual uint32_t GetMipLevels() const = 0;
+		virtual TextureFormat GetFormat() const = 0;
 
 		virtual UUID GetUUID() = 0;
 
@@ -46,6 +59,21 @@ namespace Gravix
 
 		static AssetType GetStaticType() { return AssetType::Texture2D; }
 		virtual AssetType GetAssetType() const override { return GetStaticType(); }
+		// Image plus the resident part of its mip chain in device memory
+		virtual AssetMemoryUsage GetMemoryUsage() const override;
+
+		// Only the levels from the resident mip down are in memory. Width, height and mip
+		// levels always describe the whole chain; samplers see the smaller image transparently.
+		virtual uint32_t GetResidentMip() const = 0;
+		// Replaces the resident levels; data holds levels [firstMip, GetMipLevels()) largest first.
+		// Frames in flight keep sampling the old image until they finish.
+		virtual void SetResidentLevels(Buffer data, uint32_t firstMip) = 0;
+
+		// Draw feedback for streaming: the most detailed level any draw could use this frame
+		void RequestMip(uint32_t mip) { m_RequestedMip = std::min(m_RequestedMip, mip); }
+		// Returns the level requested since the last call, or NoMipRequested
+		uint32_t ConsumeRequestedMip() { uint32_t mip = m_RequestedMip; m_RequestedMip = NoMipRequested; return mip; }
+		static constexpr uint32_t NoMipRequested = UINT32_MAX;
 
 #ifdef GRAVIX_EDITOR_BUILD
 		virtual void* GetImGuiAttachment() = 0;
@@ -53,6 +81,8 @@ namespace Gravix
 #endif
 
 		static Ref<Texture2D> Create(Buffer data, uint32_t width = 1, uint32_t height = 1, const TextureSpecification& specification = TextureSpecification());
+	private:
+		uint32_t m_RequestedMip = NoMipRequested;
 	};
 
 }
\ No newline at end of file
@@ -37,6 +37,9 @@ namespace Gravix
 		}
 		device->GetTextures().clear();
 
+		// The device is idle, so the sets removed above can go before the backend does
+		device->DestroyAllPending();
+
 		ImGui_ImplWin32_Shutdown();
 		ImGui_ImplVulkan_Shutdown();
 		ImGui::DestroyContext();
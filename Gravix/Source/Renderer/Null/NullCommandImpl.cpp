@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "NullCommandImpl.h"
+
+namespace Gravix
+{
+
+	NullCommandImpl::NullCommandImpl(Device* device, Ref<Framebuffer> targetFrameBuffer, uint32_t presentIndex, bool shouldCopy)
+		: m_Device(static_cast<NullDevice*>(device)), m_TargetFramebuffer(static_cast<NullFramebuffer*>(targetFrameBuffer.get())),
+		m_PresentIndex(presentIndex), m_ShouldCopy(shouldCopy)
+	{
+	}
+
+	NullCommandImpl::~NullCommandImpl()
+	{
+		if (m_IsRendering)
+			GX_CORE_WARN("Command destroyed inside BeginRendering/EndRendering");
+
+		if (m_ShouldCopy)
+			CopyToSwapchain();
+	}
+
+	void NullCommandImpl::BindResource(uint32_t binding, Framebuffer* buffer, uint32_t index, bool sampler)
+	{
+		if (m_BoundMaterial != nullptr && buffer != nullptr)
+			m_Device->GetFrameStats().FramebufferBindings++;
+	}
+
+	void NullCommandImpl::BindResource(uint32_t binding, uint32_t index, Texture2D* texture)
+	{
+		if (m_BoundMaterial != nullptr && texture != nullptr)
+			m_Device->GetFrameStats().TextureBindings++;
+	}
+
+	void NullCommandImpl::BindMaterial(void* pushConstants)
+	{
+		if (m_BoundMaterial == nullptr)
+			return;
+
+		m_BoundMaterial->Bind(pushConstants);
+		m_Device->GetFrameStats().MaterialBinds++;
+	}
+
+	void NullCommandImpl::Dispatch()
+	{
+		if (m_BoundMaterial != nullptr && m_TargetFramebuffer != nullptr)
+			m_Device->GetFrameStats().Dispatches++;
+	}
+
+	void NullCommandImpl::BeginRendering()
+	{
+		if (m_IsRendering)
+			GX_CORE_WARN("BeginRendering called twice without EndRendering");
+
+		m_IsRendering = true;
+		m_Device->GetFrameStats().RenderPasses++;
+	}
+
+	void NullCommandImpl::BindMesh(Mesh* mesh)
+	{
+		m_BoundMesh = static_cast<NullMesh*>(mesh);
+		if (m_BoundMesh == nullptr)
+			return;
+
+		m_Device->GetFrameStats().MeshBinds++;
+	}
+
+	void NullCommandImpl::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+	{
+		NullRenderStats& stats = m_Device->GetFrameStats();
+		stats.DrawCalls++;
+		stats.VerticesSubmitted += vertexCount;
+		stats.InstancesSubmitted += instanceCount;
+
+		RecordDraw(nullptr, vertexCount, instanceCount, false);
+	}
+
+	void NullCommandImpl::DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+	{
+		// A GPU would read past the index buffer here; catch it where it can be reported
+		if (m_BoundMesh != nullptr && static_cast<size_t>(firstIndex) + indexCount > m_BoundMesh->GetIndexCount())
+			GX_CORE_WARN("DrawIndexed reads {} indices but the bound mesh only has {}", firstIndex + indexCount, m_BoundMesh->GetIndexCount());
+
+		NullRenderStats& stats = m_Device->GetFrameStats();
+		stats.DrawCalls++;
+		stats.IndexedDrawCalls++;
+		stats.IndicesSubmitted += indexCount;
+		stats.InstancesSubmitted += instanceCount;
+
+		RecordDraw(m_BoundMesh, indexCount, instanceCount, true);
+	}
+
+	void NullCommandImpl::RecordDraw(const NullMesh* mesh, uint32_t count, uint32_t instanceCount, bool indexed)
+	{
+		NullDrawRecord draw;
+		draw.Material = m_BoundMaterial;
+		draw.Mesh = mesh;
+		draw.Count = count;
+		draw.InstanceCount = instanceCount;
+		draw.Indexed = indexed;
+		if (m_BoundMaterial != nullptr)
+			draw.PushConstants = m_BoundMaterial->GetLastPushConstants();
+
+		m_Device->RecordDraw(std::move(draw));
+	}
+
+	void NullCommandImpl::EndRendering()
+	{
+		if (!m_IsRendering)
+			GX_CORE_WARN("EndRendering called without BeginRendering");
+
+		m_IsRendering = false;
+	}
+
+	void NullCommandImpl::ResolveFramebuffer(Framebuffer* dst, bool shaderUse)
+	{
+		if (m_TargetFramebuffer == nullptr || dst == nullptr)
+			return;
+
+		m_Device->GetFrameStats().Resolves++;
+	}
+
+	void NullCommandImpl::CopyToSwapchain()
+	{
+		if (m_TargetFramebuffer == nullptr)
+			return;
+
+		m_Device->GetFrameStats().SwapchainCopies++;
+	}
+
+}
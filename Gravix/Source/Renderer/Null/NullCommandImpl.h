@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Renderer/CommandImpl.h"
+#include "Renderer/Generic/Device.h"
+
+#include "Types/NullFramebuffer.h"
+#include "Types/NullMaterial.h"
+#include "Types/NullMesh.h"
+#include "NullDevice.h"
+
+namespace Gravix
+{
+
+	// Accepts every command and turns it into NullRenderStats counters
+	class NullCommandImpl : public CommandImpl
+	{
+	public:
+		NullCommandImpl(Device* device, Ref<Framebuffer> targetFrameBuffer, uint32_t presentIndex, bool shouldCopy);
+		virtual ~NullCommandImpl();
+
+		virtual void SetActiveMaterial(Material* material) override { m_BoundMaterial = static_cast<NullMaterial*>(material); }
+
+		virtual void BindResource(uint32_t binding, Framebuffer* buffer, uint32_t index, bool sampler) override;
+		virtual void BindResource(uint32_t binding, uint32_t index, Texture2D* texture) override;
+		virtual void BindResource(uint32_t binding, Texture2D* texture) override { BindResource(binding, 0, texture); }
+
+		virtual void BindMaterial(void* pushConstants) override;
+		virtual void Dispatch() override;
+
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override {}
+		virtual void SetScissor(uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height) override {}
+		virtual void SetLineWidth(float width) override {}
+
+		virtual void BeginRendering() override;
+
+		virtual void BindMesh(Mesh* mesh) override;
+
+		virtual void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) override;
+		virtual void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) override;
+
+		virtual void DrawImGui() override {}
+		virtual void EndRendering() override;
+
+		virtual void ResolveFramebuffer(Framebuffer* dst, bool shaderUse) override;
+
+		virtual void CopyToSwapchain() override;
+
+		virtual void BeginGPUScope(const char* name) override {}
+		virtual void EndGPUScope() override {}
+	private:
+		void RecordDraw(const NullMesh* mesh, uint32_t count, uint32_t instanceCount, bool indexed);
+	private:
+		NullDevice* m_Device;
+
+		NullFramebuffer* m_TargetFramebuffer;
+		NullMaterial* m_BoundMaterial = nullptr;
+		NullMesh* m_BoundMesh = nullptr;
+
+		uint32_t m_PresentIndex = 0;
+		bool m_ShouldCopy = false;
+		bool m_IsRendering = false;
+	};
+
+}
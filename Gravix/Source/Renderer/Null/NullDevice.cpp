@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "NullDevice.h"
+
+namespace Gravix
+{
+
+	NullRenderStats& NullRenderStats::operator+=(const NullRenderStats& other)
+	{
+		DrawCalls += other.DrawCalls;
+		IndexedDrawCalls += other.IndexedDrawCalls;
+		Dispatches += other.Dispatches;
+		VerticesSubmitted += other.VerticesSubmitted;
+		IndicesSubmitted += other.IndicesSubmitted;
+		InstancesSubmitted += other.InstancesSubmitted;
+
+		RenderPasses += other.RenderPasses;
+		MaterialBinds += other.MaterialBinds;
+		MeshBinds += other.MeshBinds;
+		TextureBindings += other.TextureBindings;
+		FramebufferBindings += other.FramebufferBindings;
+		Resolves += other.Resolves;
+		SwapchainCopies += other.SwapchainCopies;
+
+		VertexBytesUploaded += other.VertexBytesUploaded;
+		IndexBytesUploaded += other.IndexBytesUploaded;
+		TextureBytesUploaded += other.TextureBytesUploaded;
+		PushConstantBytes += other.PushConstantBytes;
+
+		return *this;
+	}
+
+	NullDevice::NullDevice(const DeviceProperties& deviceProperties)
+		: m_Width(deviceProperties.Width), m_Height(deviceProperties.Height)
+	{
+		GX_CORE_INFO("Created Null device ({}x{}), no GPU work will be performed", m_Width, m_Height);
+	}
+
+	NullDevice::~NullDevice()
+	{
+		ReleaseAllResources();
+	}
+
+	void NullDevice::StartFrame()
+	{
+		// Uploads made between frames (asset loads, resizes) are kept and attributed to this frame
+		m_FrameStarted = true;
+
+		// Nothing is ever in flight
+		ReleaseAllResources();
+	}
+
+	void NullDevice::EndFrame()
+	{
+		m_LastFrameStats = m_FrameStats;
+		m_TotalStats += m_FrameStats;
+		m_FrameStats = {};
+
+		// Swapped so both vectors keep their capacity across frames
+		m_LastFrameDraws.swap(m_FrameDraws);
+		m_FrameDraws.clear();
+
+		m_FrameStarted = false;
+		m_FrameCount++;
+	}
+
+	void NullDevice::ResetStats()
+	{
+		m_FrameStats = {};
+		m_LastFrameStats = {};
+		m_TotalStats = {};
+		m_FrameCount = 0;
+
+		m_FrameDraws.clear();
+		m_LastFrameDraws.clear();
+	}
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Renderer/Generic/Device.h"
+
+#include <vector>
+
+namespace Gravix
+{
+
+	class NullMaterial;
+	class NullMesh;
+
+	// Everything the Null backend was asked to do, counted per frame
+	struct NullRenderStats
+	{
+		uint32_t DrawCalls = 0;          // Draw + DrawIndexed
+		uint32_t IndexedDrawCalls = 0;
+		uint32_t Dispatches = 0;
+		uint64_t VerticesSubmitted = 0;  // Vertex count of non-indexed draws
+		uint64_t IndicesSubmitted = 0;
+		uint64_t InstancesSubmitted = 0;
+
+		uint32_t RenderPasses = 0;
+		uint32_t MaterialBinds = 0;
+		uint32_t MeshBinds = 0;
+		uint32_t TextureBindings = 0;
+		uint32_t FramebufferBindings = 0;
+		uint32_t Resolves = 0;
+		uint32_t SwapchainCopies = 0;
+
+		uint64_t VertexBytesUploaded = 0;
+		uint64_t IndexBytesUploaded = 0;
+		uint64_t TextureBytesUploaded = 0;
+		uint64_t PushConstantBytes = 0;
+
+		uint64_t GetBytesUploaded() const { return VertexBytesUploaded + IndexBytesUploaded + TextureBytesUploaded; }
+		uint32_t GetResourceBindings() const { return TextureBindings + FramebufferBindings; }
+
+		NullRenderStats& operator+=(const NullRenderStats& other);
+	};
+
+	// One draw as a GPU would have received it. The pointers stay valid while the resources live.
+	struct NullDrawRecord
+	{
+		const NullMaterial* Material = nullptr;
+		const NullMesh* Mesh = nullptr;  // Index source; nullptr for non-indexed draws
+		uint32_t Count = 0;              // Indices for indexed draws, vertices otherwise
+		uint32_t InstanceCount = 0;
+		bool Indexed = false;
+
+		// Push constants at the time of the draw; vertices are pulled through the address in them
+		std::vector<uint8_t> PushConstants;
+	};
+
+	// Device without a GPU, window or swapchain. Every call succeeds; resources keep
+	// their data in CPU memory so benchmarks and tests can inspect what was submitted.
+	class NullDevice : public Device
+	{
+	public:
+		NullDevice(const DeviceProperties& deviceProperties);
+		virtual ~NullDevice();
+
+		virtual DeviceType GetType() const override { return DeviceType::Null; }
+
+		virtual void StartFrame() override;
+		virtual void EndFrame() override;
+		virtual void WaitIdle() override {}
+
+		// Statistics of the frame currently being recorded (also collects uploads made outside a frame)
+		NullRenderStats& GetFrameStats() { return m_FrameStats; }
+		const NullRenderStats& GetLastFrameStats() const { return m_LastFrameStats; }
+		const NullRenderStats& GetTotalStats() const { return m_TotalStats; }
+		void ResetStats();
+
+		void RecordDraw(NullDrawRecord&& draw) { m_FrameDraws.push_back(std::move(draw)); }
+		const std::vector<NullDrawRecord>& GetLastFrameDraws() const { return m_LastFrameDraws; }
+
+		uint64_t GetFrameCount() const { return m_FrameCount; }
+		bool IsFrameStarted() const { return m_FrameStarted; }
+
+		uint32_t GetWidth() const { return m_Width; }
+		uint32_t GetHeight() const { return m_Height; }
+		void Resize(uint32_t width, uint32_t height) { m_Width = width; m_Height = height; }
+	private:
+		NullRenderStats m_FrameStats;
+		NullRenderStats m_LastFrameStats;
+		NullRenderStats m_TotalStats;
+
+		std::vector<NullDrawRecord> m_FrameDraws;
+		std::vector<NullDrawRecord> m_LastFrameDraws;
+
+		uint64_t m_FrameCount = 0;
+		bool m_FrameStarted = false;
+
+		uint32_t m_Width;
+		uint32_t m_Height;
+	};
+
+}
@@ -0,0 +1,22 @@
+#include "pch.h"
+#include "NullFramebuffer.h"
+
+namespace Gravix
+{
+
+	NullFramebuffer::NullFramebuffer(Device* device, const FramebufferSpecification& spec)
+		: m_Specification(spec)
+	{
+	}
+
+	void NullFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || (width == m_Specification.Width && height == m_Specification.Height))
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		m_ResizeCount++;
+	}
+
+}
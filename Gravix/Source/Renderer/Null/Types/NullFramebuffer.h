@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Renderer/Generic/Types/Framebuffer.h"
+#include "Renderer/Null/NullDevice.h"
+
+#include <map>
+
+namespace Gravix
+{
+
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(Device* device, const FramebufferSpecification& spec);
+		virtual ~NullFramebuffer() = default;
+
+		virtual uint32_t GetWidth() const override { return m_Specification.Width; }
+		virtual uint32_t GetHeight() const override { return m_Specification.Height; }
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+
+		virtual void* GetColorAttachmentID(uint32_t index) override { return nullptr; }
+		virtual void DestroyImGuiDescriptors() override {}
+
+		virtual void SetClearColor(uint32_t index, const glm::vec4 clearColor) override { m_ClearColors[index] = clearColor; }
+		virtual void SetClearColor(uint32_t index, const glm::ivec4 clearColor) override { m_ClearColorsInt[index] = clearColor; }
+
+		// Nothing is rasterized, so every pixel reads back as "no entity"
+		virtual int ReadPixel(uint32_t attachmentIndex, int mouseX, int mouseY) override { return -1; }
+		virtual int ReadPixelAsync(uint32_t attachmentIndex, int mouseX, int mouseY) override { return -1; }
+
+		const FramebufferSpecification& GetSpecification() const { return m_Specification; }
+		uint32_t GetResizeCount() const { return m_ResizeCount; }
+	private:
+		FramebufferSpecification m_Specification;
+
+		std::map<uint32_t, glm::vec4> m_ClearColors;
+		std::map<uint32_t, glm::ivec4> m_ClearColorsInt;
+
+		uint32_t m_ResizeCount = 0;
+	};
+
+}
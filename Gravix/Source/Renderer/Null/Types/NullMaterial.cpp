@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "NullMaterial.h"
+
+#include "Asset/EditorAssetManager.h"
+#include "Project/Project.h"
+
+namespace Gravix
+{
+
+	NullMaterial::NullMaterial(Device* device, AssetHandle shaderHandle, AssetHandle pipelineHandle)
+		: m_Device(static_cast<NullDevice*>(device))
+	{
+		if (shaderHandle == 0 || pipelineHandle == 0)
+		{
+			GX_CORE_WARN("Created material with null shader or pipeline handle. Assign them before rendering.");
+			return;
+		}
+
+		auto assetManager = Project::GetActive()->GetEditorAssetManager();
+
+		m_Shader = assetManager->GetAsset(shaderHandle);
+		m_Pipeline = assetManager->GetAsset(pipelineHandle);
+
+		if (!m_Shader)
+		{
+			GX_CORE_ERROR("Failed to load shader for material!");
+			return;
+		}
+
+		if (!m_Pipeline)
+		{
+			GX_CORE_ERROR("Failed to load pipeline for material!");
+			return;
+		}
+
+		m_IsCompute = (m_Shader->GetShaderType() == ShaderType::Compute);
+	}
+
+	NullMaterial::NullMaterial(Device* device, Ref<Shader> shader, Ref<Pipeline> pipeline)
+		: m_Device(static_cast<NullDevice*>(device)), m_Shader(shader), m_Pipeline(pipeline)
+	{
+		if (!m_Shader)
+		{
+			GX_CORE_WARN("Created material with null shader. Assign shader before rendering.");
+			return;
+		}
+
+		if (!m_Pipeline)
+		{
+			GX_CORE_WARN("Created material with null pipeline. Assign pipeline before rendering.");
+			return;
+		}
+
+		m_IsCompute = (m_Shader->GetShaderType() == ShaderType::Compute);
+	}
+
+	void NullMaterial::SetFramebuffer(Ref<Framebuffer> framebuffer)
+	{
+		m_RenderTarget = framebuffer;
+		m_Ready = m_Shader != nullptr;
+	}
+
+	DynamicStruct NullMaterial::GetPushConstantStruct()
+	{
+		return DynamicStruct(m_Shader->GetReflection().GetReflectedStruct("PushConstants"));
+	}
+
+	DynamicStruct NullMaterial::GetMaterialStruct()
+	{
+		return DynamicStruct(m_Shader->GetReflection().GetReflectedStruct("Material"));
+	}
+
+	DynamicStruct NullMaterial::GetVertexStruct()
+	{
+		return DynamicStruct(m_Shader->GetReflection().GetReflectedStruct("Vertex"));
+	}
+
+	size_t NullMaterial::GetVertexSize()
+	{
+		return m_Shader->GetReflection().GetReflectedStruct("Vertex").GetSize();
+	}
+
+	ReflectedStruct NullMaterial::GetReflectedStruct(const std::string& name)
+	{
+		return m_Shader->GetReflection().GetReflectedStruct(name);
+	}
+
+	void NullMaterial::Bind(void* pushConstants)
+	{
+		if (!m_Shader)
+			return;
+
+		uint32_t pushConstantSize = m_Shader->GetReflection().GetPushConstantSize();
+		if (pushConstants && pushConstantSize > 0)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(pushConstants);
+			m_LastPushConstants.assign(bytes, bytes + pushConstantSize);
+			m_Device->GetFrameStats().PushConstantBytes += pushConstantSize;
+		}
+	}
+
+}
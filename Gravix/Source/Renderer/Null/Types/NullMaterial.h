@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Renderer/Generic/Types/Material.h"
+#include "Renderer/Generic/Types/Shader.h"
+#include "Renderer/Generic/Types/Pipeline.h"
+#include "Renderer/Generic/Types/Framebuffer.h"
+
+#include "Renderer/Null/NullDevice.h"
+
+#include <vector>
+
+namespace Gravix
+{
+
+	class NullMaterial : public Material
+	{
+	public:
+		NullMaterial(Device* device, AssetHandle shaderHandle, AssetHandle pipelineHandle);
+		NullMaterial(Device* device, Ref<Shader> shader, Ref<Pipeline> pipeline);
+		virtual ~NullMaterial() = default;
+
+		virtual DynamicStruct GetPushConstantStruct() override;
+		virtual DynamicStruct GetMaterialStruct() override;
+		virtual DynamicStruct GetVertexStruct() override;
+
+		virtual size_t GetVertexSize() override;
+		virtual ReflectedStruct GetReflectedStruct(const std::string& name) override;
+
+		virtual Ref<Shader> GetShader() const override { return m_Shader; }
+		virtual Ref<Pipeline> GetPipeline() const override { return m_Pipeline; }
+
+		virtual void SetFramebuffer(Ref<Framebuffer> framebuffer) override;
+		virtual bool IsReady() const override { return m_Ready; }
+
+		// Copies the push constants so tests can check what a draw would have received
+		void Bind(void* pushConstants);
+
+		const std::vector<uint8_t>& GetLastPushConstants() const { return m_LastPushConstants; }
+		Ref<Framebuffer> GetRenderTarget() const { return m_RenderTarget; }
+		bool IsCompute() const { return m_IsCompute; }
+	private:
+		NullDevice* m_Device;
+
+		Ref<Shader> m_Shader;
+		Ref<Pipeline> m_Pipeline;
+		Ref<Framebuffer> m_RenderTarget;
+
+		std::vector<uint8_t> m_LastPushConstants;
+
+		bool m_IsCompute = false;
+		bool m_Ready = false;
+	};
+
+}
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "NullMesh.h"
+
+namespace Gravix
+{
+
+	NullMesh::NullMesh(Device* device, size_t vertexSize, size_t vertexCapacity, size_t indexCapacity)
+		: m_Device(static_cast<NullDevice*>(device))
+		, m_VertexSize(vertexSize)
+	{
+		m_VertexData.reserve(vertexSize * vertexCapacity);
+		m_Indices.reserve(indexCapacity);
+	}
+
+	void NullMesh::SetVertices(const std::vector<DynamicStruct>& vertices)
+	{
+		// Same contract as the GPU meshes: an empty upload leaves the previous contents
+		if (vertices.empty())
+			return;
+
+		size_t dataSize = vertices.size() * m_VertexSize;
+		m_VertexData.resize(dataSize);
+
+		for (size_t i = 0; i < vertices.size(); i++)
+			memcpy(m_VertexData.data() + i * m_VertexSize, vertices[i].Data(), m_VertexSize);
+
+		m_Device->GetFrameStats().VertexBytesUploaded += dataSize;
+	}
+
+	void NullMesh::SetIndices(std::vector<uint32_t> indices)
+	{
+		if (indices.empty())
+			return;
+
+		m_Device->GetFrameStats().IndexBytesUploaded += indices.size() * sizeof(uint32_t);
+		m_Indices = std::move(indices);
+	}
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Renderer/Generic/Types/Mesh.h"
+#include "Renderer/Null/NullDevice.h"
+
+namespace Gravix
+{
+
+	class NullMesh : public Mesh
+	{
+	public:
+		NullMesh(Device* device, size_t vertexSize, size_t vertexCapacity = 1024, size_t indexCapacity = 1024);
+		~NullMesh() override = default;
+
+		virtual void SetVertices(const std::vector<DynamicStruct>& vertices) override;
+		virtual void SetIndices(std::vector<uint32_t> indices) override;
+
+		// Query
+		size_t GetIndexCount() const override { return m_Indices.size(); }
+
+		// No device addresses without a GPU; the CPU copy's address stands in for it
+		uint64_t GetVertexBufferAddress() const override { return reinterpret_cast<uint64_t>(m_VertexData.data()); }
+
+		// CPU copies of the last uploaded geometry
+		const std::vector<uint8_t>& GetVertexData() const { return m_VertexData; }
+		const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+		size_t GetVertexCount() const { return m_VertexSize > 0 ? m_VertexData.size() / m_VertexSize : 0; }
+		size_t GetVertexSize() const { return m_VertexSize; }
+	private:
+		NullDevice* m_Device;
+
+		size_t m_VertexSize;
+
+		std::vector<uint8_t> m_VertexData;
+		std::vector<uint32_t> m_Indices;
+	};
+
+}
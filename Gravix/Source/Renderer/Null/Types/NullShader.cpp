@@ -0,0 +1,32 @@
+#include "pch.h"
+#include "NullShader.h"
+
+#ifdef GRAVIX_EDITOR_BUILD
+#include "Utils/ShaderCompilerSystem.h"
+#endif
+
+namespace Gravix
+{
+
+#ifdef GRAVIX_EDITOR_BUILD
+	NullShader::NullShader(const std::filesystem::path& shaderPath, ShaderType type)
+		: m_SourcePath(shaderPath), m_Type(type)
+	{
+		// Compilation does not touch the device, so reflection matches the Vulkan path
+		bool success = ShaderCompilerSystem::Get().CompileShader(shaderPath, &m_SPIRVCode, &m_Reflection);
+
+		if (!success)
+		{
+			GX_CORE_ERROR("Failed to compile shader: {0}", shaderPath.string());
+			m_SPIRVCode.clear();
+		}
+	}
+#endif
+
+	NullShader::NullShader(const std::filesystem::path& sourcePath, ShaderType type,
+		const std::vector<std::vector<uint32_t>>& spirvData, const ShaderReflection& reflection)
+		: m_SourcePath(sourcePath), m_Type(type), m_SPIRVCode(spirvData), m_Reflection(reflection)
+	{
+	}
+
+}
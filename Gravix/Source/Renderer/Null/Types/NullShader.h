@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Renderer/Generic/Types/Shader.h"
+#include "Reflections/ShaderReflection.h"
+
+#include <vector>
+#include <filesystem>
+
+namespace Gravix
+{
+
+	// Keeps SPIR-V and reflection only; reflection is what materials need to build
+	// push constant and vertex layouts, so the render path behaves as on a GPU
+	class NullShader : public Shader
+	{
+	public:
+#ifdef GRAVIX_EDITOR_BUILD
+		NullShader(const std::filesystem::path& shaderPath, ShaderType type);
+#endif
+
+		NullShader(const std::filesystem::path& sourcePath, ShaderType type,
+			const std::vector<std::vector<uint32_t>>& spirvData, const ShaderReflection& reflection);
+
+		virtual ~NullShader() = default;
+
+		virtual ShaderType GetShaderType() const override { return m_Type; }
+		virtual const std::vector<std::vector<uint32_t>>& GetSPIRV() const override { return m_SPIRVCode; }
+		virtual const ShaderReflection& GetReflection() const override { return m_Reflection; }
+
+		virtual const std::filesystem::path& GetSourcePath() const override { return m_SourcePath; }
+
+	private:
+		std::filesystem::path m_SourcePath;
+		ShaderType m_Type;
+
+		std::vector<std::vector<uint32_t>> m_SPIRVCode;
+		ShaderReflection m_Reflection;
+	};
+
+}
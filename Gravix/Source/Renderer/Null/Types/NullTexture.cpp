@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "NullTexture.h"
+
+namespace Gravix
+{
+
+	NullTexture2D::NullTexture2D(Device* device, Buffer data, uint32_t width, uint32_t height, const TextureSpecification& specification)
+		: m_Device(device)
+		, m_Specification(specification)
+		, m_Width(width)
+		, m_Height(height)
+	{
+		// Cooked data carries its own mip chain, and block compressed data always does
+		bool hasLevels = IsCompressedTextureFormat(m_Specification.Format) || m_Specification.MipLevels > 1;
+		if (hasLevels)
+		{
+			m_MipLevels = std::max(m_Specification.MipLevels, 1u);
+			m_ResidentMip = std::min(m_Specification.ResidentMip, m_MipLevels - 1);
+		}
+		else if (m_Specification.GenerateMipmaps)
+		{
+			m_MipLevels = GetFullMipChainLevels(m_Width, m_Height);
+		}
+
+		if (!data)
+			return;
+
+		// Only levels the data actually carries count as uploaded, like the GPU textures
+		uint32_t residentLevels = hasLevels ? m_MipLevels - m_ResidentMip : 1;
+		uint64_t dataSize = std::min<uint64_t>(data.Size, GetTextureMipChainSize(m_Specification.Format,
+			std::max(m_Width >> m_ResidentMip, 1u), std::max(m_Height >> m_ResidentMip, 1u), residentLevels));
+		m_Pixels.assign(data.Data, data.Data + dataSize);
+
+		static_cast<NullDevice*>(device)->GetFrameStats().TextureBytesUploaded += dataSize;
+	}
+
+	void NullTexture2D::SetResidentLevels(Buffer data, uint32_t firstMip)
+	{
+		if (!data || firstMip >= m_MipLevels)
+			return;
+
+		m_ResidentMip = firstMip;
+		uint64_t dataSize = std::min<uint64_t>(data.Size, GetTextureMipChainSize(m_Specification.Format,
+			std::max(m_Width >> m_ResidentMip, 1u), std::max(m_Height >> m_ResidentMip, 1u), m_MipLevels - m_ResidentMip));
+		m_Pixels.assign(data.Data, data.Data + dataSize);
+
+		static_cast<NullDevice*>(m_Device)->GetFrameStats().TextureBytesUploaded += dataSize;
+	}
+
+	NullTexture2D::~NullTexture2D()
+	{
+		m_Device->UnregisterTexture(this);
+	}
+
+}
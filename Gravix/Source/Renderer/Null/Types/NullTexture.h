@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Renderer/Generic/Types/Texture.h"
+
+#include "Core/UUID.h"
+
+#include "Renderer/Null/NullDevice.h"
+
+#include <vector>
+
+namespace Gravix
+{
+
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		NullTexture2D(Device* device, Buffer data, uint32_t width, uint32_t height, const TextureSpecification& specification);
+		virtual ~NullTexture2D();
+
+		// Inherited from Texture
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetMipLevels() const override { return m_MipLevels; }
+		virtual TextureFormat GetFormat() const override { return m_Specification.Format; }
+
+		// Inherited from Texture2D
+		virtual uint32_t GetResidentMip() const override { return m_ResidentMip; }
+		virtual void SetResidentLevels(Buffer data, uint32_t firstMip) override;
+
+		// Nothing lives on a GPU; the pixel copy is the whole footprint
+		virtual AssetMemoryUsage GetMemoryUsage() const override { return { m_Pixels.size(), 0 }; }
+
+#ifdef GRAVIX_EDITOR_BUILD
+		virtual void* GetImGuiAttachment() override { return nullptr; }
+		virtual void DestroyImGuiDescriptor() override {}
+#endif
+
+		virtual UUID GetUUID() override { return m_UUID; }
+
+		virtual bool operator==(const Texture& other) const override
+		{
+			const auto* o = dynamic_cast<const NullTexture2D*>(&other);
+			if (!o)
+				return false;
+
+			return m_UUID == o->m_UUID;
+		}
+
+		// CPU copy of the uploaded data in the texture's format, resident levels only (empty if created without data)
+		const std::vector<uint8_t>& GetPixels() const { return m_Pixels; }
+		const TextureSpecification& GetSpecification() const { return m_Specification; }
+	private:
+		Device* m_Device;
+		TextureSpecification m_Specification;
+
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+		uint32_t m_MipLevels = 1;
+		uint32_t m_ResidentMip = 0;
+
+		UUID m_UUID;
+
+		std::vector<uint8_t> m_Pixels;
+	};
+
+}
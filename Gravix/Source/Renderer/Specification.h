@@ -43,6 +43,19 @@ namespace Gravix
 		}
 	}
 
+	/**
+	 * @brief Storage formats a texture's pixels can be in
+	 *
+	 * Values are written into asset packs, so only append.
+	 */
+	enum class TextureFormat
+	{
+		RGBA8 = 0,  // Uncompressed, 4 bytes per pixel
+		BC7 = 1,    // RGBA, 16 bytes per 4x4 block
+		BC5 = 2,    // RG, 16 bytes per 4x4 block
+		BC4 = 3     // R, 8 bytes per 4x4 block; sampled as grayscale
+	};
+
 	/**
 	 * @brief Texture filtering modes
 	 */
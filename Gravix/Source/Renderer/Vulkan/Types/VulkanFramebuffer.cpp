@@ -41,6 +41,37 @@ namespace Gravix
 		}
 	}
 
+	static uint32_t GetPixelSize(VkFormat format)
+	{
+		switch (format)
+		{
+		case VK_FORMAT_R8_UINT: return 1;
+		case VK_FORMAT_R32G32B32A32_UINT: return 16;
+		default: return 4;
+		}
+	}
+
+	static int DecodePixel(VkFormat format, const void* data)
+	{
+		switch (format)
+		{
+		case VK_FORMAT_R8_UINT:
+			return *(const uint8_t*)data;
+		case VK_FORMAT_R32_UINT:
+			return *(const uint32_t*)data;
+		case VK_FORMAT_R32_SINT:
+			return *(const int32_t*)data;
+		case VK_FORMAT_R32_SFLOAT:
+			return static_cast<int>((*(const float*)data));
+		case VK_FORMAT_R32G32B32A32_UINT:
+			return ((const uint32_t*)data)[0];
+		case VK_FORMAT_R8G8B8A8_UNORM:
+			return ((const uint8_t*)data)[0]; // red channel (adjust if you store ID elsewhere)
+		default:
+			return *(const int*)data;
+		}
+	}
+
 	VulkanFramebuffer::VulkanFramebuffer(Device* device, const FramebufferSpecification& spec)
 		: m_Device(static_cast<VulkanDevice*>(device)), m_UseSamples(spec.Multisampled)
 	{
@@ -49,14 +80,15 @@ namespace Gravix
 
 	VulkanFramebuffer::~VulkanFramebuffer()
 	{
-		// Wait for GPU to finish using this framebuffer before destroying
-		m_Device->WaitIdle();
-
+		// Destroyed by the device once the frames that may still render into them finish
 		for (auto& attachment : m_Attachments)
 		{
-			vkDestroySampler(m_Device->GetDevice(), attachment.Sampler, nullptr);
-			m_Device->DestroyImage(attachment.Image);
+			m_Device->DeferDestroy(attachment.Sampler);
+			m_Device->DeferDestroy(attachment.Image);
 		}
+
+		for (auto& readback : m_PixelReadbacks)
+			m_Device->DeferDestroy(readback.Buffer);
 	}
 
 	void VulkanFramebuffer::StartFramebuffer(VkCommandBuffer cmd)
@@ -135,20 +167,9 @@ namespace Gravix
 
 		int flippedY = m_Height - mouseY - 1;
 
-		uint32_t pixelSize = 4;
-		switch (attachment.Format)
-		{
-		case VK_FORMAT_R8_UINT: pixelSize = 1; break;
-		case VK_FORMAT_R32_UINT: pixelSize = 4; break;
-		case VK_FORMAT_R32_SINT: pixelSize = 4; break;
-		case VK_FORMAT_R32G32B32A32_UINT: pixelSize = 16; break;
-		case VK_FORMAT_R8G8B8A8_UNORM: pixelSize = 4; break;
-		default: break;
-		}
-
 		// Create a small staging buffer using VMA (CPU-visible)
 		AllocatedBuffer stagingBuffer = m_Device->CreateBuffer(
-			pixelSize,
+			GetPixelSize(attachment.Format),
 			VK_BUFFER_USAGE_TRANSFER_DST_BIT,
 			VMA_MEMORY_USAGE_CPU_ONLY
 		);
@@ -156,61 +177,14 @@ namespace Gravix
 		// Copy one pixel from the attachment image into the staging buffer
 		m_Device->ImmediateSubmit([&, this](VkCommandBuffer cmd)
 			{
-				TransitionToLayout(cmd, attachmentIndex, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-
-				VkBufferImageCopy region{};
-				region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-				region.imageSubresource.mipLevel = 0;
-				region.imageSubresource.baseArrayLayer = 0;
-				region.imageSubresource.layerCount = 1;
-				region.imageOffset = { mouseX, flippedY, 0 };
-				region.imageExtent = { 1, 1, 1 };
-
-				vkCmdCopyImageToBuffer(
-					cmd,
-					attachment.Image.Image,
-					VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-					stagingBuffer.Buffer,
-					1,
-					&region
-				);
-
-				// Restore layout to color attachment
-				TransitionToLayout(cmd, attachmentIndex, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+				RecordPixelCopy(cmd, attachmentIndex, mouseX, flippedY, stagingBuffer.Buffer);
 			});
 
 		// Map and read pixel
 		void* data;
 		vmaMapMemory(m_Device->GetAllocator(), stagingBuffer.Allocation, &data);
 
-		int result = -1;
-		switch (attachment.Format)
-		{
-		case VK_FORMAT_R8_UINT:
-			result = *(uint8_t*)data;
-			break;
-		case VK_FORMAT_R32_UINT:
-			result = *(uint32_t*)data;
-			break;
-		case VK_FORMAT_R32_SINT:
-			result = *(int32_t*)data;
-			break;
-		case VK_FORMAT_R32_SFLOAT:
-			result = static_cast<int>((*(float*)data));
-			break;
-		case VK_FORMAT_R32G32B32A32_UINT:
-			result = ((uint32_t*)data)[0];
-			break;
-		case VK_FORMAT_R8G8B8A8_UNORM:
-		{
-			uint8_t* px = (uint8_t*)data;
-			result = px[0]; // red channel (adjust if you store ID elsewhere)
-			break;
-		}
-		default:
-			result = *(int*)data;
-			break;
-		}
+		int result = DecodePixel(attachment.Format, data);
 
 		vmaUnmapMemory(m_Device->GetAllocator(), stagingBuffer.Allocation);
 		m_Device->DestroyBuffer(stagingBuffer);
@@ -218,6 +192,84 @@ namespace Gravix
 		return result;
 	}
 
+	int VulkanFramebuffer::ReadPixelAsync(uint32_t attachmentIndex, int mouseX, int mouseY)
+	{
+		PixelReadback& readback = m_PixelReadbacks[m_Device->GetCurrentFrameIndex()];
+
+		// StartFrame already waited on this frame slot's fence, so the copy recorded
+		// into it FRAME_OVERLAP frames ago has finished and can be read without stalling
+		if (readback.Pending)
+		{
+			vmaInvalidateAllocation(m_Device->GetAllocator(), readback.Buffer.Allocation, 0, VK_WHOLE_SIZE);
+			m_LastReadbackValue = DecodePixel(readback.Format, readback.Buffer.Info.pMappedData);
+			readback.Pending = false;
+		}
+
+		if (attachmentIndex >= m_Attachments.size() || !m_Device->IsFrameStarted())
+			return m_LastReadbackValue;
+
+		int flippedY = m_Height - mouseY - 1;
+		if (mouseX < 0 || flippedY < 0 || mouseX >= (int)m_Width || flippedY >= (int)m_Height)
+			return m_LastReadbackValue;
+
+		if (readback.Buffer.Buffer == VK_NULL_HANDLE)
+		{
+			// Persistently mapped, sized for the widest supported attachment format
+			readback.Buffer = m_Device->CreateBuffer(GetPixelSize(VK_FORMAT_R32G32B32A32_UINT),
+				VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
+		}
+
+		// Recorded into the frame's own command buffer - no extra submit, no fence wait
+		RecordPixelCopy(m_Device->GetCurrentFrameData().CommandBuffer, attachmentIndex, mouseX, flippedY, readback.Buffer.Buffer);
+		readback.Format = m_Attachments[attachmentIndex].Format;
+		readback.Pending = true;
+
+		return m_LastReadbackValue;
+	}
+
+	void VulkanFramebuffer::RecordPixelCopy(VkCommandBuffer cmd, uint32_t attachmentIndex, int x, int y, VkBuffer dstBuffer)
+	{
+		AttachmentData& attachment = m_Attachments[attachmentIndex];
+		VkImageLayout previousLayout = attachment.Layout;
+
+		TransitionToLayout(cmd, attachmentIndex, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+		VkBufferImageCopy region{};
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = { x, y, 0 };
+		region.imageExtent = { 1, 1, 1 };
+
+		vkCmdCopyImageToBuffer(
+			cmd,
+			attachment.Image.Image,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			dstBuffer,
+			1,
+			&region
+		);
+
+		// Make the copied texel visible to host reads once the fence signals
+		VkMemoryBarrier2 hostBarrier{ .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2 };
+		hostBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+		hostBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+		hostBarrier.dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT;
+		hostBarrier.dstAccessMask = VK_ACCESS_2_HOST_READ_BIT;
+
+		VkDependencyInfo depInfo{ .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO };
+		depInfo.memoryBarrierCount = 1;
+		depInfo.pMemoryBarriers = &hostBarrier;
+		vkCmdPipelineBarrier2(cmd, &depInfo);
+
+		// Restore the layout the attachment was in (UNDEFINED would discard its contents)
+		if (previousLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+			TransitionToLayout(cmd, attachmentIndex, previousLayout);
+		else
+			TransitionToLayout(cmd, attachmentIndex, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+	}
+
 
 	void* VulkanFramebuffer::GetColorAttachmentID(uint32_t index)
 	{
@@ -248,7 +300,7 @@ namespace Gravix
 			VkDescriptorSet set = m_DescriptorSets[i];
 			if(set == VK_NULL_HANDLE) continue;
 
-			ImGui_ImplVulkan_RemoveTexture(set);
+			m_Device->DeferRemoveImGuiTexture(set);
 			m_DescriptorSets[i] = VK_NULL_HANDLE;
 		}
 	}
@@ -468,20 +520,18 @@ namespace Gravix
 
 		m_Attachments[index] = { image, oldAttachment.Format, sampler, initialLayout };
 
-		// Wait for GPU to finish using old attachment before destroying
-		m_Device->WaitIdle();
-
-		// Free the old ImGui descriptor set before destroying the image
+		// Earlier frames may still use the old attachment and its ImGui descriptor set;
+		// the set is queued first so it goes before the image it points at
 		if (m_DescriptorSets[index] != VK_NULL_HANDLE)
 		{
 #ifdef GRAVIX_EDITOR_BUILD
-			ImGui_ImplVulkan_RemoveTexture(m_DescriptorSets[index]);
+			m_Device->DeferRemoveImGuiTexture(m_DescriptorSets[index]);
 #endif
 			m_DescriptorSets[index] = VK_NULL_HANDLE;
 		}
 
-		m_Device->DestroyImage(oldAttachment.Image);
-		vkDestroySampler(m_Device->GetDevice(), oldAttachment.Sampler, nullptr);
+		m_Device->DeferDestroy(oldAttachment.Image);
+		m_Device->DeferDestroy(oldAttachment.Sampler);
 	}
 
 }
\ No newline at end of file
@@ -18,6 +18,13 @@ namespace Gravix
 		VkImageLayout Layout;
 	};
 
+	struct PixelReadback
+	{
+		AllocatedBuffer Buffer{};
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+		bool Pending = false;
+	};
+
 	class VulkanFramebuffer : public Framebuffer
 	{	
 	public:
@@ -38,6 +45,7 @@ namespace Gravix
 		virtual void SetClearColor(uint32_t index, const glm::ivec4 clearColor) override;
 		
 		virtual int ReadPixel(uint32_t attachmentIndex, int mouseX, int mouseY) override;
+		virtual int ReadPixelAsync(uint32_t attachmentIndex, int mouseX, int mouseY) override;
 
 		void TransitionToLayout(VkCommandBuffer cmd, VkImageLayout newLayout);
 		void TransitionToLayout(VkCommandBuffer cmd, uint32_t index, VkImageLayout newLayout);
@@ -67,6 +75,7 @@ namespace Gravix
 	private:
 		void Init(const FramebufferSpecification& spec);
 		void CreateImage(uint32_t index, uint32_t width, uint32_t height);
+		void RecordPixelCopy(VkCommandBuffer cmd, uint32_t attachmentIndex, int x, int y, VkBuffer dstBuffer);
 	private:
 		VulkanDevice* m_Device;
 
@@ -82,6 +91,10 @@ namespace Gravix
 		std::vector<VkDescriptorSet> m_DescriptorSets;
 		std::map<uint32_t, glm::vec4> m_ClearColors;
 		std::map<uint32_t, glm::ivec4> m_ClearColorsInt;
+
+		// One readback slot per frame in flight, resolved once that frame's fence has signaled
+		PixelReadback m_PixelReadbacks[FRAME_OVERLAP];
+		int m_LastReadbackValue = -1;
 	};
 
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "VulkanFramebuffer.h"
 #include "VulkanTexture.h"
 
-#include "Renderer/Vulkan/Utils/DescriptorWriter.h"
 #include "Renderer/Vulkan/Utils/VulkanUtils.h"
 #include "Asset/EditorAssetManager.h"
 #include "Project/Project.h"
@@ -112,11 +111,9 @@ namespace Gravix
 	{
 		if (m_PipelineBuilt)
 		{
-			// Destroy old pipeline
-			if (m_VkPipeline != VK_NULL_HANDLE)
-				vkDestroyPipeline(m_Device->GetDevice(), m_VkPipeline, nullptr);
-			if (m_PipelineLayout != VK_NULL_HANDLE)
-				vkDestroyPipelineLayout(m_Device->GetDevice(), m_PipelineLayout, nullptr);
+			// Frames in flight may still be bound to the old pipeline
+			m_Device->DeferDestroy(m_VkPipeline);
+			m_Device->DeferDestroy(m_PipelineLayout);
 		}
 
 		// Create pipeline layout
@@ -140,14 +137,11 @@ namespace Gravix
 	{
 		for (auto& shaderModule : m_ShaderModules)
 		{
-			vkDestroyShaderModule(m_Device->GetDevice(), shaderModule, nullptr);
+			m_Device->DeferDestroy(shaderModule);
 		}
 
-		if (m_PipelineLayout != VK_NULL_HANDLE)
-			vkDestroyPipelineLayout(m_Device->GetDevice(), m_PipelineLayout, nullptr);
-
-		if (m_VkPipeline != VK_NULL_HANDLE)
-			vkDestroyPipeline(m_Device->GetDevice(), m_VkPipeline, nullptr);
+		m_Device->DeferDestroy(m_PipelineLayout);
+		m_Device->DeferDestroy(m_VkPipeline);
 	}
 
 	DynamicStruct VulkanMaterial::GetPushConstantStruct()
@@ -181,7 +175,7 @@ namespace Gravix
 
 		vkCmdBindPipeline(cmd, bindPoint, m_VkPipeline);
 
-		// Bind all bindless descriptor sets (set 0: storage buffers, set 1: textures, set 2: storage images)
+		// Bind this frame's bindless descriptor sets (set 0: storage buffers, set 1: textures, set 2: storage images)
 		VkDescriptorSet* descriptorSets = m_Device->GetGlobalDescriptorSets();
 		uint32_t setCount = static_cast<uint32_t>(m_Device->GetGlobalDescriptorSetLayouts().size());
 		vkCmdBindDescriptorSets(cmd, bindPoint, m_PipelineLayout, 0, setCount, descriptorSets, 0, nullptr);
@@ -212,46 +206,35 @@ namespace Gravix
 	void VulkanMaterial::BindResource(VkCommandBuffer cmd, uint32_t binding, Framebuffer* buffer, uint32_t index, bool sampler)
 	{
 		VulkanFramebuffer* vulkanFramebuffer = static_cast<VulkanFramebuffer*>(buffer);
-		DescriptorWriter writer;
+		DescriptorStateCache& cache = m_Device->GetDescriptorCache();
 
 		if (sampler)
 		{
 			// Combined image samplers use set 1
-			writer.WriteImage(binding, vulkanFramebuffer->GetAttachmentImageView(index),
+			cache.WriteImage(1, binding, 0, vulkanFramebuffer->GetAttachmentImageView(index),
 				m_Device->GetLinearSampler(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
-			writer.UpdateSet(m_Device->GetDevice(), m_Device->GetGlobalDescriptorSet(1));
 		}
 		else
 		{
 			// Storage images use set 2
-			writer.WriteImage(binding, vulkanFramebuffer->GetAttachmentImageView(index),
+			cache.WriteImage(2, binding, 0, vulkanFramebuffer->GetAttachmentImageView(index),
 				VK_NULL_HANDLE, VK_IMAGE_LAYOUT_GENERAL, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
-			writer.UpdateSet(m_Device->GetDevice(), m_Device->GetGlobalDescriptorSet(2));
 		}
 	}
 
 	void VulkanMaterial::BindResource(VkCommandBuffer cmd, uint32_t binding, Texture2D* texture)
 	{
-		VulkanTexture2D* vulkanTexture = static_cast<VulkanTexture2D*>(texture);
-		DescriptorWriter writer;
-
-		// Combined image samplers use set 1
-		writer.WriteImage(binding, vulkanTexture->GetImageView(),
-			vulkanTexture->GetVkSampler(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
-
-		writer.UpdateSet(m_Device->GetDevice(), m_Device->GetGlobalDescriptorSet(1));
+		BindResource(cmd, binding, 0, texture);
 	}
 
 	void VulkanMaterial::BindResource(VkCommandBuffer cmd, uint32_t binding, uint32_t index, Texture2D* texture)
 	{
 		VulkanTexture2D* vulkanTexture = static_cast<VulkanTexture2D*>(texture);
-		DescriptorWriter writer;
-
-		// Combined image samplers use set 1
-		writer.WriteImage(binding, vulkanTexture->GetImageView(),
-			vulkanTexture->GetVkSampler(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, index);
 
-		writer.UpdateSet(m_Device->GetDevice(), m_Device->GetGlobalDescriptorSet(1));
+		// Combined image samplers use set 1. The write is cached per frame and
+		// flushed together with the rest of the frame's writes in EndFrame
+		m_Device->GetDescriptorCache().WriteImage(1, binding, index, vulkanTexture->GetImageView(),
+			vulkanTexture->GetVkSampler(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 	}
 
 	void VulkanMaterial::CreateShaderModules()
@@ -30,8 +30,8 @@ namespace Gravix
 
 	VulkanMesh::~VulkanMesh()
 	{
-		m_Device->DestroyBuffer(m_VertexBuffer);
-		m_Device->DestroyBuffer(m_IndexBuffer);
+		m_Device->DeferDestroy(m_VertexBuffer);
+		m_Device->DeferDestroy(m_IndexBuffer);
 	}
 
 	void VulkanMesh::SetVertices(const std::vector<DynamicStruct>& vertices)
@@ -145,8 +145,8 @@ namespace Gravix
 			});
 		}
 
-		// Destroy old buffer and update
-		m_Device->DestroyBuffer(m_VertexBuffer);
+		// Earlier frames may still read the old buffer
+		m_Device->DeferDestroy(m_VertexBuffer);
 
 		m_VertexBuffer = newBuffer;
 		m_VertexCapacity = newCapacity;
@@ -187,8 +187,8 @@ namespace Gravix
 			});
 		}
 
-		// Destroy old buffer and update
-		m_Device->DestroyBuffer(m_IndexBuffer);
+		// Earlier frames may still read the old buffer
+		m_Device->DeferDestroy(m_IndexBuffer);
 		m_IndexBuffer = newBuffer;
 		m_IndexCapacity = newCapacity;
 	}
@@ -6,36 +6,32 @@
 #endif
 #include "Serialization/BinarySerializer.h"
 #include "Serialization/BinaryDeserializer.h"
+#include "Core/Hash.h"
 #include "Project/Project.h"
 
 namespace Gravix
 {
 
 #ifdef GRAVIX_EDITOR_BUILD
+	// 2: prefixed with the content hash of the source
+	static constexpr uint32_t ShaderCacheVersion = 2;
+
 	VulkanShader::VulkanShader(const std::filesystem::path& shaderPath, ShaderType type)
 		: m_SourcePath(shaderPath), m_Type(type)
 	{
 		std::filesystem::path cachePath = GetCachePath(shaderPath);
 
-		// Check if cached version exists and is up-to-date
-		bool needsRecompile = true;
-		if (std::filesystem::exists(cachePath))
-		{
-			auto cacheTime = std::filesystem::last_write_time(cachePath);
-			auto sourceTime = std::filesystem::last_write_time(shaderPath);
-
-			if (cacheTime >= sourceTime)
-			{
-				LoadCachedShader(cachePath);
-				needsRecompile = false;
-			}
-		}
+		// The cache remembers the source it was compiled from, so touching or checking out
+		// an unchanged file does not recompile it
+		uint64_t sourceHash = Hash::ComputeFile64(shaderPath);
+		bool needsRecompile = sourceHash == 0 || !LoadCachedShader(cachePath, sourceHash);
 
 		if (needsRecompile)
 		{
 			GX_CORE_INFO("Compiling shader: {0}", shaderPath.string());
 			CompileShader(shaderPath);
-			SaveCachedShader(cachePath);
+			if (sourceHash != 0 && !m_SPIRVCode.empty())
+				SaveCachedShader(cachePath, sourceHash);
 		}
 		else
 		{
@@ -54,30 +50,49 @@ namespace Gravix
 		}
 	}
 
-	void VulkanShader::LoadCachedShader(const std::filesystem::path& cachePath)
+	bool VulkanShader::LoadCachedShader(const std::filesystem::path& cachePath, uint64_t sourceHash)
 	{
-		BinaryDeserializer deserializer(cachePath, 1);
+		std::error_code error;
+		if (!std::filesystem::is_regular_file(cachePath, error))
+			return false;
 
-		// Read SPIR-V code
-		uint32_t spirvCount = deserializer.Read<uint32_t>();
-		m_SPIRVCode.resize(spirvCount);
-		for (auto& spirv : m_SPIRVCode)
+		try
 		{
-			uint32_t size = deserializer.Read<uint32_t>();
-			spirv.resize(size);
-			deserializer.ReadBytes(spirv.data(), size * sizeof(uint32_t));
+			BinaryDeserializer deserializer(cachePath, ShaderCacheVersion);
+			if (deserializer.Read<uint64_t>() != sourceHash)
+				return false;
+
+			// Read SPIR-V code
+			uint32_t spirvCount = deserializer.Read<uint32_t>();
+			m_SPIRVCode.resize(spirvCount);
+			for (auto& spirv : m_SPIRVCode)
+			{
+				uint32_t size = deserializer.Read<uint32_t>();
+				spirv.resize(size);
+				deserializer.ReadBytes(spirv.data(), size * sizeof(uint32_t));
+			}
+
+			// Read reflection data
+			m_Reflection.Deserialize(deserializer);
+		}
+		catch (const std::exception& e)
+		{
+			// Caches written before the source hash was stored land here too
+			GX_CORE_WARN("Ignoring shader cache {0}: {1}", cachePath.string(), e.what());
+			m_SPIRVCode.clear();
+			return false;
 		}
 
-		// Read reflection data
-		m_Reflection.Deserialize(deserializer);
+		return true;
 	}
 
-	void VulkanShader::SaveCachedShader(const std::filesystem::path& cachePath)
+	void VulkanShader::SaveCachedShader(const std::filesystem::path& cachePath, uint64_t sourceHash)
 	{
 		// Ensure cache directory exists
 		std::filesystem::create_directories(cachePath.parent_path());
 
-		BinarySerializer serializer(1);
+		BinarySerializer serializer(ShaderCacheVersion);
+		serializer.Write(sourceHash);
 
 		// Write SPIR-V code
 		serializer.Write(static_cast<uint32_t>(m_SPIRVCode.size()));
@@ -32,8 +32,9 @@ namespace Gravix
 	private:
 #ifdef GRAVIX_EDITOR_BUILD
 		void CompileShader(const std::filesystem::path& shaderPath);
-		void LoadCachedShader(const std::filesystem::path& cachePath);
-		void SaveCachedShader(const std::filesystem::path& cachePath);
+		// False when the cache is missing, unreadable or was compiled from other source
+		bool LoadCachedShader(const std::filesystem::path& cachePath, uint64_t sourceHash);
+		void SaveCachedShader(const std::filesystem::path& cachePath, uint64_t sourceHash);
 
 		std::filesystem::path GetCachePath(const std::filesystem::path& shaderPath) const;
 #endif
@@ -22,6 +22,11 @@ namespace Gravix
 
 	VulkanTexture2D::~VulkanTexture2D()
 	{
+		m_Device->UnregisterTexture(this);
+#ifdef GRAVIX_EDITOR_BUILD
+		// Evicted textures may have been shown in a panel; ImGui keeps a set for each
+		DestroyImGuiDescriptor();
+#endif
 		Cleanup();
 	}
 
@@ -35,11 +40,9 @@ namespace Gravix
 
 	void VulkanTexture2D::DestroyImGuiDescriptor()
 	{
-		if(m_DescriptorSet != VK_NULL_HANDLE)
-		{
-			ImGui_ImplVulkan_RemoveTexture(m_DescriptorSet);
-			m_DescriptorSet = VK_NULL_HANDLE;
-		}
+		// The last frame's draw data may still bind it
+		m_Device->DeferRemoveImGuiTexture(m_DescriptorSet);
+		m_DescriptorSet = VK_NULL_HANDLE;
 	}
 #endif
 
@@ -53,6 +56,17 @@ namespace Gravix
 		m_Width = width;
 		m_Height = height;
 		m_Channels = channels;
+		m_Format = m_Specification.Format;
+
+		// Cooked data carries its own mip chain, and block compressed data always does
+		if (IsCompressedTextureFormat(m_Format) || m_Specification.MipLevels > 1)
+		{
+			m_MipLevels = std::max(m_Specification.MipLevels, 1u);
+			m_ResidentMip = std::min(m_Specification.ResidentMip, m_MipLevels - 1);
+			CreateVulkanResourcesFromLevels(data);
+			CreateSampler();
+			return;
+		}
 
 		// Calculate mip levels if mipmaps are enabled
 		if (m_Specification.GenerateMipmaps)
@@ -96,6 +110,63 @@ namespace Gravix
 
 	}
 
+	void VulkanTexture2D::CreateVulkanResourcesFromLevels(Buffer data)
+	{
+		// Only the resident levels get an image; it is as large as the first of them
+		uint32_t width = std::max(m_Width >> m_ResidentMip, 1u);
+		uint32_t height = std::max(m_Height >> m_ResidentMip, 1u);
+
+		std::vector<VkDeviceSize> levelSizes(m_MipLevels - m_ResidentMip);
+		VkDeviceSize chainSize = 0;
+		for (uint32_t level = 0; level < levelSizes.size(); level++)
+		{
+			levelSizes[level] = GetTextureLevelSize(m_Format, std::max(width >> level, 1u), std::max(height >> level, 1u));
+			chainSize += levelSizes[level];
+		}
+
+		if (data.Size < chainSize)
+		{
+			GX_CORE_ERROR("Texture data for {0} is {1} bytes, its mip chain needs {2}", m_Specification.DebugName, data.Size, chainSize);
+			return;
+		}
+
+		// BC4 stores one channel; spread it so grayscale textures sample as gray, not red
+		VkComponentMapping components{};
+		if (m_Format == TextureFormat::BC4)
+			components = { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_ONE };
+
+		VkExtent3D imageExtent = { width, height, 1 };
+		m_Image = m_Device->CreateImage(data.Data, levelSizes, imageExtent, ConvertFormat(m_Format), VK_IMAGE_USAGE_SAMPLED_BIT, components);
+
+		if (m_Image.Image == VK_NULL_HANDLE)
+			GX_CORE_ERROR("Failed to create Vulkan image for texture: {0}", m_Specification.DebugName);
+	}
+
+	void VulkanTexture2D::SetResidentLevels(Buffer data, uint32_t firstMip)
+	{
+		if (!data || firstMip >= m_MipLevels || m_Image.Image == VK_NULL_HANDLE)
+			return;
+
+		AllocatedImage previousImage = m_Image;
+		uint32_t previousResidentMip = m_ResidentMip;
+
+		m_Image = {};
+		m_ResidentMip = firstMip;
+		CreateVulkanResourcesFromLevels(data);
+		if (m_Image.Image == VK_NULL_HANDLE)
+		{
+			m_Image = previousImage;
+			m_ResidentMip = previousResidentMip;
+			return;
+		}
+
+		// Draws bind the new view from here on; the old image goes once the frames using it finish
+		m_Device->DeferDestroy(previousImage);
+#ifdef GRAVIX_EDITOR_BUILD
+		DestroyImGuiDescriptor();
+#endif
+	}
+
 	void VulkanTexture2D::CreateSampler()
 	{
 		VkSamplerCreateInfo samplerInfo = {};
@@ -140,20 +211,12 @@ namespace Gravix
 
 	void VulkanTexture2D::Cleanup()
 	{
-		// Wait for GPU to finish using this texture before destroying
-		m_Device->WaitIdle();
-
-		if (m_Sampler != VK_NULL_HANDLE)
-		{
-			vkDestroySampler(m_Device->GetDevice(), m_Sampler, nullptr);
-			m_Sampler = VK_NULL_HANDLE;
-		}
+		// Frames still in flight may sample this texture; the device destroys it once they finish
+		m_Device->DeferDestroy(m_Sampler);
+		m_Sampler = VK_NULL_HANDLE;
 
-		if (m_Image.Image != VK_NULL_HANDLE)
-		{
-			m_Device->DestroyImage(m_Image);
-			m_Image = {};
-		}
+		m_Device->DeferDestroy(m_Image);
+		m_Image = {};
 	}
 
 	void VulkanTexture2D::CreateMagentaTexture()
@@ -178,6 +241,18 @@ namespace Gravix
 		CreateFromData(buf, 16, 16, 4);
 	}
 
+	VkFormat VulkanTexture2D::ConvertFormat(TextureFormat format) const
+	{
+		switch (format)
+		{
+		case TextureFormat::RGBA8: return VK_FORMAT_R8G8B8A8_UNORM;
+		case TextureFormat::BC7:   return VK_FORMAT_BC7_UNORM_BLOCK;
+		case TextureFormat::BC5:   return VK_FORMAT_BC5_UNORM_BLOCK;
+		case TextureFormat::BC4:   return VK_FORMAT_BC4_UNORM_BLOCK;
+		default:                   return VK_FORMAT_R8G8B8A8_UNORM;
+		}
+	}
+
 	VkFilter VulkanTexture2D::ConvertFilter(TextureFilter filter) const
 	{
 		switch (filter)
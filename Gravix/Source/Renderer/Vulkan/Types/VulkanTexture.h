@@ -20,6 +20,11 @@ namespace Gravix
 		virtual uint32_t GetWidth() const override { return m_Width; }
 		virtual uint32_t GetHeight() const override { return m_Height; }
 		virtual uint32_t GetMipLevels() const override { return m_MipLevels; }
+		virtual TextureFormat GetFormat() const override { return m_Format; }
+
+		// Inherited from Texture2D
+		virtual uint32_t GetResidentMip() const override { return m_ResidentMip; }
+		virtual void SetResidentLevels(Buffer data, uint32_t firstMip) override;
 
 #ifdef GRAVIX_EDITOR_BUILD
 		virtual void* GetImGuiAttachment() override;
@@ -51,11 +56,13 @@ namespace Gravix
 	private:
 		void CreateFromData(Buffer data, uint32_t width, uint32_t height, uint32_t channels);
 		void CreateVulkanResources(Buffer data, uint32_t dataSize);
+		void CreateVulkanResourcesFromLevels(Buffer data);
 		void CreateSampler();
 		void Cleanup();
 
 		void CreateMagentaTexture();
 
+		VkFormat ConvertFormat(TextureFormat format) const;
 		VkFilter ConvertFilter(TextureFilter filter) const;
 		VkSamplerAddressMode ConvertWrap(TextureWrap wrap) const;
 	private:
@@ -66,6 +73,8 @@ namespace Gravix
 		uint32_t m_Height = 0;
 		uint32_t m_Channels = 0;
 		uint32_t m_MipLevels = 1;
+		uint32_t m_ResidentMip = 0; // The image holds levels [m_ResidentMip, m_MipLevels)
+		TextureFormat m_Format = TextureFormat::RGBA8;
 
 		VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
 
@@ -0,0 +1,106 @@
+#include "pch.h"
+#include "DescriptorStateCache.h"
+
+namespace Gravix
+{
+
+	void DescriptorStateCache::WriteImage(uint32_t set, uint32_t binding, uint32_t arrayIndex, VkImageView imageView, VkSampler sampler, VkImageLayout imageLayout, VkDescriptorType type)
+	{
+		m_Stats.WritesRequested++;
+
+		uint64_t key = MakeKey(set, binding, arrayIndex);
+		SlotState state{ imageView, sampler, imageLayout, type };
+
+		// A later write to the same slot within the frame replaces the queued one
+		auto pendingIt = m_PendingLookup.find(key);
+		if (pendingIt != m_PendingLookup.end())
+		{
+			m_PendingWrites[pendingIt->second].State = state;
+			return;
+		}
+
+		auto writtenIt = m_WrittenSlots.find(key);
+		if (writtenIt != m_WrittenSlots.end() && writtenIt->second == state)
+		{
+			m_Stats.WritesSkipped++;
+			return;
+		}
+
+		m_PendingLookup[key] = m_PendingWrites.size();
+		m_PendingWrites.push_back({ key, state });
+	}
+
+	void DescriptorStateCache::Flush(VkDevice device, const VkDescriptorSet* sets)
+	{
+		m_ImageInfos.clear();
+		m_Writes.clear();
+
+		// Reserve up front so pImageInfo pointers stay valid while building the writes
+		m_ImageInfos.reserve(m_PendingWrites.size());
+		m_Writes.reserve(m_PendingWrites.size());
+
+		for (const PendingWrite& pending : m_PendingWrites)
+		{
+			// Slot may have been written back to its current contents after being queued
+			auto writtenIt = m_WrittenSlots.find(pending.Key);
+			if (writtenIt != m_WrittenSlots.end() && writtenIt->second == pending.State)
+			{
+				m_Stats.WritesSkipped++;
+				continue;
+			}
+
+			VkDescriptorImageInfo& imageInfo = m_ImageInfos.emplace_back();
+			imageInfo.sampler = pending.State.Sampler;
+			imageInfo.imageView = pending.State.ImageView;
+			imageInfo.imageLayout = pending.State.Layout;
+
+			VkWriteDescriptorSet& write = m_Writes.emplace_back();
+			write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			write.dstSet = sets[static_cast<uint32_t>(pending.Key >> 56)];
+			write.dstBinding = static_cast<uint32_t>((pending.Key >> 32) & 0xFFFFFF);
+			write.dstArrayElement = static_cast<uint32_t>(pending.Key & 0xFFFFFFFF);
+			write.descriptorType = pending.State.Type;
+			write.descriptorCount = 1;
+			write.pImageInfo = &imageInfo;
+
+			m_WrittenSlots[pending.Key] = pending.State;
+		}
+
+		if (!m_Writes.empty())
+			vkUpdateDescriptorSets(device, static_cast<uint32_t>(m_Writes.size()), m_Writes.data(), 0, nullptr);
+
+		m_Stats.WritesFlushed = static_cast<uint32_t>(m_Writes.size());
+		m_LastFlushStats = m_Stats;
+		m_Stats = {};
+
+		m_PendingWrites.clear();
+		m_PendingLookup.clear();
+	}
+
+	void DescriptorStateCache::InvalidateImageView(VkImageView imageView)
+	{
+		if (imageView == VK_NULL_HANDLE)
+			return;
+
+		std::erase_if(m_WrittenSlots, [imageView](const auto& slot) { return slot.second.ImageView == imageView; });
+
+		size_t pendingCount = m_PendingWrites.size();
+		std::erase_if(m_PendingWrites, [imageView](const PendingWrite& pending) { return pending.State.ImageView == imageView; });
+
+		if (m_PendingWrites.size() != pendingCount)
+		{
+			m_PendingLookup.clear();
+			for (size_t i = 0; i < m_PendingWrites.size(); i++)
+				m_PendingLookup[m_PendingWrites[i].Key] = i;
+		}
+	}
+
+	void DescriptorStateCache::Reset()
+	{
+		m_WrittenSlots.clear();
+		m_PendingWrites.clear();
+		m_PendingLookup.clear();
+		m_Stats = {};
+	}
+
+}
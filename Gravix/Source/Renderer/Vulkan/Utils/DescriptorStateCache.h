@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace Gravix
+{
+
+	struct DescriptorCacheStats
+	{
+		uint32_t WritesRequested = 0;
+		uint32_t WritesSkipped = 0;
+		uint32_t WritesFlushed = 0;
+	};
+
+	// Shadow copy of what is written into one frame's bindless descriptor sets.
+	// Writes that match the current contents are dropped; the rest are queued
+	// and submitted with a single vkUpdateDescriptorSets call in Flush().
+	class DescriptorStateCache
+	{
+	public:
+		void WriteImage(uint32_t set, uint32_t binding, uint32_t arrayIndex, VkImageView imageView, VkSampler sampler, VkImageLayout imageLayout, VkDescriptorType type);
+
+		void Flush(VkDevice device, const VkDescriptorSet* sets);
+
+		// Vulkan may reuse a destroyed view's handle value, so slots pointing at
+		// a view must be forgotten before that view is destroyed
+		void InvalidateImageView(VkImageView imageView);
+		void Reset();
+
+		bool HasPendingWrites() const { return !m_PendingWrites.empty(); }
+		const DescriptorCacheStats& GetLastFlushStats() const { return m_LastFlushStats; }
+
+	private:
+		struct SlotState
+		{
+			VkImageView ImageView = VK_NULL_HANDLE;
+			VkSampler Sampler = VK_NULL_HANDLE;
+			VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+			VkDescriptorType Type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+
+			bool operator==(const SlotState& other) const
+			{
+				return ImageView == other.ImageView && Sampler == other.Sampler && Layout == other.Layout && Type == other.Type;
+			}
+		};
+
+		struct PendingWrite
+		{
+			uint64_t Key;
+			SlotState State;
+		};
+
+		// set: 8 bits | binding: 24 bits | array index: 32 bits
+		static uint64_t MakeKey(uint32_t set, uint32_t binding, uint32_t arrayIndex)
+		{
+			return (static_cast<uint64_t>(set & 0xFF) << 56) | (static_cast<uint64_t>(binding & 0xFFFFFF) << 32) | arrayIndex;
+		}
+
+	private:
+		std::unordered_map<uint64_t, SlotState> m_WrittenSlots;
+		std::unordered_map<uint64_t, size_t> m_PendingLookup;
+		std::vector<PendingWrite> m_PendingWrites;
+
+		std::vector<VkDescriptorImageInfo> m_ImageInfos;
+		std::vector<VkWriteDescriptorSet> m_Writes;
+
+		DescriptorCacheStats m_Stats;
+		DescriptorCacheStats m_LastFlushStats;
+	};
+
+}
@@ -3,6 +3,7 @@
 
 #include "Core/Log.h"
 #include "Renderer/Vulkan/VulkanRenderCaps.h"
+#include "Renderer/Vulkan/VulkanDevice.h" // For FrameData definition
 
 #include <stdexcept>
 #include <algorithm>
@@ -10,15 +11,15 @@
 namespace Gravix
 {
 
-	VulkanDescriptorSetupResult VulkanDescriptorSetup::Initialize(VkDevice device)
+	VulkanDescriptorSetupResult VulkanDescriptorSetup::Initialize(VkDevice device, FrameData* frames, uint32_t frameCount)
 	{
 		VulkanDescriptorSetupResult result{};
 
 		// Create main descriptor pool
-		result.DescriptorPool = CreateMainDescriptorPool(device);
+		result.DescriptorPool = CreateMainDescriptorPool(device, frameCount);
 
 		// Create bindless descriptor sets and layouts
-		CreateBindlessDescriptorSets(device, result.DescriptorPool, result);
+		CreateBindlessDescriptorSets(device, result.DescriptorPool, result, frames, frameCount);
 
 		// Create ImGui descriptor pool
 		result.ImGuiDescriptorPool = CreateImGuiDescriptorPool(device);
@@ -26,13 +27,13 @@ namespace Gravix
 		return result;
 	}
 
-	VkDescriptorPool VulkanDescriptorSetup::CreateMainDescriptorPool(VkDevice device)
+	VkDescriptorPool VulkanDescriptorSetup::CreateMainDescriptorPool(VkDevice device, uint32_t frameCount)
 	{
-		// Get recommended bindless limits from capabilities
-		uint32_t maxSamplers = VulkanRenderCaps::GetRecommendedBindlessSamplers();
-		uint32_t maxSampledImages = VulkanRenderCaps::GetRecommendedBindlessSampledImages();
-		uint32_t maxStorageImages = VulkanRenderCaps::GetRecommendedBindlessStorageImages();
-		uint32_t maxStorageBuffers = VulkanRenderCaps::GetRecommendedBindlessStorageBuffers();
+		// Get recommended bindless limits from capabilities, one full copy per frame in flight
+		uint32_t maxSamplers = VulkanRenderCaps::GetRecommendedBindlessSamplers() * frameCount;
+		uint32_t maxSampledImages = VulkanRenderCaps::GetRecommendedBindlessSampledImages() * frameCount;
+		uint32_t maxStorageImages = VulkanRenderCaps::GetRecommendedBindlessStorageImages() * frameCount;
+		uint32_t maxStorageBuffers = VulkanRenderCaps::GetRecommendedBindlessStorageBuffers() * frameCount;
 		uint32_t maxUniformBuffers = VulkanRenderCaps::GetMaxDescriptorSetUniformBuffers();
 
 		// Apply reasonable limits for uniform buffers (not typically bindless)
@@ -127,7 +128,7 @@ namespace Gravix
 		return imguiPool;
 	}
 
-	void VulkanDescriptorSetup::CreateBindlessDescriptorSets(VkDevice device, VkDescriptorPool pool, VulkanDescriptorSetupResult& result)
+	void VulkanDescriptorSetup::CreateBindlessDescriptorSets(VkDevice device, VkDescriptorPool pool, VulkanDescriptorSetupResult& result, FrameData* frames, uint32_t frameCount)
 	{
 		// Query max bindless counts
 		uint32_t maxSamplers = VulkanRenderCaps::GetRecommendedBindlessSamplers();
@@ -164,12 +165,17 @@ namespace Gravix
 		allocInfo.descriptorSetCount = 3;
 		allocInfo.pSetLayouts = result.BindlessSetLayouts.data();
 
-		if (vkAllocateDescriptorSets(device, &allocInfo, result.BindlessDescriptorSets) != VK_SUCCESS)
+		// Each frame in flight gets its own copy so a frame can rewrite slots
+		// while the previous frame's command buffer is still executing
+		for (uint32_t i = 0; i < frameCount; i++)
 		{
-			throw std::runtime_error("Failed to allocate bindless descriptor sets!");
+			if (vkAllocateDescriptorSets(device, &allocInfo, frames[i].GlobalDescriptors) != VK_SUCCESS)
+			{
+				throw std::runtime_error("Failed to allocate bindless descriptor sets!");
+			}
 		}
 
-		GX_CORE_INFO("Bindless descriptor sets created with max bindings:");
+		GX_CORE_INFO("Bindless descriptor sets created ({0} frames) with max bindings:", frameCount);
 		GX_CORE_INFO("   Storage Buffers:        {0}", maxStorageBuffers);
 		GX_CORE_INFO("   Combined Image Samplers:{0}", maxCombinedImageSamplers);
 		GX_CORE_INFO("   Storage Images:         {0}", maxStorageImages);
@@ -6,13 +6,14 @@
 namespace Gravix
 {
 
+	struct FrameData; // Forward declaration
+
 	struct VulkanDescriptorSetupResult
 	{
 		VkDescriptorPool DescriptorPool = VK_NULL_HANDLE;
 		VkDescriptorPool ImGuiDescriptorPool = VK_NULL_HANDLE;
 
-		// Bindless descriptor sets and layouts
-		VkDescriptorSet BindlessDescriptorSets[3] = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE };
+		// Bindless descriptor set layouts (the sets themselves are allocated per frame)
 		VkDescriptorSetLayout BindlessStorageBufferLayout = VK_NULL_HANDLE;
 		VkDescriptorSetLayout BindlessCombinedImageSamplerLayout = VK_NULL_HANDLE;
 		VkDescriptorSetLayout BindlessStorageImageLayout = VK_NULL_HANDLE;
@@ -22,12 +23,13 @@ namespace Gravix
 	class VulkanDescriptorSetup
 	{
 	public:
-		static VulkanDescriptorSetupResult Initialize(VkDevice device);
+		// Allocates one copy of the bindless sets per frame in flight into frames[i].GlobalDescriptors
+		static VulkanDescriptorSetupResult Initialize(VkDevice device, FrameData* frames, uint32_t frameCount);
 
 	private:
-		static VkDescriptorPool CreateMainDescriptorPool(VkDevice device);
+		static VkDescriptorPool CreateMainDescriptorPool(VkDevice device, uint32_t frameCount);
 		static VkDescriptorPool CreateImGuiDescriptorPool(VkDevice device);
-		static void CreateBindlessDescriptorSets(VkDevice device, VkDescriptorPool pool, VulkanDescriptorSetupResult& result);
+		static void CreateBindlessDescriptorSets(VkDevice device, VkDescriptorPool pool, VulkanDescriptorSetupResult& result, FrameData* frames, uint32_t frameCount);
 		static void CreateBindlessLayout(VkDevice device, VkDescriptorType type, uint32_t count, VkShaderStageFlags stages, VkDescriptorSetLayout* layout);
 	};
 
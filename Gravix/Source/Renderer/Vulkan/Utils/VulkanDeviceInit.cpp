@@ -73,6 +73,7 @@ namespace Gravix
 		features.sampleRateShading = true;
 		features.independentBlend = true;
 		features.wideLines = true;
+		features.textureCompressionBC = true; // Cooked textures are BC4/BC5/BC7
 
 		// Select physical device
 		vkb::PhysicalDeviceSelector selector{ instRet.value() };
@@ -90,6 +91,11 @@ namespace Gravix
 			.select()
 			.value();
 
+#ifdef GX_PROFILE
+		// Optional: lets the GPU profiler correlate GPU and CPU clocks every frame
+		result.CalibratedTimestamps = physicalDevice.enable_extension_if_present(VK_KHR_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+#endif
+
 		// Create logical device
 		vkb::DeviceBuilder deviceBuilder{ physicalDevice };
 		vkb::Device vkbDevice = deviceBuilder.build().value();
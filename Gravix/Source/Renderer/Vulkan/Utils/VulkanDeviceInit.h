@@ -20,6 +20,7 @@ namespace Gravix
 		uint32_t GraphicsQueueFamilyIndex = 0;
 		VkQueue TransferQueue = VK_NULL_HANDLE;
 		uint32_t TransferQueueFamilyIndex = 0;
+		bool CalibratedTimestamps = false;
 	};
 
 	class VulkanDeviceInit
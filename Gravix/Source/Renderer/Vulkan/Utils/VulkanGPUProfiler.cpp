@@ -0,0 +1,299 @@
+#include "pch.h"
+#include "VulkanGPUProfiler.h"
+
+#include "Renderer/Vulkan/VulkanDevice.h"
+#include "VulkanUtils.h"
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace Gravix
+{
+
+	// Same clock InstrumentationTimer uses, so GPU and CPU events share one timeline
+	static long long GetCPUTimeNanoseconds()
+	{
+		auto now = std::chrono::high_resolution_clock::now();
+		return std::chrono::time_point_cast<std::chrono::nanoseconds>(now).time_since_epoch().count();
+	}
+
+	// Host clock that vkGetCalibratedTimestampsKHR samples together with the GPU clock
+#ifdef ENGINE_PLATFORM_WINDOWS
+	static constexpr VkTimeDomainKHR HostTimeDomain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_KHR;
+
+	static long long HostTicksToNanoseconds(uint64_t ticks)
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		uint64_t perSecond = static_cast<uint64_t>(frequency.QuadPart);
+		return static_cast<long long>(ticks / perSecond * 1000000000ull + ticks % perSecond * 1000000000ull / perSecond);
+	}
+
+	static uint64_t ReadHostTicks()
+	{
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		return static_cast<uint64_t>(counter.QuadPart);
+	}
+#else
+	static constexpr VkTimeDomainKHR HostTimeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_KHR;
+
+	static long long HostTicksToNanoseconds(uint64_t ticks)
+	{
+		return static_cast<long long>(ticks);
+	}
+
+	static uint64_t ReadHostTicks()
+	{
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+	}
+#endif
+
+	void VulkanGPUProfiler::Init(VulkanDevice* device, uint32_t queueFamilyIndex, bool calibratedTimestamps)
+	{
+		m_Device = device;
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(device->GetPhysicalDevice(), &properties);
+
+		uint32_t queueFamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(device->GetPhysicalDevice(), &queueFamilyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(device->GetPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+
+		m_TimestampValidBits = queueFamilyIndex < queueFamilyCount ? queueFamilies[queueFamilyIndex].timestampValidBits : 0;
+		m_TimestampPeriod = properties.limits.timestampPeriod;
+
+		if (m_TimestampValidBits == 0 || m_TimestampPeriod <= 0.0)
+		{
+			GX_CORE_WARN("GPU timestamps are not supported on the graphics queue, GPU profiling disabled");
+			return;
+		}
+
+		VkQueryPoolCreateInfo poolInfo{ .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+		poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		poolInfo.queryCount = MAX_QUERIES_PER_FRAME;
+
+		for (FrameQueries& frame : m_Frames)
+		{
+			VK_CHECK(vkCreateQueryPool(device->GetDevice(), &poolInfo, nullptr, &frame.Pool));
+			frame.Scopes.reserve(MAX_QUERIES_PER_FRAME / 2);
+		}
+
+		if (calibratedTimestamps)
+		{
+			auto getTimeDomains = (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR)vkGetInstanceProcAddr(device->GetInstance(), "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
+			auto getTimestamps = (PFN_vkGetCalibratedTimestampsKHR)vkGetDeviceProcAddr(device->GetDevice(), "vkGetCalibratedTimestampsKHR");
+
+			if (getTimeDomains && getTimestamps)
+			{
+				uint32_t domainCount = 0;
+				getTimeDomains(device->GetPhysicalDevice(), &domainCount, nullptr);
+				std::vector<VkTimeDomainKHR> domains(domainCount);
+				getTimeDomains(device->GetPhysicalDevice(), &domainCount, domains.data());
+
+				// The GPU clock is only useful paired with a host clock read in the same call
+				if (std::find(domains.begin(), domains.end(), VK_TIME_DOMAIN_DEVICE_KHR) != domains.end()
+					&& std::find(domains.begin(), domains.end(), HostTimeDomain) != domains.end())
+					m_GetCalibratedTimestamps = getTimestamps;
+			}
+		}
+
+		m_Enabled = true;
+		Calibrate();
+
+		GX_CORE_INFO("GPU profiler initialized ({} timestamp bits, {:.3f} ns/tick, {} clock calibration)",
+			m_TimestampValidBits, m_TimestampPeriod, m_GetCalibratedTimestamps ? "per-frame" : "one-time");
+	}
+
+	void VulkanGPUProfiler::Shutdown()
+	{
+		for (FrameQueries& frame : m_Frames)
+		{
+			if (frame.Pool != VK_NULL_HANDLE)
+			{
+				vkDestroyQueryPool(m_Device->GetDevice(), frame.Pool, nullptr);
+				frame.Pool = VK_NULL_HANDLE;
+			}
+		}
+
+		m_Enabled = false;
+	}
+
+	void VulkanGPUProfiler::Calibrate()
+	{
+		if (m_GetCalibratedTimestamps)
+		{
+			// The driver samples the GPU and host clocks together
+			VkCalibratedTimestampInfoKHR timestampInfos[2]{};
+			timestampInfos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR;
+			timestampInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_KHR;
+			timestampInfos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR;
+			timestampInfos[1].timeDomain = HostTimeDomain;
+
+			uint64_t timestamps[2] = {};
+			uint64_t maxDeviation = 0;
+
+			VkResult result = m_GetCalibratedTimestamps(m_Device->GetDevice(), 2, timestampInfos, timestamps, &maxDeviation);
+			if (result == VK_SUCCESS)
+			{
+				// The host clock is not the Instrumentor's, so map it over with two back to back reads
+				m_HostToCPUOffset = GetCPUTimeNanoseconds() - HostTicksToNanoseconds(ReadHostTicks());
+
+				m_CalibrationGPUTicks = timestamps[0];
+				m_CalibrationCPUTime = HostTicksToNanoseconds(timestamps[1]) + m_HostToCPUOffset;
+				return;
+			}
+		}
+
+		// Fallback (e.g. lavapipe): write a timestamp on the queue and take the midpoint
+		// of the submission as its CPU time. Only done once, so slow clock drift is not corrected.
+		uint64_t gpuTicks = 0;
+		long long before = GetCPUTimeNanoseconds();
+		m_Device->ImmediateSubmit([&](VkCommandBuffer cmd)
+			{
+				vkCmdResetQueryPool(cmd, m_Frames[0].Pool, 0, 1);
+				vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, m_Frames[0].Pool, 0);
+			});
+		long long after = GetCPUTimeNanoseconds();
+
+		VkResult result = vkGetQueryPoolResults(m_Device->GetDevice(), m_Frames[0].Pool, 0, 1, sizeof(uint64_t), &gpuTicks, sizeof(uint64_t),
+			VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+		if (result != VK_SUCCESS)
+		{
+			GX_CORE_WARN("Failed to calibrate GPU timestamps, GPU profiling disabled");
+			m_Enabled = false;
+			return;
+		}
+
+		m_CalibrationGPUTicks = gpuTicks;
+		m_CalibrationCPUTime = before + (after - before) / 2;
+	}
+
+	long long VulkanGPUProfiler::ToCPUTime(uint64_t gpuTicks) const
+	{
+		// Signed tick delta, sign-extended when the counter has fewer than 64 valid bits
+		int64_t delta = static_cast<int64_t>(gpuTicks - m_CalibrationGPUTicks);
+		if (m_TimestampValidBits < 64)
+		{
+			uint32_t shift = 64 - m_TimestampValidBits;
+			delta = static_cast<int64_t>(static_cast<uint64_t>(delta) << shift) >> shift;
+		}
+
+		long long nanoseconds = m_CalibrationCPUTime + static_cast<long long>(static_cast<double>(delta) * m_TimestampPeriod);
+		return nanoseconds / 1000;
+	}
+
+	void VulkanGPUProfiler::ResolveFrame(uint32_t frameIndex)
+	{
+		if (!m_Enabled)
+			return;
+
+		GX_PROFILE_FUNCTION();
+
+		FrameQueries& frame = m_Frames[frameIndex];
+		if (frame.QueryCount == 0)
+			return;
+
+		// Each query returns its value followed by an availability word
+		m_QueryResults.resize(frame.QueryCount * 2);
+		vkGetQueryPoolResults(m_Device->GetDevice(), frame.Pool, 0, frame.QueryCount, m_QueryResults.size() * sizeof(uint64_t), m_QueryResults.data(),
+			2 * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+		if (m_GetCalibratedTimestamps)
+			Calibrate();
+
+		for (const GPUScope& scope : frame.Scopes)
+		{
+			if (scope.EndQuery == INVALID_SCOPE)
+				continue;
+
+			bool available = m_QueryResults[scope.BeginQuery * 2 + 1] != 0 && m_QueryResults[scope.EndQuery * 2 + 1] != 0;
+			if (!available)
+				continue;
+
+			long long start = ToCPUTime(m_QueryResults[scope.BeginQuery * 2]);
+			long long end = ToCPUTime(m_QueryResults[scope.EndQuery * 2]);
+
+			Instrumentor::Get().WriteProfile({ scope.Name, start, std::max(start, end), 0, ProfileTrack::GPU });
+		}
+
+		frame.Scopes.clear();
+		frame.QueryCount = 0;
+	}
+
+	void VulkanGPUProfiler::BeginFrame(VkCommandBuffer cmd, uint32_t frameIndex)
+	{
+		if (!m_Enabled)
+			return;
+
+		m_ActiveFrame = &m_Frames[frameIndex];
+		m_ActiveFrame->Scopes.clear();
+		m_ActiveFrame->QueryCount = 0;
+		m_OpenScopes.clear();
+		m_ReservedEndQueries = 0;
+
+		// Queries must be reset outside of a render pass before they are written
+		vkCmdResetQueryPool(cmd, m_ActiveFrame->Pool, 0, MAX_QUERIES_PER_FRAME);
+
+		BeginScope(cmd, "GPU Frame");
+	}
+
+	void VulkanGPUProfiler::EndFrame(VkCommandBuffer cmd)
+	{
+		if (!m_Enabled || m_ActiveFrame == nullptr)
+			return;
+
+		// Close anything left open, including the "GPU Frame" scope
+		while (!m_OpenScopes.empty())
+			EndScope(cmd);
+
+		m_ActiveFrame = nullptr;
+	}
+
+	void VulkanGPUProfiler::BeginScope(VkCommandBuffer cmd, const char* name)
+	{
+		if (m_ActiveFrame == nullptr)
+			return;
+
+		// Room for this scope's two queries on top of the end queries still owed to the open
+		// ones (always at least "GPU Frame"); scopes past the limit are dropped
+		if (m_ActiveFrame->QueryCount + m_ReservedEndQueries + 2 > MAX_QUERIES_PER_FRAME)
+		{
+			m_OpenScopes.push_back(INVALID_SCOPE);
+			return;
+		}
+
+		uint32_t query = m_ActiveFrame->QueryCount++;
+		vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, m_ActiveFrame->Pool, query);
+		m_ReservedEndQueries++;
+
+		m_OpenScopes.push_back(static_cast<uint32_t>(m_ActiveFrame->Scopes.size()));
+		m_ActiveFrame->Scopes.push_back({ name, query, INVALID_SCOPE });
+	}
+
+	void VulkanGPUProfiler::EndScope(VkCommandBuffer cmd)
+	{
+		if (m_ActiveFrame == nullptr || m_OpenScopes.empty())
+			return;
+
+		uint32_t scopeIndex = m_OpenScopes.back();
+		m_OpenScopes.pop_back();
+
+		if (scopeIndex == INVALID_SCOPE)
+			return;
+
+		m_ReservedEndQueries--;
+		uint32_t query = m_ActiveFrame->QueryCount++;
+		vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, m_ActiveFrame->Pool, query);
+
+		m_ActiveFrame->Scopes[scopeIndex].EndQuery = query;
+	}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Renderer/Generic/Device.h"
+
+#include <vulkan/vulkan.h>
+
+#include <vector>
+
+namespace Gravix
+{
+
+	class VulkanDevice;
+
+	// Scoped GPU timing backed by one timestamp query pool per frame in flight.
+	// A frame slot's queries are resolved right after StartFrame has waited on that
+	// slot's fence, converted into the Instrumentor's clock and written to the GPU track.
+	class VulkanGPUProfiler
+	{
+	public:
+		void Init(VulkanDevice* device, uint32_t queueFamilyIndex, bool calibratedTimestamps);
+		void Shutdown();
+
+		// Must be called after the slot's fence has been waited on
+		void ResolveFrame(uint32_t frameIndex);
+
+		void BeginFrame(VkCommandBuffer cmd, uint32_t frameIndex);
+		void EndFrame(VkCommandBuffer cmd);
+
+		// The name is read back frames later, so it must be a string literal
+		void BeginScope(VkCommandBuffer cmd, const char* name);
+		void EndScope(VkCommandBuffer cmd);
+
+		bool IsEnabled() const { return m_Enabled; }
+	private:
+		void Calibrate();
+		long long ToCPUTime(uint64_t gpuTicks) const;
+	private:
+		static constexpr uint32_t MAX_QUERIES_PER_FRAME = 512;
+		static constexpr uint32_t INVALID_SCOPE = ~0u;
+
+		struct GPUScope
+		{
+			const char* Name;
+			uint32_t BeginQuery;
+			uint32_t EndQuery;
+		};
+
+		struct FrameQueries
+		{
+			VkQueryPool Pool = VK_NULL_HANDLE;
+			std::vector<GPUScope> Scopes;
+			uint32_t QueryCount = 0;
+		};
+
+		VulkanDevice* m_Device = nullptr;
+		FrameQueries m_Frames[FRAME_OVERLAP];
+		FrameQueries* m_ActiveFrame = nullptr;
+		std::vector<uint32_t> m_OpenScopes;
+		uint32_t m_ReservedEndQueries = 0; // One per open scope that was given a begin query
+		std::vector<uint64_t> m_QueryResults;
+
+		bool m_Enabled = false;
+		double m_TimestampPeriod = 1.0; // nanoseconds per tick
+		uint32_t m_TimestampValidBits = 64;
+
+		// Without VK_KHR_calibrated_timestamps the clocks are correlated once at startup
+		PFN_vkGetCalibratedTimestampsKHR m_GetCalibratedTimestamps = nullptr;
+		uint64_t m_CalibrationGPUTicks = 0;
+		long long m_CalibrationCPUTime = 0; // nanoseconds, Instrumentor clock
+		long long m_HostToCPUOffset = 0;    // Instrumentor clock minus the calibrated host domain, nanoseconds
+	};
+
+}
@@ -143,7 +143,9 @@ namespace Gravix
 		ImDrawData* drawData = ImGui::GetDrawData();
 		if (drawData && drawData->TotalVtxCount > 0)
 		{
+			BeginGPUScope("ImGui");
 			ImGui_ImplVulkan_RenderDrawData(drawData, m_CommandBuffer);
+			EndGPUScope();
 		}
 	}
 #endif
@@ -184,6 +186,8 @@ namespace Gravix
 		if (m_TargetFramebuffer == nullptr)
 			return;
 
+		BeginGPUScope("CopyToSwapchain");
+
 		m_TargetFramebuffer->TransitionToLayout(m_CommandBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
 		VkImageLayout swapchainImageLayout = m_Device->GetCurrentSwapchainImageLayout();
@@ -195,6 +199,8 @@ namespace Gravix
 		VulkanUtils::TransitionImage(m_CommandBuffer, m_Device->GetCurrentSwapchainImage(), m_Device->GetSwapchainImageFormat(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, swapchainImageLayout);
 
 		m_TargetFramebuffer->TransitionToLayout(m_CommandBuffer, VK_IMAGE_LAYOUT_GENERAL);
+
+		EndGPUScope();
 	}
 
 }
\ No newline at end of file
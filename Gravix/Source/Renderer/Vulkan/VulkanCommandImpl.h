@@ -42,6 +42,14 @@ namespace Gravix
 		virtual void ResolveFramebuffer(Framebuffer* dst, bool shaderUse) override;
 
 		virtual void CopyToSwapchain() override;
+
+#ifdef GX_PROFILE
+		virtual void BeginGPUScope(const char* name) override { m_Device->GetGPUProfiler().BeginScope(m_CommandBuffer, name); }
+		virtual void EndGPUScope() override { m_Device->GetGPUProfiler().EndScope(m_CommandBuffer); }
+#else
+		virtual void BeginGPUScope(const char* name) override {}
+		virtual void EndGPUScope() override {}
+#endif
 	private:
 		VulkanDevice* m_Device;
 		VkCommandBuffer m_CommandBuffer;
@@ -12,6 +12,11 @@
 
 #include <VkBootstrap.h>
 
+#ifdef GRAVIX_EDITOR_BUILD
+#include <imgui.h>
+#include <backends/imgui_impl_vulkan.h>
+#endif
+
 #define VMA_IMPLEMENTATION
 #include <vk_mem_alloc.h>
 
@@ -48,15 +53,18 @@ namespace Gravix
 		m_ImmediateFence = immediateSetup.ImmediateFence;
 
 		// Initialize descriptor pools and bindless sets
-		auto descriptorSetup = VulkanDescriptorSetup::Initialize(m_Device);
+		auto descriptorSetup = VulkanDescriptorSetup::Initialize(m_Device, m_Frames, FRAME_OVERLAP);
 		m_DescriptorPool = descriptorSetup.DescriptorPool;
 		m_ImGuiDescriptorPool = descriptorSetup.ImGuiDescriptorPool;
-		std::copy(std::begin(descriptorSetup.BindlessDescriptorSets), std::end(descriptorSetup.BindlessDescriptorSets), std::begin(m_BindlessDescriptorSets));
 		m_BindlessStorageBufferLayout = descriptorSetup.BindlessStorageBufferLayout;
 		m_BindlessCombinedImageSamplerLayout = descriptorSetup.BindlessCombinedImageSamplerLayout;
 		m_BindlessStorageImageLayout = descriptorSetup.BindlessStorageImageLayout;
 		m_BindlessSetLayouts = descriptorSetup.BindlessSetLayouts;
 
+#ifdef GX_PROFILE
+		m_GPUProfiler.Init(this, m_GraphicsQueueFamilyIndex, deviceInit.CalibratedTimestamps);
+#endif
+
 #ifdef GRAVIX_EDITOR_BUILD
 		m_ShaderCompiler = CreateRef<ShaderCompiler>();
 #endif
@@ -74,8 +82,16 @@ namespace Gravix
 			vkDeviceWaitIdle(m_Device);
 		}
 
+		// Nothing is in flight any more; drop these while the allocator still exists
+		ReleaseAllResources();
+		DestroyAllPending();
+
 		m_Swapchain.reset();
 
+#ifdef GX_PROFILE
+		m_GPUProfiler.Shutdown();
+#endif
+
 		// Clean up per-frame resources
 		for (uint32_t i = 0; i < FRAME_OVERLAP; i++)
 		{
@@ -185,6 +201,18 @@ namespace Gravix
 			vkWaitForFences(m_Device, 1, &GetCurrentFrameData().RenderFence, true, UINT64_MAX);
 		}
 
+#ifdef GX_PROFILE
+		// This slot's previous submission is complete, so its timestamps can be read
+		m_GPUProfiler.ResolveFrame(GetCurrentFrameIndex());
+#endif
+
+		// ...and everything released while it (or any earlier frame) was recorded can go
+		if (m_CurrentFrame >= FRAME_OVERLAP)
+		{
+			ReleaseCompletedResources(m_CurrentFrame - FRAME_OVERLAP);
+			DestroyCompletedResources(m_CurrentFrame - FRAME_OVERLAP);
+		}
+
 		// Skip rendering if window is minimized (zero dimensions)
 		uint32_t width = Application::Get().GetWindow().GetWidth();
 		uint32_t height = Application::Get().GetWindow().GetHeight();
@@ -232,6 +260,10 @@ namespace Gravix
 				GetSwapchainImageFormat(), m_SwapchainImageLayout, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
 			m_SwapchainImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+#ifdef GX_PROFILE
+			m_GPUProfiler.BeginFrame(GetCurrentFrameData().CommandBuffer, GetCurrentFrameIndex());
+#endif
 		}
 
 		m_FrameStarted = true;
@@ -241,6 +273,14 @@ namespace Gravix
 	{
 		GX_PROFILE_FUNCTION();
 
+		{
+			GX_PROFILE_SCOPE("FlushDescriptorWrites");
+			// Bindless sets are update-after-bind, so this frame's batched writes
+			// only have to land before the command buffer is submitted
+			FrameData& frame = GetCurrentFrameData();
+			frame.DescriptorCache.Flush(m_Device, frame.GlobalDescriptors);
+		}
+
 		// Only submit and present if we successfully started the frame
 		if (m_FrameStarted)
 		{
@@ -253,6 +293,10 @@ namespace Gravix
 					m_SwapchainImageLayout, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 				m_SwapchainImageLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
+#ifdef GX_PROFILE
+				m_GPUProfiler.EndFrame(GetCurrentFrameData().CommandBuffer);
+#endif
+
 				//end the command buffer recording
 				vkEndCommandBuffer(GetCurrentFrameData().CommandBuffer);
 			}
@@ -296,6 +340,7 @@ namespace Gravix
 
 		//always increase the number of frames drawn, even if we skipped rendering
 		m_CurrentFrame++;
+		m_ReleaseFrame = m_CurrentFrame;
 	}
 
 	void VulkanDevice::WaitIdle()
@@ -303,6 +348,113 @@ namespace Gravix
 		vkDeviceWaitIdle(m_Device);
 	}
 
+	void VulkanDevice::DestroyImage(const AllocatedImage& img)
+	{
+		// Drop cached descriptor state for this view in every frame so a new view
+		// that happens to reuse the handle value is not treated as already written
+		for (uint32_t i = 0; i < FRAME_OVERLAP; i++)
+			m_Frames[i].DescriptorCache.InvalidateImageView(img.ImageView);
+
+		vkDestroyImageView(m_Device, img.ImageView, nullptr);
+		vmaDestroyImage(m_Allocator, img.Image, img.Allocation);
+	}
+
+	void VulkanDevice::DeferDestroy(const AllocatedImage& image)
+	{
+		if (image.Image != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_IMAGE, (uint64_t)image.Image, image.ImageView, image.Allocation);
+	}
+
+	void VulkanDevice::DeferDestroy(const AllocatedBuffer& buffer)
+	{
+		if (buffer.Buffer != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_BUFFER, (uint64_t)buffer.Buffer, VK_NULL_HANDLE, buffer.Allocation);
+	}
+
+	void VulkanDevice::DeferDestroy(VkSampler sampler)
+	{
+		if (sampler != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_SAMPLER, (uint64_t)sampler);
+	}
+
+	void VulkanDevice::DeferDestroy(VkPipeline pipeline)
+	{
+		if (pipeline != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_PIPELINE, (uint64_t)pipeline);
+	}
+
+	void VulkanDevice::DeferDestroy(VkPipelineLayout pipelineLayout)
+	{
+		if (pipelineLayout != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_PIPELINE_LAYOUT, (uint64_t)pipelineLayout);
+	}
+
+	void VulkanDevice::DeferDestroy(VkShaderModule shaderModule)
+	{
+		if (shaderModule != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_SHADER_MODULE, (uint64_t)shaderModule);
+	}
+
+#ifdef GRAVIX_EDITOR_BUILD
+	void VulkanDevice::DeferRemoveImGuiTexture(VkDescriptorSet descriptorSet)
+	{
+		if (descriptorSet != VK_NULL_HANDLE)
+			QueueDestroy(VK_OBJECT_TYPE_DESCRIPTOR_SET, (uint64_t)descriptorSet);
+	}
+#endif
+
+	void VulkanDevice::QueueDestroy(VkObjectType type, uint64_t handle, VkImageView imageView, VmaAllocation allocation)
+	{
+		m_PendingDestroys.push_back({ m_ReleaseFrame, type, handle, imageView, allocation });
+	}
+
+	void VulkanDevice::DestroyCompletedResources(uint64_t completedFrame)
+	{
+		while (!m_PendingDestroys.empty() && m_PendingDestroys.front().Frame <= completedFrame)
+		{
+			PendingDestroy pending = m_PendingDestroys.front();
+			m_PendingDestroys.pop_front();
+
+			switch (pending.Type)
+			{
+			case VK_OBJECT_TYPE_IMAGE:
+			{
+				AllocatedImage image{};
+				image.Image = (VkImage)pending.Handle;
+				image.ImageView = pending.ImageView;
+				image.Allocation = pending.Allocation;
+				DestroyImage(image);
+				break;
+			}
+			case VK_OBJECT_TYPE_BUFFER:
+				vmaDestroyBuffer(m_Allocator, (VkBuffer)pending.Handle, pending.Allocation);
+				break;
+			case VK_OBJECT_TYPE_SAMPLER:
+				vkDestroySampler(m_Device, (VkSampler)pending.Handle, nullptr);
+				break;
+			case VK_OBJECT_TYPE_PIPELINE:
+				vkDestroyPipeline(m_Device, (VkPipeline)pending.Handle, nullptr);
+				break;
+			case VK_OBJECT_TYPE_PIPELINE_LAYOUT:
+				vkDestroyPipelineLayout(m_Device, (VkPipelineLayout)pending.Handle, nullptr);
+				break;
+			case VK_OBJECT_TYPE_SHADER_MODULE:
+				vkDestroyShaderModule(m_Device, (VkShaderModule)pending.Handle, nullptr);
+				break;
+#ifdef GRAVIX_EDITOR_BUILD
+			case VK_OBJECT_TYPE_DESCRIPTOR_SET:
+				// The backend frees its pool on shutdown, taking any set still queued with it
+				if (ImGui::GetCurrentContext())
+					ImGui_ImplVulkan_RemoveTexture((VkDescriptorSet)pending.Handle);
+				break;
+#endif
+			default:
+				GX_VERIFY("Unhandled deferred Vulkan object type");
+				break;
+			}
+		}
+	}
+
 	AllocatedImage VulkanDevice::CreateImage(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool useSamples /*= false*/, bool mipmapped /*= false*/)
 	{
 		AllocatedImage newImage;
@@ -381,6 +533,63 @@ namespace Gravix
 		return newImage;
 	}
 
+	AllocatedImage VulkanDevice::CreateImage(const void* levels, const std::vector<VkDeviceSize>& levelSizes, VkExtent3D size, VkFormat format,
+		VkImageUsageFlags usage, const VkComponentMapping& components /*= {}*/)
+	{
+		VkDeviceSize dataSize = 0;
+		for (VkDeviceSize levelSize : levelSizes)
+			dataSize += levelSize;
+
+		AllocatedBuffer uploadbuffer = CreateBuffer(dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU);
+		memcpy(uploadbuffer.Info.pMappedData, levels, dataSize);
+
+		AllocatedImage newImage;
+		newImage.ImageFormat = format;
+		newImage.ImageExtent = size;
+
+		VkImageCreateInfo imgInfo = VulkanInitializers::ImageCreateInfo(format, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_SAMPLE_COUNT_1_BIT, size);
+		imgInfo.mipLevels = static_cast<uint32_t>(levelSizes.size());
+
+		VmaAllocationCreateInfo allocinfo{};
+		allocinfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+		allocinfo.requiredFlags = VkMemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		vmaCreateImage(m_Allocator, &imgInfo, &allocinfo, &newImage.Image, &newImage.Allocation, nullptr);
+
+		VkImageViewCreateInfo viewInfo = VulkanInitializers::ImageViewCreateInfo(format, newImage.Image, VK_IMAGE_ASPECT_COLOR_BIT);
+		viewInfo.subresourceRange.levelCount = imgInfo.mipLevels;
+		viewInfo.components = components;
+		vkCreateImageView(m_Device, &viewInfo, nullptr, &newImage.ImageView);
+
+		// One copy per level; block formats may end in partial blocks, which Vulkan allows at the image edge
+		std::vector<VkBufferImageCopy> copyRegions(levelSizes.size());
+		VkDeviceSize offset = 0;
+		for (uint32_t mip = 0; mip < copyRegions.size(); mip++)
+		{
+			VkBufferImageCopy& copyRegion = copyRegions[mip];
+			copyRegion.bufferOffset = offset;
+			copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			copyRegion.imageSubresource.mipLevel = mip;
+			copyRegion.imageSubresource.layerCount = 1;
+			copyRegion.imageExtent = { std::max(size.width >> mip, 1u), std::max(size.height >> mip, 1u), 1 };
+			offset += levelSizes[mip];
+		}
+
+		ImmediateSubmit([&](VkCommandBuffer cmd) {
+			VulkanUtils::TransitionImage(cmd, newImage.Image, newImage.ImageFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+			vkCmdCopyBufferToImage(cmd, uploadbuffer.Buffer, newImage.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				static_cast<uint32_t>(copyRegions.size()), copyRegions.data());
+
+			VulkanUtils::TransitionImage(cmd, newImage.Image, newImage.ImageFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			});
+
+		DestroyBuffer(uploadbuffer);
+		newImage.ImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+		return newImage;
+	}
+
 	AllocatedBuffer VulkanDevice::CreateBuffer(size_t allocSize, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage)
 	{
 		VkBufferCreateInfo bufferInfo = { .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
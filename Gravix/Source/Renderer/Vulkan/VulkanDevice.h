@@ -7,6 +7,8 @@
 #endif
 
 #include "Utils/VulkanTypes.h"
+#include "Utils/DescriptorStateCache.h"
+#include "Utils/VulkanGPUProfiler.h"
 #ifdef GRAVIX_EDITOR_BUILD
 #include "Utils/ShaderCompiler.h"
 #endif
@@ -25,7 +27,10 @@ namespace Gravix
 
 		VkFence RenderFence;
 		VkSemaphore SwapchainSemaphore;  // Per-frame: signaled by acquire, waited by submit
-		VkDescriptorSet GlobalDescriptor = VK_NULL_HANDLE;  // Global descriptor set for this frame
+
+		// Bindless sets for this frame (0: storage buffers, 1: combined image samplers, 2: storage images)
+		VkDescriptorSet GlobalDescriptors[3] = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE };
+		DescriptorStateCache DescriptorCache;
 	};
 
 
@@ -47,11 +52,32 @@ namespace Gravix
 
 		AllocatedImage CreateImage(VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool useSamples = false, bool mipmapped = false);
 		AllocatedImage CreateImage(void* data, VkExtent3D size, VkFormat format, VkImageUsageFlags usage, bool mipmapped = false);
-		void DestroyImage(const AllocatedImage& img) { vkDestroyImageView(m_Device, img.ImageView, nullptr); vmaDestroyImage(m_Allocator, img.Image, img.Allocation); }
+		// Uploads a prebuilt mip chain (levels tightly packed, largest first) in any format, block compressed included
+		AllocatedImage CreateImage(const void* levels, const std::vector<VkDeviceSize>& levelSizes, VkExtent3D size, VkFormat format,
+			VkImageUsageFlags usage, const VkComponentMapping& components = {});
+		void DestroyImage(const AllocatedImage& img);
 
 		AllocatedBuffer CreateBuffer(size_t allocSize, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage);
 		void DestroyBuffer(const AllocatedBuffer& buffer) { vmaDestroyBuffer(m_Allocator, buffer.Buffer, buffer.Allocation); }
 
+		// Destroy the object once every frame that may have recorded it has finished on the GPU.
+		// Resource destructors and anything replacing a resource in use go through these rather
+		// than destroying directly or waiting for the device to go idle. Main thread only.
+		void DeferDestroy(const AllocatedImage& image);
+		void DeferDestroy(const AllocatedBuffer& buffer);
+		void DeferDestroy(VkSampler sampler);
+		void DeferDestroy(VkPipeline pipeline);
+		void DeferDestroy(VkPipelineLayout pipelineLayout);
+		void DeferDestroy(VkShaderModule shaderModule);
+#ifdef GRAVIX_EDITOR_BUILD
+		// For descriptor sets from ImGui_ImplVulkan_AddTexture
+		void DeferRemoveImGuiTexture(VkDescriptorSet descriptorSet);
+#endif
+		size_t GetPendingDestroyCount() const { return m_PendingDestroys.size(); }
+
+		// Destroys everything queued without looking at fences; only once the device is idle
+		void DestroyAllPending() { DestroyCompletedResources(UINT64_MAX); }
+
 		void ImmediateSubmit(std::function<void(VkCommandBuffer cmd)>&& function);
 
 		VkInstance GetInstance() const { return m_Instance; }
@@ -59,8 +85,10 @@ namespace Gravix
 		VkPhysicalDevice GetPhysicalDevice() const { return m_PhysicalDevice; }
 		VkQueue GetGraphicsQueue() const { return m_GraphicsQueue; }
 
-		VkDescriptorSet* GetGlobalDescriptorSets() { return m_BindlessDescriptorSets; }
-		VkDescriptorSet GetGlobalDescriptorSet(uint32_t index) const { return m_BindlessDescriptorSets[index]; }
+		VkDescriptorSet* GetGlobalDescriptorSets() { return GetCurrentFrameData().GlobalDescriptors; }
+		VkDescriptorSet GetGlobalDescriptorSet(uint32_t index) const { return m_Frames[m_CurrentFrame % FRAME_OVERLAP].GlobalDescriptors[index]; }
+		DescriptorStateCache& GetDescriptorCache() { return GetCurrentFrameData().DescriptorCache; }
+		VulkanGPUProfiler& GetGPUProfiler() { return m_GPUProfiler; }
 		std::vector<VkDescriptorSetLayout>& GetGlobalDescriptorSetLayouts() { return m_BindlessSetLayouts; }
 		VkDescriptorSetLayout GetGlobalDescriptorSetLayout() const { return m_BindlessSetLayouts.empty() ? VK_NULL_HANDLE : m_BindlessSetLayouts[0]; }
 		VkDescriptorPool GetGlobalDescriptorPool() const { return m_DescriptorPool; }
@@ -76,11 +104,27 @@ namespace Gravix
 		VulkanSwapchain* GetSwapchain() { return m_Swapchain.get(); }
 
 		FrameData& GetCurrentFrameData() { return m_Frames[m_CurrentFrame % FRAME_OVERLAP]; }
+		uint32_t GetCurrentFrameIndex() const { return m_CurrentFrame % FRAME_OVERLAP; }
+		bool IsFrameStarted() const { return m_FrameStarted; }
 		FrameData& GetCurrentFrame() { return GetCurrentFrameData(); }  // Alias for compatibility
 		VmaAllocator& GetAllocator() { return m_Allocator; }
 
 		VkSampler GetLinearSampler() const { return VK_NULL_HANDLE; }  // TODO: Create and store sampler
 	private:
+		void QueueDestroy(VkObjectType type, uint64_t handle, VkImageView imageView = VK_NULL_HANDLE, VmaAllocation allocation = VK_NULL_HANDLE);
+		void DestroyCompletedResources(uint64_t completedFrame);
+	private:
+		// A Vulkan object waiting for the frames that may use it; Handle is the object's
+		// handle value as VK_EXT_debug_utils reports it
+		struct PendingDestroy
+		{
+			uint64_t Frame;
+			VkObjectType Type;
+			uint64_t Handle;
+			VkImageView ImageView;   // Images only
+			VmaAllocation Allocation; // Images and buffers
+		};
+
 		VkInstance m_Instance;
 		VkDebugUtilsMessengerEXT m_DebugMessenger;
 		VkPhysicalDevice m_PhysicalDevice;
@@ -109,7 +153,6 @@ namespace Gravix
 		VkDescriptorSetLayout m_BindlessCombinedImageSamplerLayout;
 		VkDescriptorSetLayout m_BindlessStorageImageLayout;
 		std::vector<VkDescriptorSetLayout> m_BindlessSetLayouts;
-		VkDescriptorSet m_BindlessDescriptorSets[4]; // 0: Storage Buffers, 1: Sampled Images, 2: Storage Images, 3: Samplers
 
 		VkDescriptorPool m_ImGuiDescriptorPool;
 
@@ -121,6 +164,11 @@ namespace Gravix
 		FrameData m_Frames[FRAME_OVERLAP];
 		uint32_t m_CurrentFrame = 0;
 
+		// Stamped with m_ReleaseFrame, so ordered by frame
+		std::deque<PendingDestroy> m_PendingDestroys;
+
+		VulkanGPUProfiler m_GPUProfiler;
+
 			bool m_Vsync;
 		bool m_FrameStarted = false;
 
@@ -52,6 +52,10 @@ namespace Gravix
 		std::function<void(YAML::Emitter&, void*)> SerializeFunc;
 		std::function<void(YAML::Emitter&, void*)> RawSerializeFunc; // For multi-instance components (no wrapper)
 		std::function<void(void*, const YAML::Node&)> DeserializeFunc;
+		std::function<void(const YAML::Node&, BinarySerializer&)> CookFunc; // YAML to the binary form without an entity, so any thread can run it
+#ifdef GX_ENABLE_ASSERTS
+		std::function<bool(void*)> CookRoundTripFunc; // Whether the instance comes back unchanged through its YAML and the cook
+#endif
 		std::function<void(void*, ComponentUserSettings*)> ImGuiRenderFunc;
 #endif
 
@@ -129,6 +133,36 @@ namespace Gravix
 					if(deserialize)
 						deserialize(*reinterpret_cast<T*>(instance), node);
 				};
+			info.CookFunc = [deserialize, binarySerialize](const YAML::Node& node, BinarySerializer& serializer) -> void
+				{
+					T component{};
+					if (deserialize)
+						deserialize(component, node);
+					if (binarySerialize)
+						binarySerialize(serializer, component);
+				};
+#ifdef GX_ENABLE_ASSERTS
+			info.CookRoundTripFunc = [serialize, deserialize, binarySerialize](void* instance) -> bool
+				{
+					if (!serialize || !binarySerialize)
+						return true;
+
+					T& component = *reinterpret_cast<T*>(instance);
+					YAML::Emitter out;
+					out << YAML::BeginMap;
+					serialize(out, component);
+					out << YAML::EndMap;
+
+					T cooked{};
+					if (deserialize)
+						deserialize(cooked, YAML::Load(out.c_str()));
+
+					BinarySerializer expected(1), actual(1);
+					binarySerialize(expected, component);
+					binarySerialize(actual, cooked);
+					return expected.GetBuffer() == actual.GetBuffer();
+				};
+#endif
 			info.ImGuiRenderFunc = [name, imguiRender, specification](void* instance, ComponentUserSettings* userSettings) -> void
 				{
 					// Track if any items were edited by checking ImGui's internal state before/after rendering
@@ -34,6 +34,8 @@ namespace Gravix
 
 	void TagComponentRenderer::Deserialize(TagComponent& c, const YAML::Node& node)
 	{
+		if (node["Name"])
+			c.Name = node["Name"].as<std::string>();
 		if (node["CreationIndex"])
 			c.CreationIndex = node["CreationIndex"].as<uint32_t>();
 	}
@@ -5,6 +5,7 @@
 #include "SceneCamera.h"
 
 #include "Asset/Asset.h"
+#include "Asset/AssetSlotTable.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -72,6 +73,9 @@ namespace Gravix
 		AssetHandle Texture = 0;
 		float TilingFactor = 1.0f;
 
+		// Resolved from Texture on first draw; not serialized
+		AssetSlotHandle TextureSlot;
+
 		SpriteRendererComponent() = default;
 		SpriteRendererComponent(const SpriteRendererComponent&) = default;
 		SpriteRendererComponent(const glm::vec4& color, const AssetHandle handle, float tilingFactor)
@@ -280,9 +280,11 @@ namespace Gravix
 		{
 			auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
 
+			AssetSlotTable& assetSlots = AssetManager::GetSlotTable();
+
 			view.each([&](auto entity, auto& transform, auto& sprite)
 				{
-					Ref<Texture2D> texture = sprite.Texture == 0 ? nullptr : AssetManager::GetAsset<Texture2D>(sprite.Texture);
+					Texture2D* texture = assetSlots.Resolve<Texture2D>(sprite.TextureSlot, sprite.Texture);
 					Renderer2D::DrawQuad(transform, (uint32_t)entity, sprite.Color, texture, sprite.TilingFactor);
 				});
 		}
@@ -331,9 +333,11 @@ namespace Gravix
 		{
 			auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
 
+			AssetSlotTable& assetSlots = AssetManager::GetSlotTable();
+
 			view.each([&](auto entity, auto& transform, auto& sprite)
 				{
-					Ref<Texture2D> texture = sprite.Texture == 0 ? nullptr : AssetManager::GetAsset<Texture2D>(sprite.Texture);
+					Texture2D* texture = assetSlots.Resolve<Texture2D>(sprite.TextureSlot, sprite.Texture);
 					Renderer2D::DrawQuad(transform, (uint32_t)entity, sprite.Color, texture, sprite.TilingFactor);
 				});
 		}
@@ -197,6 +197,13 @@ namespace Gravix
 		 */
 		void DuplicateEntity(Entity entity);
 
+		/**
+		 * @brief Check whether an entity handle refers to a live entity
+		 * @param handle Raw EnTT handle (e.g. read back from the picking buffer)
+		 * @return True if the entity exists in this scene's registry
+		 */
+		bool IsEntityValid(entt::entity handle) const { return m_Registry.valid(handle); }
+
 		/**
 		 * @brief Notify scene of viewport size change
 		 * @param width New viewport width in pixels
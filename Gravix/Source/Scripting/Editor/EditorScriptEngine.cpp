@@ -656,7 +656,7 @@ namespace Gravix
 			return;
 		}
 
-		// Check for file changes (polling-based)
+		// Check for file changes
 		s_ScriptWatcher->CheckForChanges();
 
 		// Check if we're in play mode (SceneContext is set during runtime)
@@ -55,18 +55,28 @@ namespace Gravix
 			file.close();
 
 			m_Data = m_Buffer.data();
+			m_Size = m_Buffer.size();
 			m_Offset = 0;
 
 			ValidateHeader(expectedVersion);
 		}
 #endif
 
-		// Runtime: Deserialize from buffer (PaK data)
-		BinaryDeserializer(const uint8_t* buffer, size_t size, uint32_t expectedVersion)
+		// Runtime: Deserialize from buffer (PaK data). With copyBuffer = false the
+		// caller's memory is read in place and must outlive the deserializer.
+		BinaryDeserializer(const uint8_t* buffer, size_t size, uint32_t expectedVersion, bool copyBuffer = true)
 		{
-			m_Buffer.resize(size);
-			std::memcpy(m_Buffer.data(), buffer, size);
-			m_Data = m_Buffer.data();
+			if (copyBuffer)
+			{
+				m_Buffer.resize(size);
+				std::memcpy(m_Buffer.data(), buffer, size);
+				m_Data = m_Buffer.data();
+			}
+			else
+			{
+				m_Data = const_cast<uint8_t*>(buffer);
+			}
+			m_Size = size;
 			m_Offset = 0;
 
 			ValidateHeader(expectedVersion);
@@ -77,6 +87,7 @@ namespace Gravix
 		{
 			m_Buffer = buffer;
 			m_Data = m_Buffer.data();
+			m_Size = m_Buffer.size();
 			m_Offset = 0;
 
 			ValidateHeader(expectedVersion);
@@ -198,6 +209,15 @@ namespace Gravix
 			m_Offset += static_cast<uint32_t>(numBytes);
 		}
 
+		// Pointer to the next unread byte, for reading large payloads without a copy
+		const uint8_t* GetReadPointer() const { return m_Data + m_Offset; }
+		size_t GetRemainingSize() const { return m_Size - m_Offset; }
+
+		void Skip(size_t numBytes)
+		{
+			m_Offset += static_cast<uint32_t>(numBytes);
+		}
+
 	private:
 		void ValidateHeader(uint32_t expectedVersion)
 		{
@@ -217,6 +237,7 @@ namespace Gravix
 
 		uint8_t* m_Data;
 		std::vector<uint8_t> m_Buffer;
+		size_t m_Size = 0;
 		uint32_t m_Offset = 0;
 
 		// type traits for container detection
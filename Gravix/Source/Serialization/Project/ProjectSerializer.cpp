@@ -41,6 +41,13 @@ namespace Gravix
 		out << YAML::Key << "RestitutionThreshold" << YAML::Value << config.Physics.RestitutionThreshold;
 		out << YAML::EndMap;
 
+		// Serialize Memory Settings
+		out << YAML::Key << "Memory" << YAML::BeginMap;
+		out << YAML::Key << "CPUBudgetMB" << YAML::Value << config.Memory.CPUBudgetMB;
+		out << YAML::Key << "GPUBudgetMB" << YAML::Value << config.Memory.GPUBudgetMB;
+		out << YAML::Key << "MinUnusedFrames" << YAML::Value << config.Memory.MinUnusedFrames;
+		out << YAML::EndMap;
+
 		out << YAML::EndMap;
 
 		out << YAML::EndMap;
@@ -89,6 +96,18 @@ namespace Gravix
 				config.Physics.RestitutionThreshold = physicsNode["RestitutionThreshold"].as<float>();
 		}
 
+		// Deserialize Memory Settings (unlimited if not present)
+		auto memoryNode = projectNode["Memory"];
+		if (memoryNode)
+		{
+			if (memoryNode["CPUBudgetMB"])
+				config.Memory.CPUBudgetMB = memoryNode["CPUBudgetMB"].as<uint32_t>();
+			if (memoryNode["GPUBudgetMB"])
+				config.Memory.GPUBudgetMB = memoryNode["GPUBudgetMB"].as<uint32_t>();
+			if (memoryNode["MinUnusedFrames"])
+				config.Memory.MinUnusedFrames = memoryNode["MinUnusedFrames"].as<uint32_t>();
+		}
+
 		return true;
 	}
 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Asset/Asset.h"
+#include "Core/Core.h"
+#include "Core/UUID.h"
+
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace Gravix
+{
+
+	// A scene file parsed into flat records, ready to be instantiated without touching the
+	// file or YAML again. Built on a worker by SceneSerializer::Parse; only
+	// SceneSerializer::Instantiate, on the main thread, creates entities from it.
+	struct ParsedScene : public RefCounted
+	{
+		struct ComponentRecord
+		{
+			std::type_index Type;
+			uint32_t Size; // Bytes of Blob taken by the component's binary form
+		};
+
+		struct EntityRecord
+		{
+			UUID ID;
+			std::string Name;
+			uint32_t CreationIndex = 0;
+			// Components[FirstComponent, FirstComponent + ComponentCount), in the order they are added
+			uint32_t FirstComponent = 0;
+			uint32_t ComponentCount = 0;
+			std::vector<std::type_index> ComponentOrder;
+			std::vector<std::string> Scripts;
+		};
+
+		std::vector<EntityRecord> Entities;
+		std::vector<ComponentRecord> Components;
+		// Every component's binary form back to back, after a BinarySerializer header
+		std::vector<uint8_t> Blob;
+		uint32_t NextCreationIndex = 1;
+		// Sorted and unique
+		std::vector<AssetHandle> Dependencies;
+	};
+
+}
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "SceneSerializer.h"
 
+#include "Core/MappedFileCache.h"
+#include "Core/MemoryStream.h"
+#include "Debug/Instrumentor.h"
 #include "Scene/ComponentRegistry.h"
 #include "Scene/Entity.h"
 
@@ -11,6 +14,11 @@
 namespace Gravix
 {
 
+#ifdef GRAVIX_EDITOR_BUILD
+	// Of the blob in ParsedScene, which never leaves memory
+	static constexpr uint32_t ParsedSceneVersion = 1;
+#endif
+
 	SceneSerializer::SceneSerializer(const Ref<Scene>& scene)
 		: m_Scene(scene)
 	{
@@ -76,6 +84,10 @@ namespace Gravix
 					if (component)
 					{
 						info.SerializeFunc(out, component);
+#ifdef GX_ENABLE_ASSERTS
+						// Scenes load through the cook, so anything it drops is lost on the next open
+						GX_ASSERT(info.CookRoundTripFunc(component), info.Name + "Component does not survive the YAML to binary cook");
+#endif
 					}
 				}
 			}
@@ -114,320 +126,190 @@ namespace Gravix
 		out << YAML::EndSeq;
 		out << YAML::EndMap;
 
+		// A cached mapping would keep the file from being written on Windows
+		MappedFileCache::Evict(filepath);
 		std::ofstream fout(filepath);
 		fout << out.c_str();
 	}
 
 	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
 	{
-		std::ifstream stream(filepath);
-		std::stringstream strStream;
+		ParsedScene parsedScene;
+		if (!Parse(filepath, parsedScene))
+			return false;
+
+		Instantiate(parsedScene);
+		return true;
+	}
+
+	bool SceneSerializer::Parse(const std::filesystem::path& filepath, ParsedScene& outScene)
+	{
+		GX_PROFILE_FUNCTION();
 
-		YAML::Node data = YAML::Load(stream);
+		Ref<MappedFile> file = MappedFileCache::Open(filepath);
+		if (!file)
+			return false;
+
+		const ComponentRegistry& registry = ComponentRegistry::Get();
+		const auto& allComponents = registry.GetAllComponents();
+		BinarySerializer serializer(ParsedSceneVersion);
 		uint32_t maxCreationIndex = 0;
 
-		auto entities = data["Entities"];
-		if (entities)
-		{
-			for (auto entity : entities)
+		// Each component goes through its YAML and binary functions into the blob, with no entity involved
+		auto cookComponent = [&](std::type_index typeIndex, const ComponentInfo& info, const YAML::Node& node)
 			{
-				UUID uuid = (UUID)entity["Entity"].as<uint64_t>();
-				std::string name;
-				uint32_t creationIndex = 0;
-				auto tagComponent = entity["TagComponent"];
-				if (tagComponent)
-				{
-					name = tagComponent["Name"].as<std::string>();
-					creationIndex = tagComponent["CreationIndex"].as<uint32_t>();
-				}
-				GX_CORE_TRACE("Deserialized entity with ID: {0}, name: {1}", (uint64_t)uuid, name);
-
-				// Track max creation index to update Scene's counter
-				if (creationIndex > maxCreationIndex)
-					maxCreationIndex = creationIndex;
+				size_t start = serializer.GetBuffer().size();
+				info.CookFunc(node, serializer);
+				outScene.Components.push_back({ typeIndex, static_cast<uint32_t>(serializer.GetBuffer().size() - start) });
+			};
 
-				Entity deserializedEntity = m_Scene->CreateEntity(name, uuid, creationIndex);
+		try
+		{
+			MemoryInputStream stream(file->GetData(), file->GetSize());
+			YAML::Node data = YAML::Load(stream);
 
-				// First pass: Deserialize ComponentOrderComponent if it exists
-				std::vector<std::type_index> componentOrder;
-				auto componentOrderNode = entity["ComponentOrderComponent"];
-				if (componentOrderNode && deserializedEntity.HasComponent<ComponentOrderComponent>())
+			auto entities = data["Entities"];
+			if (entities)
+			{
+				outScene.Entities.reserve(entities.size());
+				for (auto entity : entities)
 				{
-					auto& orderComponent = deserializedEntity.GetComponent<ComponentOrderComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(ComponentOrderComponent));
-					if (info.DeserializeFunc)
+					ParsedScene::EntityRecord& record = outScene.Entities.emplace_back();
+					record.ID = (UUID)entity["Entity"].as<uint64_t>();
+					auto tagNode = entity["TagComponent"];
+					if (tagNode)
 					{
-						info.DeserializeFunc(&orderComponent, componentOrderNode);
-						componentOrder = orderComponent.ComponentOrder;
+						record.Name = tagNode["Name"].as<std::string>();
+						record.CreationIndex = tagNode["CreationIndex"].as<uint32_t>();
 					}
-				}
+					GX_CORE_TRACE("Deserialized entity with ID: {0}, name: {1}", (uint64_t)record.ID, record.Name);
 
-				// If we have a saved component order, use it; otherwise use registry order
-				if (componentOrder.empty())
-				{
-					componentOrder = ComponentRegistry::Get().GetComponentOrder();
-				}
+					// Track max creation index to update Scene's counter
+					if (record.CreationIndex > maxCreationIndex)
+						maxCreationIndex = record.CreationIndex;
 
-				// Second pass: Deserialize components in the correct order
-				for (auto typeIndex : componentOrder)
-				{
-					// Skip ComponentOrderComponent as it's already handled
-					if (typeIndex == typeid(ComponentOrderComponent))
-						continue;
+					// If we have a saved component order, use it; otherwise use registry order
+					auto componentOrderNode = entity["ComponentOrderComponent"];
+					if (componentOrderNode)
+					{
+						ComponentOrderComponent orderComponent;
+						const auto& info = allComponents.at(typeid(ComponentOrderComponent));
+						if (info.DeserializeFunc)
+						{
+							info.DeserializeFunc(&orderComponent, componentOrderNode);
+							record.ComponentOrder = std::move(orderComponent.ComponentOrder);
+						}
+					}
+					if (record.ComponentOrder.empty())
+						record.ComponentOrder = registry.GetComponentOrder();
 
-					// Skip TagComponent and TransformComponent as they're created automatically
-					if (typeIndex == typeid(TagComponent) || typeIndex == typeid(TransformComponent))
-						continue;
+					record.FirstComponent = static_cast<uint32_t>(outScene.Components.size());
+					for (auto typeIndex : record.ComponentOrder)
+					{
+						// ComponentOrderComponent and Tag come from the record; Transform comes last
+						if (typeIndex == typeid(ComponentOrderComponent) || typeIndex == typeid(TagComponent) || typeIndex == typeid(TransformComponent))
+							continue;
 
-					const auto& allComponents = ComponentRegistry::Get().GetAllComponents();
-					auto it = allComponents.find(typeIndex);
-					if (it == allComponents.end())
-						continue;
+						auto it = allComponents.find(typeIndex);
+						if (it == allComponents.end() || !it->second.DeserializeFunc)
+							continue;
 
-					const auto& info = it->second;
-					if (info.DeserializeFunc)
-					{
-						// Check if this is a multi-instance component
+						const auto& info = it->second;
 						if (info.Specification.AllowMultiple)
 						{
-							// Special case for ScriptComponent: deserialize from simple "Scripts" list
-							if (typeIndex == typeid(ScriptComponent))
+							// Special case for ScriptComponent: deserialize from simple "Scripts" list.
+							// Other multi-instance components are not loaded yet.
+							auto scriptsNode = entity["Scripts"];
+							if (typeIndex == typeid(ScriptComponent) && scriptsNode && scriptsNode.IsSequence())
 							{
-								auto scriptsNode = entity["Scripts"];
-								if (scriptsNode && scriptsNode.IsSequence())
-								{
-									for (const auto& scriptName : scriptsNode)
-									{
-										auto comp = std::make_shared<ScriptComponent>();
-										comp->Name = scriptName.as<std::string>();
-										m_Scene->m_MultiComponents[deserializedEntity.GetID()][typeIndex].push_back(comp);
-									}
-								}
-							}
-							else
-							{
-								// Generic multi-instance deserialization
-								std::string componentsArrayName = info.Name + "Components";
-								auto componentsArrayNode = entity[componentsArrayName];
-								if (componentsArrayNode && componentsArrayNode.IsSequence())
-								{
-									for (const auto& componentNode : componentsArrayNode)
-									{
-										// Create a new instance in multi-storage
-										// Add specific handling for other multi-instance components here
-									}
-								}
+								for (const auto& scriptName : scriptsNode)
+									record.Scripts.push_back(scriptName.as<std::string>());
 							}
+							continue;
 						}
-						else
-						{
-							// Single instance component
-							std::string componentName = info.Name + "Component";
-							auto componentNode = entity[componentName];
-							if (componentNode)
-							{
-								if (!deserializedEntity.HasComponent(typeIndex))
-									deserializedEntity.AddComponent(typeIndex);
 
-								void* component = deserializedEntity.GetComponent(typeIndex);
-								if (component)
-									info.DeserializeFunc(component, componentNode);
-							}
+						auto componentNode = entity[info.Name + "Component"];
+						if (!componentNode)
+							continue;
+
+						cookComponent(typeIndex, info, componentNode);
+
+						// Same references Scene::ExtractSceneDependencies collects
+						if (typeIndex == typeid(SpriteRendererComponent))
+						{
+							AssetHandle texture = (AssetHandle)componentNode["Texture"].as<uint64_t>(0);
+							if (texture != 0)
+								outScene.Dependencies.push_back(texture);
 						}
 					}
-				}
 
-				// Third pass: Deserialize TagComponent and TransformComponent data (they already exist)
-				auto tagNode = entity["TagComponent"];
-				if (tagNode)
-				{
-					auto& tc = deserializedEntity.GetComponent<TagComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(TagComponent));
-					if (info.DeserializeFunc)
-						info.DeserializeFunc(&tc, tagNode);
-				}
+					// Transform already exists on every entity; its data goes in last. Tag is carried
+					// by the record itself and set when the entity is created.
+					auto transformNode = entity["TransformComponent"];
+					if (transformNode)
+						cookComponent(typeid(TransformComponent), allComponents.at(typeid(TransformComponent)), transformNode);
 
-				auto transformNode = entity["TransformComponent"];
-				if (transformNode)
-				{
-					auto& tc = deserializedEntity.GetComponent<TransformComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(TransformComponent));
-					if (info.DeserializeFunc)
-						info.DeserializeFunc(&tc, transformNode);
-				}
-
-				// Restore the component order to remove any duplicates added during deserialization
-				if (!componentOrder.empty() && deserializedEntity.HasComponent<ComponentOrderComponent>())
-				{
-					auto& orderComponent = deserializedEntity.GetComponent<ComponentOrderComponent>();
-					orderComponent.ComponentOrder = componentOrder;
+					record.ComponentCount = static_cast<uint32_t>(outScene.Components.size()) - record.FirstComponent;
 				}
 			}
 		}
+		catch (const YAML::Exception& e)
+		{
+			GX_CORE_ERROR("Failed to parse scene {0}: {1}", filepath.string(), e.what());
+			return false;
+		}
 
-		// Update Scene's next creation index to be higher than any loaded entity
-		m_Scene->m_NextCreationIndex = maxCreationIndex + 1;
+		outScene.Blob = std::move(serializer.GetBuffer());
+		// Next creation index is higher than any loaded entity
+		outScene.NextCreationIndex = maxCreationIndex + 1;
 
+		std::sort(outScene.Dependencies.begin(), outScene.Dependencies.end());
+		outScene.Dependencies.erase(std::unique(outScene.Dependencies.begin(), outScene.Dependencies.end()), outScene.Dependencies.end());
 		return true;
 	}
 
-	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath, YAML::Node* outNode)
+	void SceneSerializer::Instantiate(const ParsedScene& parsedScene)
 	{
-		std::ifstream stream(filepath);
-		std::stringstream strStream;
+		GX_PROFILE_FUNCTION();
 
-		YAML::Node data = YAML::Load(stream);
-		if (!data["Scene"])
-			return false;
-
-		std::string sceneName = data["Scene"].as<std::string>();
-		GX_CORE_TRACE("Deserializing scene: {0}", sceneName);
-
-		uint32_t maxCreationIndex = 0;
+		const auto& allComponents = ComponentRegistry::Get().GetAllComponents();
+		m_Scene->m_EntityMap.reserve(m_Scene->m_EntityMap.size() + parsedScene.Entities.size());
 
-		auto entities = data["Entities"];
-		if (entities)
+		BinaryDeserializer deserializer(parsedScene.Blob.data(), parsedScene.Blob.size(), ParsedSceneVersion, false);
+		for (const ParsedScene::EntityRecord& record : parsedScene.Entities)
 		{
-			for (auto entity : entities)
-			{
-				UUID uuid = (UUID)entity["Entity"].as<uint64_t>();
-				std::string name;
-				uint32_t creationIndex = 0;
-				auto tagComponent = entity["TagComponent"];
-				if (tagComponent)
-				{
-					name = tagComponent["Name"].as<std::string>();
-					creationIndex = tagComponent["CreationIndex"].as<uint32_t>();
-				}
-				GX_CORE_TRACE("Deserialized entity with ID: {0}, name: {1}", (uint64_t)uuid, name);
-
-				// Track max creation index to update Scene's counter
-				if (creationIndex > maxCreationIndex)
-					maxCreationIndex = creationIndex;
-
-				Entity deserializedEntity = m_Scene->CreateEntity(name, uuid, creationIndex);
-
-				// First pass: Deserialize ComponentOrderComponent if it exists
-				std::vector<std::type_index> componentOrder;
-				auto componentOrderNode = entity["ComponentOrderComponent"];
-				if (componentOrderNode && deserializedEntity.HasComponent<ComponentOrderComponent>())
-				{
-					auto& orderComponent = deserializedEntity.GetComponent<ComponentOrderComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(ComponentOrderComponent));
-					if (info.DeserializeFunc)
-					{
-						info.DeserializeFunc(&orderComponent, componentOrderNode);
-						componentOrder = orderComponent.ComponentOrder;
-					}
-				}
+			Entity entity = m_Scene->CreateEntity(record.Name, record.ID, record.CreationIndex);
 
-				// If we have a saved component order, use it; otherwise use registry order
-				if (componentOrder.empty())
-				{
-					componentOrder = ComponentRegistry::Get().GetComponentOrder();
-				}
-
-				// Second pass: Deserialize components in the correct order
-				for (auto typeIndex : componentOrder)
-				{
-					// Skip ComponentOrderComponent as it's already handled
-					if (typeIndex == typeid(ComponentOrderComponent))
-						continue;
-
-					// Skip TagComponent and TransformComponent as they're created automatically
-					if (typeIndex == typeid(TagComponent) || typeIndex == typeid(TransformComponent))
-						continue;
-
-					const auto& allComponents = ComponentRegistry::Get().GetAllComponents();
-					auto it = allComponents.find(typeIndex);
-					if (it == allComponents.end())
-						continue;
-
-					const auto& info = it->second;
-					if (info.DeserializeFunc)
-					{
-						// Check if this is a multi-instance component
-						if (info.Specification.AllowMultiple)
-						{
-							// Special case for ScriptComponent: deserialize from simple "Scripts" list
-							if (typeIndex == typeid(ScriptComponent))
-							{
-								auto scriptsNode = entity["Scripts"];
-								if (scriptsNode && scriptsNode.IsSequence())
-								{
-									for (const auto& scriptName : scriptsNode)
-									{
-										auto comp = std::make_shared<ScriptComponent>();
-										comp->Name = scriptName.as<std::string>();
-										m_Scene->m_MultiComponents[deserializedEntity.GetID()][typeIndex].push_back(comp);
-									}
-								}
-							}
-							else
-							{
-								// Generic multi-instance deserialization
-								std::string componentsArrayName = info.Name + "Components";
-								auto componentsArrayNode = entity[componentsArrayName];
-								if (componentsArrayNode && componentsArrayNode.IsSequence())
-								{
-									for (const auto& componentNode : componentsArrayNode)
-									{
-										// Create a new instance in multi-storage
-										// Add specific handling for other multi-instance components here
-									}
-								}
-							}
-						}
-						else
-						{
-							// Single instance component
-							std::string componentName = info.Name + "Component";
-							auto componentNode = entity[componentName];
-							if (componentNode)
-							{
-								if (!deserializedEntity.HasComponent(typeIndex))
-									deserializedEntity.AddComponent(typeIndex);
+			for (uint32_t i = record.FirstComponent; i < record.FirstComponent + record.ComponentCount; i++)
+			{
+				const ParsedScene::ComponentRecord& component = parsedScene.Components[i];
+				const auto& info = allComponents.at(component.Type);
 
-								void* component = deserializedEntity.GetComponent(typeIndex);
-								if (component)
-									info.DeserializeFunc(component, componentNode);
-							}
-						}
-					}
-				}
+				// Adding runs the component's OnCreate before its data is read, as it always has
+				if (!entity.HasComponent(component.Type))
+					entity.AddComponent(component.Type);
 
-				// Third pass: Deserialize TagComponent and TransformComponent data (they already exist)
-				auto tagNode = entity["TagComponent"];
-				if (tagNode)
-				{
-					auto& tc = deserializedEntity.GetComponent<TagComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(TagComponent));
-					if (info.DeserializeFunc)
-						info.DeserializeFunc(&tc, tagNode);
-				}
+				size_t remainingBefore = deserializer.GetRemainingSize();
+				info.BinaryDeserializeFunc(deserializer, entity.GetComponent(component.Type));
 
-				auto transformNode = entity["TransformComponent"];
-				if (transformNode)
-				{
-					auto& tc = deserializedEntity.GetComponent<TransformComponent>();
-					const auto& info = ComponentRegistry::Get().GetAllComponents().at(typeid(TransformComponent));
-					if (info.DeserializeFunc)
-						info.DeserializeFunc(&tc, transformNode);
-				}
+				// Keeps the next component aligned when this one reads less than it wrote
+				size_t bytesRead = remainingBefore - deserializer.GetRemainingSize();
+				if (bytesRead < component.Size)
+					deserializer.Skip(component.Size - bytesRead);
+			}
 
-				// Restore the component order to remove any duplicates added during deserialization
-				if (!componentOrder.empty() && deserializedEntity.HasComponent<ComponentOrderComponent>())
-				{
-					auto& orderComponent = deserializedEntity.GetComponent<ComponentOrderComponent>();
-					orderComponent.ComponentOrder = componentOrder;
-				}
+			for (const std::string& scriptName : record.Scripts)
+			{
+				auto script = std::make_shared<ScriptComponent>();
+				script->Name = scriptName;
+				m_Scene->m_MultiComponents[record.ID][typeid(ScriptComponent)].push_back(script);
 			}
+
+			// Restore the component order to remove any duplicates added during deserialization
+			entity.GetComponent<ComponentOrderComponent>().ComponentOrder = record.ComponentOrder;
 		}
 
-		outNode = &data;
-		// Update Scene's next creation index to be higher than any loaded entity
-		m_Scene->m_NextCreationIndex = maxCreationIndex + 1;
-		return true;
+		m_Scene->m_NextCreationIndex = parsedScene.NextCreationIndex;
 	}
 
 #endif // GRAVIX_EDITOR_BUILD
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ParsedScene.h"
 #include "Scene/Scene.h"
 #include "Serialization/BinarySerializer.h"
 #include "Serialization/BinaryDeserializer.h"
@@ -22,8 +23,13 @@ namespace Gravix
 #ifdef GRAVIX_EDITOR_BUILD
 		void SerializeEntity(YAML::Emitter& out, Entity entity);
 		void Serialize(const std::filesystem::path& filepath);
+		// Parse followed by Instantiate
 		bool Deserialize(const std::filesystem::path& filepath);
-		bool Deserialize(const std::filesystem::path& filepath, YAML::Node* outNode);
+
+		// Reads the file into flat records without creating anything, so it is safe on a worker
+		static bool Parse(const std::filesystem::path& filepath, ParsedScene& outScene);
+		// Main thread only. Creates the parsed entities in this serializer's scene.
+		void Instantiate(const ParsedScene& parsedScene);
 #endif
 
 		// Runtime: Binary serialization
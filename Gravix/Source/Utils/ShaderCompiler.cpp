@@ -4,12 +4,56 @@
 #include "Utils/ShaderReflector.h"
 #include "Utils/SlangTypeUtils.h"
 
+#include "Core/MappedFileCache.h"
+
+#include <atomic>
 #include <cstring>
 
 using namespace slang;
 namespace Gravix
 {
 
+	namespace
+	{
+		// Hands Slang the mapped source itself, so the file is not read a second time
+		class MappedFileBlob : public ISlangBlob
+		{
+		public:
+			explicit MappedFileBlob(Ref<MappedFile> file)
+				: m_File(std::move(file))
+			{
+			}
+
+			SLANG_NO_THROW SlangResult SLANG_MCALL queryInterface(SlangUUID const& uuid, void** outObject) override
+			{
+				if (uuid == ISlangBlob::getTypeGuid() || uuid == ISlangUnknown::getTypeGuid())
+				{
+					addRef();
+					*outObject = static_cast<ISlangBlob*>(this);
+					return SLANG_OK;
+				}
+
+				*outObject = nullptr;
+				return SLANG_E_NO_INTERFACE;
+			}
+
+			SLANG_NO_THROW uint32_t SLANG_MCALL addRef() override { return ++m_RefCount; }
+			SLANG_NO_THROW uint32_t SLANG_MCALL release() override
+			{
+				uint32_t count = --m_RefCount;
+				if (count == 0)
+					delete this;
+				return count;
+			}
+
+			SLANG_NO_THROW const void* SLANG_MCALL getBufferPointer() override { return m_File->GetData(); }
+			SLANG_NO_THROW size_t SLANG_MCALL getBufferSize() override { return static_cast<size_t>(m_File->GetSize()); }
+		private:
+			std::atomic<uint32_t> m_RefCount = 0;
+			Ref<MappedFile> m_File;
+		};
+	}
+
 	ShaderCompiler::ShaderCompiler()
 	{
 		createGlobalSession(m_GlobalSession.writeRef());
@@ -46,10 +90,20 @@ namespace Gravix
 		Slang::ComPtr<ISession> session;
 		m_GlobalSession->createSession(sessionDesc, session.writeRef());
 
+		Ref<MappedFile> sourceFile = MappedFileCache::Open(filePath);
+		if (!sourceFile)
+		{
+			GX_CORE_ERROR("Failed to read shader: {0}", filePath.string());
+			return false;
+		}
+
 		Slang::ComPtr<IModule> slangModule;
 		{
+			// Imports are still resolved relative to the path given here
+			Slang::ComPtr<IBlob> source(new MappedFileBlob(sourceFile));
 			Slang::ComPtr<IBlob> diagnosticBlob;
-			slangModule = session->loadModule(filePath.string().c_str(), diagnosticBlob.writeRef());
+			slangModule = session->loadModuleFromSource(filePath.stem().string().c_str(), filePath.string().c_str(),
+				source, diagnosticBlob.writeRef());
 			if (diagnosticBlob && diagnosticBlob->getBufferSize() > 0)
 			{
 				std::string message = (char*)diagnosticBlob->getBufferPointer();
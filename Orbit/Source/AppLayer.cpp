@@ -264,18 +264,6 @@ namespace Gravix
 			}
 		}
 
-		// Check if pending scene has finished loading
-		{
-			GX_PROFILE_SCOPE("CheckPendingScene");
-			AssetHandle pendingScene = m_SceneManager.GetPendingSceneHandle();
-			if (pendingScene != 0 && AssetManager::IsAssetLoaded(pendingScene))
-			{
-				GX_CORE_INFO("Async scene load completed, switching to scene {0}", static_cast<uint64_t>(pendingScene));
-				m_SceneManager.ClearPendingScene();
-				m_SceneManager.OpenScene(pendingScene, false); // AssetManager already deserialized the scene
-			}
-		}
-
 		// Only resize if viewport size actually changed
 		if (m_ViewportPanel.IsViewportValid())
 		{
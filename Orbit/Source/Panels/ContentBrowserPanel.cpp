@@ -67,6 +67,14 @@ namespace Gravix
 		ImGui::SameLine();
 		ImGui::TextDisabled("%s", displayPath.c_str());
 
+		const AssetImportProgress& importProgress = Project::GetActive()->GetEditorAssetManager()->GetImportProgress();
+		if (importProgress.IsRunning())
+		{
+			char progressLabel[64];
+			snprintf(progressLabel, sizeof(progressLabel), "Importing %u / %u", importProgress.Completed, importProgress.Total);
+			ImGui::ProgressBar(static_cast<float>(importProgress.Completed) / static_cast<float>(importProgress.Total), ImVec2(-1.0f, 0.0f), progressLabel);
+		}
+
 		ImGui::Separator();
 		ImGui::Spacing();
 
@@ -175,6 +183,57 @@ namespace Gravix
 					}
 				}
 
+				// Import settings for textures; changing them recooks the texture
+				AssetHandle itemHandle = m_TreeNodes[treeNodeIndex].Handle;
+				Ref<EditorAssetManager> assetManager = Project::GetActive()->GetEditorAssetManager();
+				if (!isDirectory && itemHandle != 0 && assetManager->GetAssetType(itemHandle) == AssetType::Texture2D)
+				{
+					if (ImGui::BeginMenu("Compression"))
+					{
+						TextureImportSettings settings = assetManager->GetAssetMetadata(itemHandle).TextureSettings;
+
+						for (TextureCompression compression : { TextureCompression::Auto, TextureCompression::None,
+							TextureCompression::BC7, TextureCompression::BC5, TextureCompression::BC4 })
+						{
+							std::string label(TextureCompressionToString(compression));
+							if (ImGui::MenuItem(label.c_str(), nullptr, settings.Compression == compression))
+							{
+								settings.Compression = compression;
+								assetManager->SetTextureImportSettings(itemHandle, settings);
+							}
+						}
+
+						ImGui::Separator();
+						if (ImGui::MenuItem("Generate Mipmaps", nullptr, settings.GenerateMipmaps))
+						{
+							settings.GenerateMipmaps = !settings.GenerateMipmaps;
+							assetManager->SetTextureImportSettings(itemHandle, settings);
+						}
+
+						if (ImGui::BeginMenu("Mip Filter", settings.GenerateMipmaps))
+						{
+							for (TextureMipFilter filter : { TextureMipFilter::Box, TextureMipFilter::Kaiser })
+							{
+								std::string label(TextureMipFilterToString(filter));
+								if (ImGui::MenuItem(label.c_str(), nullptr, settings.MipFilter == filter))
+								{
+									settings.MipFilter = filter;
+									assetManager->SetTextureImportSettings(itemHandle, settings);
+								}
+							}
+							ImGui::EndMenu();
+						}
+
+						if (ImGui::MenuItem("sRGB", nullptr, settings.SRGB))
+						{
+							settings.SRGB = !settings.SRGB;
+							assetManager->SetTextureImportSettings(itemHandle, settings);
+						}
+
+						ImGui::EndMenu();
+					}
+				}
+
 				if (ImGui::MenuItem("Rename"))
 				{
 					m_IsRenaming = true;
@@ -439,46 +498,11 @@ namespace Gravix
 			return;
 		}
 
+		// Every new file is registered before this returns, so the tree below shows them all;
+		// their loads run over the next frames and the toolbar shows how far along they are
 		Ref<EditorAssetManager> assetManager = Project::GetActive()->GetEditorAssetManager();
-		const auto& assetRegistry = assetManager->GetAssetRegistry();
-
-		// Build a set of already registered file paths for efficient lookup
-		std::set<std::filesystem::path> registeredPaths;
-		for (const auto& [handle, metadata] : assetRegistry)
-		{
-			registeredPaths.insert(metadata.FilePath);
-		}
-
-		// Recursively scan all files in the asset directory
-		try
-		{
-			for (const auto& entry : std::filesystem::recursive_directory_iterator(m_AssetDirectory))
-			{
-				if (!entry.is_regular_file())
-					continue;
-
-				// Skip C# related files (they're not assets)
-				std::string extension = entry.path().extension().string();
-				if (extension == ".cs" || extension == ".csproj")
-					continue;
-
-				auto relativePath = std::filesystem::relative(entry.path(), m_AssetDirectory);
-
-				// Check if this file is already in the registry
-				if (registeredPaths.find(relativePath) == registeredPaths.end())
-				{
-					// Not in registry, import it asynchronously
-					assetManager->ImportAsset(relativePath);
-				}
-			}
-
-			// Serialize registry after importing new assets
+		if (assetManager->ImportUnregisteredAssets() > 0)
 			assetManager->SerializeAssetRegistry();
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			GX_CORE_ERROR("Failed to scan asset directory: {0}", e.what());
-		}
 	}
 
 	void ContentBrowserPanel::RenameAsset(const std::filesystem::path& oldPath, const std::string& newName)
@@ -529,8 +553,7 @@ namespace Gravix
 					if (!relPath.empty() && relPath.string().find("..") == std::string::npos)
 					{
 						// This asset is inside the renamed directory - update its path
-						auto& mutableMetadata = const_cast<AssetMetadata&>(metadata);
-						mutableMetadata.FilePath = newRelativePath / relPath;
+						assetManager->SetAssetFilePath(handle, newRelativePath / relPath);
 						metadataUpdated = true;
 
 						// Update window title if this is the active scene
@@ -551,26 +574,22 @@ namespace Gravix
 			else
 			{
 				// For files, find and update the specific asset
-				for (auto& [handle, metadata] : assetRegistry)
+				AssetHandle handle = assetManager->GetAssetHandle(oldRelativePath);
+				if (handle != 0)
 				{
-					if (metadata.FilePath == oldRelativePath)
-					{
-						// Update the metadata file path
-						auto& mutableMetadata = const_cast<AssetMetadata&>(metadata);
-						mutableMetadata.FilePath = std::filesystem::relative(fullNewPath, m_AssetDirectory);
+					// Update the metadata file path
+					assetManager->SetAssetFilePath(handle, std::filesystem::relative(fullNewPath, m_AssetDirectory));
 
-						// Serialize the updated asset registry
-						assetManager->SerializeAssetRegistry();
-
-						// Update window title if this is the active scene
-						if (m_AppLayer && metadata.Type == AssetType::Scene && handle == m_AppLayer->GetActiveSceneHandle())
-						{
-							m_AppLayer->UpdateWindowTitle();
-						}
+					// Serialize the updated asset registry
+					assetManager->SerializeAssetRegistry();
 
-						GX_CORE_INFO("Renamed file: {0} -> {1}", oldRelativePath.string(), mutableMetadata.FilePath.string());
-						break;
+					// Update window title if this is the active scene
+					if (m_AppLayer && assetManager->GetAssetType(handle) == AssetType::Scene && handle == m_AppLayer->GetActiveSceneHandle())
+					{
+						m_AppLayer->UpdateWindowTitle();
 					}
+
+					GX_CORE_INFO("Renamed file: {0} -> {1}", oldRelativePath.string(), assetManager->GetAssetFilePath(handle).string());
 				}
 			}
 
@@ -3,6 +3,7 @@
 
 #include "Project/Project.h"
 #include "Asset/AssetManager.h"
+#include "Core/Application.h"
 
 #include <imgui.h>
 #include <cstring>
@@ -48,6 +49,10 @@ namespace Gravix
 				// Physics tab
 				if (ImGui::Selectable("Physics", m_CurrentTab == ProjectSettingsTab::Physics))
 					m_CurrentTab = ProjectSettingsTab::Physics;
+
+				// Memory tab
+				if (ImGui::Selectable("Memory", m_CurrentTab == ProjectSettingsTab::Memory))
+					m_CurrentTab = ProjectSettingsTab::Memory;
 			}
 			ImGui::EndChild();
 
@@ -64,6 +69,9 @@ namespace Gravix
 				case ProjectSettingsTab::Physics:
 					RenderPhysicsTab();
 					break;
+				case ProjectSettingsTab::Memory:
+					RenderMemoryTab();
+					break;
 				}
 			}
 			ImGui::EndChild();
@@ -237,4 +245,107 @@ namespace Gravix
 		ImGui::TextWrapped("Restitution threshold is the relative velocity below which colliding objects will not bounce. Default is 2.4 m/s for pixel-based physics.");
 	}
 
+	void ProjectSettingsPanel::RenderMemoryTab()
+	{
+		Ref<Project> project = Project::GetActive();
+		auto& config = project->GetConfig();
+
+		ImGui::Spacing();
+		ImGui::Text("Asset Memory Budget");
+		ImGui::Separator();
+		ImGui::Spacing();
+
+		bool changed = false;
+
+		ImGui::Text("CPU Budget (MB, 0 = unlimited)");
+		ImGui::SetNextItemWidth(-1);
+		changed |= ImGui::InputScalar("##CPUBudget", ImGuiDataType_U32, &config.Memory.CPUBudgetMB);
+		ImGui::Spacing();
+
+		ImGui::Text("GPU Budget (MB, 0 = unlimited)");
+		ImGui::SetNextItemWidth(-1);
+		changed |= ImGui::InputScalar("##GPUBudget", ImGuiDataType_U32, &config.Memory.GPUBudgetMB);
+		ImGui::Spacing();
+
+		ImGui::Text("Keep Assets Used Within (frames)");
+		ImGui::SetNextItemWidth(-1);
+		changed |= ImGui::InputScalar("##MinUnusedFrames", ImGuiDataType_U32, &config.Memory.MinUnusedFrames);
+		ImGui::Spacing();
+
+		if (changed)
+			project->ApplyMemorySettings();
+
+		ImGui::Separator();
+		ImGui::Spacing();
+
+		AssetResidency& residency = project->GetAssetManager()->GetResidency();
+		const AssetResidencyStats& stats = residency.GetStats();
+		constexpr float MB = 1024.0f * 1024.0f;
+
+		ImGui::Text("Resident: %u assets, %.1f MB CPU, %.1f MB GPU", stats.ResidentCount,
+			stats.Total.CPUBytes / MB, stats.Total.GPUBytes / MB);
+		ImGui::Text("Evicted: %llu assets, %.1f MB total", (unsigned long long)stats.EvictedTotal,
+			stats.EvictedMemoryTotal.GetTotal() / MB);
+		ImGui::Text("Pending GPU releases: %zu", Application::Get().GetWindow().GetDevice()->GetPendingReleaseCount());
+		if (stats.OverBudget)
+			ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Over budget: everything left is in use");
+
+		ImGui::Spacing();
+
+		if (ImGui::BeginTable("PerType", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Type");
+			ImGui::TableSetupColumn("Count");
+			ImGui::TableSetupColumn("CPU (MB)");
+			ImGui::TableSetupColumn("GPU (MB)");
+			ImGui::TableHeadersRow();
+
+			for (size_t i = 1; i < AssetTypeCount; i++)
+			{
+				const AssetResidencyStats::TypeStats& typeStats = stats.PerType[i];
+				if (typeStats.Count == 0)
+					continue;
+
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(AssetTypeToString(static_cast<AssetType>(i)).data());
+				ImGui::TableNextColumn(); ImGui::Text("%u", typeStats.Count);
+				ImGui::TableNextColumn(); ImGui::Text("%.2f", typeStats.Memory.CPUBytes / MB);
+				ImGui::TableNextColumn(); ImGui::Text("%.2f", typeStats.Memory.GPUBytes / MB);
+			}
+			ImGui::EndTable();
+		}
+
+		ImGui::Spacing();
+
+		if (ImGui::CollapsingHeader("Resident Assets"))
+		{
+			Ref<EditorAssetManager> editorAssetManager = project->GetEditorAssetManager();
+
+			if (ImGui::BeginTable("Resident", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0, 250)))
+			{
+				ImGui::TableSetupColumn("Asset");
+				ImGui::TableSetupColumn("Type");
+				ImGui::TableSetupColumn("Size (KB)");
+				ImGui::TableSetupColumn("Refs");
+				ImGui::TableSetupColumn("Why");
+				ImGui::TableHeadersRow();
+
+				for (const ResidentAssetInfo& info : residency.GetResidentAssets())
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					if (editorAssetManager)
+						ImGui::TextUnformatted(editorAssetManager->GetAssetFilePath(info.Handle).filename().string().c_str());
+					else
+						ImGui::TextUnformatted(info.Handle.ToString().c_str());
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(AssetTypeToString(info.Type).data());
+					ImGui::TableNextColumn(); ImGui::Text("%.1f", info.Memory.GetTotal() / 1024.0f);
+					ImGui::TableNextColumn(); ImGui::Text("%u", info.ExternalReferences);
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(ResidencyReasonToString(info.Reason));
+				}
+				ImGui::EndTable();
+			}
+		}
+	}
+
 }
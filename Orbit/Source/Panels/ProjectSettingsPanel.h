@@ -6,7 +6,8 @@ namespace Gravix
 	enum class ProjectSettingsTab
 	{
 		General = 0,
-		Physics
+		Physics,
+		Memory
 	};
 
 	class ProjectSettingsPanel
@@ -23,6 +24,7 @@ namespace Gravix
 	private:
 		void RenderGeneralTab();
 		void RenderPhysicsTab();
+		void RenderMemoryTab();
 
 		bool m_IsOpen = false;
 		ProjectSettingsTab m_CurrentTab = ProjectSettingsTab::General;
@@ -209,8 +209,13 @@ namespace Gravix
 		// Verify mouse is within viewport bounds
 		if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)viewportSize.x && mouseY < (int)viewportSize.y)
 		{
-			// Read entity ID from framebuffer's second attachment (index 1)
-			int pixel = m_Framebuffer->ReadPixel(1, mouseX, mouseY);
+			// Read entity ID from framebuffer's second attachment (index 1).
+			// The readback is asynchronous and lags a couple of frames, so the
+			// entity it names may have been destroyed in the meantime
+			int pixel = m_Framebuffer->ReadPixelAsync(1, mouseX, mouseY);
+			if (pixel != -1 && !m_SceneHierarchyPanel->GetContext()->IsEntityValid((entt::entity)(uint32_t)pixel))
+				pixel = -1;
+
 			m_HoveredEntity = pixel == -1 ? Entity{ entt::null, m_SceneHierarchyPanel->GetContext().get() } : Entity((entt::entity)(uint64_t)(uint32_t)pixel, m_SceneHierarchyPanel->GetContext().get());
 
 			// Only change cursor mode if it actually needs to change (prevents glitching)
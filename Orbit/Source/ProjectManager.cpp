@@ -2,6 +2,7 @@
 
 #include "Utils/PlatformUtils.h"
 #include "Core/Log.h"
+#include "Asset/AssetPack/PakBuilder.h"
 
 namespace Gravix
 {
@@ -88,4 +89,31 @@ namespace Gravix
 		return true;
 	}
 
+	bool ProjectManager::BuildAssetPack()
+	{
+		if (!Project::HasActiveProject())
+			return false;
+
+		std::filesystem::path pakPath = FileDialogs::SaveFile("Gravix Asset Pack (*.gpak)\0*.gpak\0");
+		if (pakPath.empty())
+			return false;
+
+		if (pakPath.extension() != ".gpak")
+			pakPath += ".gpak";
+
+		PakBuilder builder;
+		builder.AddAssets(Project::GetActive()->GetEditorAssetManager()->GetAssetRegistry());
+		return builder.Write(pakPath);
+	}
+
+	void ProjectManager::BenchmarkAssetPack()
+	{
+		if (!Project::HasActiveProject())
+			return;
+
+		PakBuilder builder;
+		builder.AddAssets(Project::GetActive()->GetEditorAssetManager()->GetAssetRegistry());
+		builder.Benchmark(Project::GetLibraryDirectory() / "PakBenchmark");
+	}
+
 }
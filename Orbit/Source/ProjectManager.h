@@ -21,6 +21,11 @@ namespace Gravix
 		bool SaveActiveProject();
 		bool SaveActiveProjectAs();
 
+		// Cooks every registered asset into a .gpak for shipped builds
+		bool BuildAssetPack();
+		// Logs pack ratio and read throughput, compressed vs raw, for the current assets
+		void BenchmarkAssetPack();
+
 		// Callbacks for when project operations complete
 		void SetOnProjectLoadedCallback(std::function<void()> callback) { m_OnProjectLoaded = callback; }
 		void SetOnProjectCreatedCallback(std::function<void()> callback) { m_OnProjectCreated = callback; }
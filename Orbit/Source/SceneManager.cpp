@@ -89,8 +89,21 @@ namespace Gravix
 
 			if (!scene)
 			{
-				// Scene is loading asynchronously, track it so we can auto-load when ready
+				// Scene is loading asynchronously; switch to it once it is published, unless another
+				// scene was opened in the meantime
 				m_PendingSceneHandle = handle;
+				AssetManager::LoadAsync<Scene>(handle).Then([this, handle](Ref<Scene> loadedScene)
+					{
+						if (m_PendingSceneHandle != handle)
+							return;
+
+						m_PendingSceneHandle = 0;
+						if (loadedScene)
+						{
+							GX_CORE_INFO("Async scene load completed, switching to scene {0}", static_cast<uint64_t>(handle));
+							OpenScene(handle, false); // AssetManager already deserialized the scene
+						}
+					});
 				GX_CORE_INFO("Scene {0} is loading asynchronously, will auto-switch when ready", static_cast<uint64_t>(handle));
 				return false;
 			}
@@ -105,6 +118,8 @@ namespace Gravix
 				Application::Get().GetWindow().GetDevice()->WaitIdle();
 			}
 
+			BeginSceneLoads();
+
 			m_ActiveSceneHandle = handle;
 			m_EditorScene = scene;
 			m_ActiveScene = m_EditorScene;
@@ -143,6 +158,7 @@ namespace Gravix
 				SceneSerializer serializer(m_EditorScene);
 				serializer.Deserialize(filePath);
 
+				BeginSceneLoads();
 				m_ActiveSceneHandle = startScene;
 				m_EditorScene->OnViewportResize((uint32_t)viewportSize.x, (uint32_t)viewportSize.y);
 
@@ -193,6 +209,9 @@ namespace Gravix
 			Application::Get().GetWindow().GetDevice()->WaitIdle();
 		}
 
+		if (handle != m_ActiveSceneHandle)
+			BeginSceneLoads();
+
 		m_ActiveScene = scene;
 		m_ActiveSceneHandle = handle;
 
@@ -200,6 +219,15 @@ namespace Gravix
 			m_OnSceneChanged();
 	}
 
+	void SceneManager::BeginSceneLoads()
+	{
+		if (m_SceneLoadToken)
+			m_SceneLoadToken->Cancel();
+
+		m_SceneLoadToken = CreateRef<LoadCancellationToken>();
+		AssetManager::GetSlotTable().SetLoadCancellationToken(m_SceneLoadToken);
+	}
+
 	void SceneManager::MarkSceneDirty()
 	{
 		if (!m_SceneDirty)
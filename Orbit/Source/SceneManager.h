@@ -2,6 +2,7 @@
 
 #include "Scene/Scene.h"
 #include "Asset/Asset.h"
+#include "Asset/AsyncLoadRequest.h"
 #include "Core/Core.h"
 
 #include <filesystem>
@@ -65,12 +66,17 @@ namespace Gravix
 		{
 			return m_ActiveScene->GetAllEntitiesWith<Components...>();
 		}
+	private:
+		// Cancels asset loads still pending for the outgoing scene and starts a fresh token
+		void BeginSceneLoads();
 	private:
 		Ref<Scene> m_ActiveScene;
 		Ref<Scene> m_EditorScene;
 		AssetHandle m_ActiveSceneHandle = 0;
 		AssetHandle m_PendingSceneHandle = 0;
 
+		Ref<LoadCancellationToken> m_SceneLoadToken;
+
 		SceneState m_SceneState = SceneState::Edit;
 		bool m_SceneDirty = false;
 
@@ -50,6 +50,18 @@ namespace Gravix
 
 			ImGui::Separator();
 
+			if (m_ProjectManager && ImGui::MenuItem("Build Asset Pack...", nullptr, false, Project::HasActiveProject()))
+			{
+				m_ProjectManager->BuildAssetPack();
+			}
+
+			if (m_ProjectManager && ImGui::MenuItem("Benchmark Asset Pack", nullptr, false, Project::HasActiveProject()))
+			{
+				m_ProjectManager->BenchmarkAssetPack();
+			}
+
+			ImGui::Separator();
+
 #ifdef ENGINE_DEBUG
 			// Toggle profiler viewer
 			bool profilerVisible = Application::Get().GetProfiler().IsVisible();
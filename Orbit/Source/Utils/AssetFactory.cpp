@@ -19,7 +19,9 @@ namespace Gravix
 		std::filesystem::path filePath = directory / (baseName + extension);
 		int counter = 1;
 
-		while (std::filesystem::exists(filePath))
+		// A registered path whose file is gone would hand the new file the old asset's handle
+		Ref<EditorAssetManager> assetManager = Project::GetActive()->GetEditorAssetManager();
+		while (std::filesystem::exists(filePath) || assetManager->GetAssetHandle(filePath) != 0)
 		{
 			filePath = directory / (baseName + std::to_string(counter++) + extension);
 		}
@@ -0,0 +1,259 @@
+#include "Core/Gravix.h"
+
+#include "Renderer/Null/NullDevice.h"
+#include "Renderer/Null/Types/NullMesh.h"
+#include "Reflections/ShaderReflection.h"
+
+#include <glm/gtc/epsilon.hpp>
+
+#include <cstring>
+#include <unordered_map>
+
+// Renders a scene through Renderer2D on the Null device and checks what reached the "GPU":
+// draw counts, uploaded bytes, bindings and the vertex data the shaders would fetch.
+
+#define TEST_CHECK(condition) if (!(condition)) { GX_ERROR("Check failed: {} ({}:{})", #condition, __FILE__, __LINE__); s_Failures++; }
+
+namespace Gravix
+{
+
+	static int s_Failures = 0;
+
+	// Tightly packed, the way ShaderReflector lays out structs reached through pointers
+	static ReflectedStruct MakeStruct(const std::string& name, std::initializer_list<std::pair<const char*, size_t>> fields)
+	{
+		ReflectedStruct result;
+		result.Name = name;
+		result.Size = 0;
+		for (const auto& [fieldName, size] : fields)
+		{
+			result.Members.push_back({ fieldName, result.Size, size });
+			result.Size += size;
+		}
+		return result;
+	}
+
+	// Reflection of Assets/shaders/*.slang as the editor would cook it; runtime builds cannot compile Slang
+	static Ref<Shader> MakeShader(const std::string& name, const ReflectedStruct& vertex)
+	{
+		ReflectedStruct pushConstants = MakeStruct("PushConstants", { { "viewProjMatrix", sizeof(glm::mat4) }, { "vertex", sizeof(uint64_t) } });
+
+		ShaderReflection reflection;
+		reflection.SetShaderName(name);
+		reflection.AddEntryPoint({ "mainVS", ShaderStage::Vertex });
+		reflection.AddEntryPoint({ "mainPS", ShaderStage::Fragment });
+		reflection.AddPushConstantRange("pc", { static_cast<uint32_t>(pushConstants.Size), 0 });
+		reflection.AddReflectedStruct("PushConstants", pushConstants);
+		reflection.AddReflectedStruct("Vertex", vertex);
+
+		return Shader::Create("Assets/shaders/" + name + ".slang", ShaderType::Graphics, {}, reflection);
+	}
+
+	template<typename T>
+	static T ReadField(const uint8_t* data, const ReflectedStruct& layout, const std::string& field)
+	{
+		T value{};
+		for (const ReflectedStructMember& member : layout.Members)
+		{
+			if (member.Name == field)
+				std::memcpy(&value, data + member.Offset, sizeof(T));
+		}
+		return value;
+	}
+
+	static bool NearlyEqual(const glm::vec4& a, const glm::vec4& b)
+	{
+		return glm::all(glm::epsilonEqual(a, b, 1e-5f));
+	}
+
+	struct ExpectedShape
+	{
+		glm::mat4 Transform;
+		glm::vec4 Color;
+	};
+
+	static const glm::vec4 s_QuadOffsets[4] =
+	{
+		{ -0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f,  0.5f, 0.0f, 1.0f },
+		{ -0.5f,  0.5f, 0.0f, 1.0f }
+	};
+
+	// Follows the vertex pointer in the draw's push constants, as the vertex shader does
+	static const uint8_t* GetDrawVertices(const NullDrawRecord& draw, const ReflectedStruct& pushConstants)
+	{
+		uint64_t address = ReadField<uint64_t>(draw.PushConstants.data(), pushConstants, "vertex");
+		return reinterpret_cast<const uint8_t*>(address);
+	}
+
+	static void CheckShapes(const NullDrawRecord& draw, const ReflectedStruct& pushConstants, const ReflectedStruct& vertex,
+		const std::unordered_map<uint32_t, ExpectedShape>& expected, const char* positionField)
+	{
+		TEST_CHECK(draw.Indexed);
+		TEST_CHECK(draw.Count == expected.size() * 6);
+		TEST_CHECK(draw.Mesh != nullptr);
+		TEST_CHECK(draw.PushConstants.size() == pushConstants.Size);
+		if (!draw.Indexed || draw.Mesh == nullptr || draw.PushConstants.size() != pushConstants.Size)
+			return;
+
+		const uint8_t* vertices = GetDrawVertices(draw, pushConstants);
+		TEST_CHECK(vertices == draw.Mesh->GetVertexData().data());
+		TEST_CHECK(draw.Mesh->GetVertexSize() == vertex.Size);
+		TEST_CHECK(draw.Mesh->GetVertexCount() == expected.size() * 4);
+		if (vertices != draw.Mesh->GetVertexData().data() || draw.Mesh->GetVertexCount() != expected.size() * 4)
+			return;
+
+		for (size_t shape = 0; shape < expected.size(); shape++)
+		{
+			const uint8_t* first = vertices + shape * 4 * vertex.Size;
+			auto it = expected.find(ReadField<uint32_t>(first, vertex, "entityID"));
+			TEST_CHECK(it != expected.end());
+			if (it == expected.end())
+				continue;
+
+			for (uint32_t corner = 0; corner < 4; corner++)
+			{
+				const uint8_t* data = first + corner * vertex.Size;
+				TEST_CHECK(ReadField<uint32_t>(data, vertex, "entityID") == it->first);
+				TEST_CHECK(NearlyEqual(ReadField<glm::vec4>(data, vertex, positionField), it->second.Transform * s_QuadOffsets[corner]));
+				TEST_CHECK(NearlyEqual(ReadField<glm::vec4>(data, vertex, "color"), it->second.Color));
+			}
+		}
+	}
+
+	static int Run()
+	{
+		ApplicationSpecification appSpec{};
+		appSpec.Width = 1280;
+		appSpec.Height = 720;
+		appSpec.Title = "Headless Render Test";
+		appSpec.IsRuntime = true;
+		appSpec.Headless = true;
+
+		Application app(appSpec);
+		Project::New();
+
+		Device* device = app.GetWindow().GetDevice();
+		TEST_CHECK(device->GetType() == DeviceType::Null);
+		if (device->GetType() != DeviceType::Null)
+			return 1;
+		NullDevice* nullDevice = static_cast<NullDevice*>(device);
+
+		FramebufferSpecification fbSpec{};
+		fbSpec.Width = appSpec.Width;
+		fbSpec.Height = appSpec.Height;
+		fbSpec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RedInt, FramebufferTextureFormat::Depth };
+		Ref<Framebuffer> renderTarget = Framebuffer::Create(fbSpec);
+
+		ReflectedStruct pushConstants = MakeStruct("PushConstants", { { "viewProjMatrix", sizeof(glm::mat4) }, { "vertex", sizeof(uint64_t) } });
+		ReflectedStruct quadVertex = MakeStruct("Vertex", { { "position", 16 }, { "uv", 8 }, { "color", 16 }, { "texIndex", 4 }, { "tilingFactor", 4 }, { "entityID", 4 } });
+		ReflectedStruct circleVertex = MakeStruct("Vertex", { { "worldPosition", 16 }, { "localPosition", 16 }, { "color", 16 }, { "thickness", 4 }, { "fade", 4 }, { "entityID", 4 } });
+		ReflectedStruct lineVertex = MakeStruct("Vertex", { { "position", 12 }, { "color", 16 } });
+
+		Renderer2DShaders shaders;
+		shaders.Quad = MakeShader("quad", quadVertex);
+		shaders.Circle = MakeShader("circle", circleVertex);
+		shaders.Line = MakeShader("line", lineVertex);
+		Renderer2D::Init(renderTarget, shaders);
+
+		Ref<Scene> scene = CreateRef<Scene>();
+
+		Entity cameraEntity = scene->CreateEntity("Camera");
+		cameraEntity.AddComponent<CameraComponent>().Primary = true;
+		scene->OnViewportResize(appSpec.Width, appSpec.Height);
+
+		constexpr uint32_t spriteCount = 3;
+		constexpr uint32_t circleCount = 2;
+
+		std::unordered_map<uint32_t, ExpectedShape> sprites;
+		for (uint32_t i = 0; i < spriteCount; i++)
+		{
+			Entity entity = scene->CreateEntity("Sprite");
+			auto& transform = entity.GetComponent<TransformComponent>();
+			transform.Position = { i * 1.5f, -1.0f, 0.0f };
+			transform.Rotation = { 0.0f, 0.0f, i * 30.0f };
+			transform.Scale = { 1.0f + i, 1.0f, 1.0f };
+			transform.CalculateTransform();
+
+			glm::vec4 color = { 0.2f * i, 0.5f, 1.0f, 1.0f };
+			entity.AddComponent<SpriteRendererComponent>().Color = color;
+			sprites[static_cast<uint32_t>(static_cast<entt::entity>(entity))] = { transform.Transform, color };
+		}
+
+		std::unordered_map<uint32_t, ExpectedShape> circles;
+		for (uint32_t i = 0; i < circleCount; i++)
+		{
+			Entity entity = scene->CreateEntity("Circle");
+			auto& transform = entity.GetComponent<TransformComponent>();
+			transform.Position = { -2.0f * (i + 1), 1.0f, 0.0f };
+			transform.CalculateTransform();
+
+			glm::vec4 color = { 1.0f, 0.25f * i, 0.0f, 1.0f };
+			entity.AddComponent<CircleRendererComponent>().Color = color;
+			circles[static_cast<uint32_t>(static_cast<entt::entity>(entity))] = { transform.Transform, color };
+		}
+
+		// Init uploads the white texture and the index buffers; only the frame is measured
+		nullDevice->ResetStats();
+
+		nullDevice->StartFrame();
+		{
+			Command cmd(renderTarget, 0, false);
+			cmd.BeginRendering();
+			scene->OnRuntimeRender(cmd);
+			cmd.EndRendering();
+		}
+		nullDevice->EndFrame();
+
+		const NullRenderStats& stats = nullDevice->GetLastFrameStats();
+
+		// Quads and circles are indexed; lines are one non-indexed draw even when empty
+		TEST_CHECK(stats.RenderPasses == 1);
+		TEST_CHECK(stats.DrawCalls == 3);
+		TEST_CHECK(stats.IndexedDrawCalls == 2);
+		TEST_CHECK(stats.IndicesSubmitted == (spriteCount + circleCount) * 6);
+		TEST_CHECK(stats.VerticesSubmitted == 0);
+		TEST_CHECK(stats.SwapchainCopies == 0);
+
+		TEST_CHECK(stats.MaterialBinds == 3);
+		TEST_CHECK(stats.MeshBinds == 2);
+		TEST_CHECK(stats.TextureBindings == 1); // Untextured sprites only use the white texture
+		TEST_CHECK(stats.GetResourceBindings() == 1);
+
+		TEST_CHECK(stats.VertexBytesUploaded == spriteCount * 4 * quadVertex.Size + circleCount * 4 * circleVertex.Size);
+		TEST_CHECK(stats.IndexBytesUploaded == 0);
+		TEST_CHECK(stats.TextureBytesUploaded == 0);
+		TEST_CHECK(stats.GetBytesUploaded() == stats.VertexBytesUploaded);
+		TEST_CHECK(stats.PushConstantBytes == 3 * pushConstants.Size);
+
+		const std::vector<NullDrawRecord>& draws = nullDevice->GetLastFrameDraws();
+		TEST_CHECK(draws.size() == 3);
+		if (draws.size() == 3)
+		{
+			const glm::mat4& projection = cameraEntity.GetComponent<CameraComponent>().Camera.GetProjection();
+			glm::mat4 viewProjection = ReadField<glm::mat4>(draws[0].PushConstants.data(), pushConstants, "viewProjMatrix");
+			for (int column = 0; column < 4; column++)
+				TEST_CHECK(NearlyEqual(viewProjection[column], projection[column]));
+
+			CheckShapes(draws[0], pushConstants, quadVertex, sprites, "position");
+			CheckShapes(draws[1], pushConstants, circleVertex, circles, "worldPosition");
+
+			TEST_CHECK(!draws[2].Indexed);
+			TEST_CHECK(draws[2].Count == 0);
+		}
+
+		Renderer2D::Destroy();
+
+		if (s_Failures == 0)
+			GX_INFO("Headless render test passed");
+		return s_Failures == 0 ? 0 : 1;
+	}
+
+}
+
+int main()
+{
+	Gravix::Log::Init();
+	return Gravix::Run();
+}